@@ -142,6 +142,21 @@ ApiUtil::ApiUtil():exit_lock_installed(false),reset_already_executed_flag(false)
 		if (iss)
 			ext->user_sub_hwm = sub_hwm;
 	}
+
+//
+// Check if the user wants the event callbacks to be executed by a pool of dispatch threads
+// instead of the event receiving thread
+//
+
+	var.clear();
+	if (get_env_var("TANGO_EVENT_DISPATCH_THREADS",var) == 0)
+	{
+		int dispatch_nb = -1;
+		istringstream iss(var);
+		iss >> dispatch_nb;
+		if (iss)
+			ext->event_dispatch_threads = dispatch_nb;
+	}
 }
 
 //+----------------------------------------------------------------------------
@@ -396,8 +411,10 @@ void ApiUtil::get_asynch_replies()
 				break;
 			}
 
+			CallBack *cb = tg_req.cb_ptr;
 			tg_req.dev->dec_asynch_counter(CALL_BACK);
 			asyn_p_table->remove_request(tg_req.dev,req);
+			AsynCompletionQueue::publish(cb);
 		}
 	}
 	catch (CORBA::BAD_INV_ORDER &e)
@@ -432,8 +449,10 @@ void ApiUtil::get_asynch_replies()
 				pos->first->Cb_WriteAttr_Request(pos->second.request,pos->second.cb_ptr);
 				break;
 			}
+			CallBack *cb = pos->second.cb_ptr;
 			pos->first->dec_asynch_counter(CALL_BACK);
 			asyn_p_table->remove_request(pos->first,pos->second.request);
+			AsynCompletionQueue::publish(cb);
 		}
 
 	}
@@ -482,8 +501,10 @@ void ApiUtil::get_asynch_replies(long call_timeout)
 				pos->first->Cb_WriteAttr_Request(pos->second.request,pos->second.cb_ptr);
 				break;
 			}
+			CallBack *cb = pos->second.cb_ptr;
 			pos->first->dec_asynch_counter(CALL_BACK);
 			asyn_p_table->remove_request(pos->first,pos->second.request);
+			AsynCompletionQueue::publish(cb);
 		}
 
 	}
@@ -555,8 +576,10 @@ void ApiUtil::get_asynch_replies(long call_timeout)
 							break;
 						}
 
+						CallBack *cb = tg_req.cb_ptr;
 						tg_req.dev->dec_asynch_counter(CALL_BACK);
 						asyn_p_table->remove_request(tg_req.dev,req);
+						AsynCompletionQueue::publish(cb);
 					}
 				}
 				catch (CORBA::BAD_INV_ORDER &e)
@@ -622,8 +645,10 @@ void ApiUtil::get_asynch_replies(long call_timeout)
 						break;
 					}
 
+					CallBack *cb = tg_req.cb_ptr;
 					tg_req.dev->dec_asynch_counter(CALL_BACK);
 					asyn_p_table->remove_request(tg_req.dev,req);
+					AsynCompletionQueue::publish(cb);
 				}
 				catch (CORBA::BAD_INV_ORDER &e)
 				{
@@ -719,6 +744,60 @@ ZmqEventConsumer *ApiUtil::get_zmq_event_consumer()
 	return ext->zmq_event_consumer;
 }
 
+//+----------------------------------------------------------------------------
+//
+// method : 		ApiUtil::subscribe_event()
+//
+// description : 	Subscribe to the same event type for a list of
+//					attributes. With ZMQ, the subscription is done with one
+//					command per device server (see
+//					EventConsumer::subscribe_event()). Events from device
+//					servers without ZMQ event support are subscribed one at
+//					a time through DeviceProxy::subscribe_event() which
+//					uses notifd
+//
+// argin(s) :		devices : The device handles
+//					attributes : The attribute names (one per device handle)
+//					event : The type of event to subscribe for
+//					callback : A pointer to the callback object
+//					filters : Eventual event filter strings
+//					stateless : Flag to enable the stateless connection
+//
+// argout :			event_ids : The event identifiers (one per attribute)
+//
+//-----------------------------------------------------------------------------
+
+void ApiUtil::subscribe_event(const vector<DeviceProxy *> &devices,const vector<string> &attributes,EventType event,
+							  CallBack *callback,const vector<string> &filters,vector<int> &event_ids,bool stateless)
+{
+	if (ext->zmq_event_consumer == NULL)
+	{
+		create_zmq_event_consumer();
+	}
+
+//
+// First, try using zmq. If it fails with the error "Command Not Found",
+// subscribe the events not yet subscribed one by one (zmq or notifd)
+//
+
+	try
+	{
+		ext->zmq_event_consumer->subscribe_event(devices,attributes,event,callback,filters,event_ids,stateless);
+	}
+	catch (DevFailed &e)
+	{
+		string reason(e.errors[0].reason.in());
+		if (reason != "API_CommandNotFound" || event_ids.size() != devices.size())
+			throw;
+
+		for (size_t loop = 0;loop < devices.size();loop++)
+		{
+			if (event_ids[loop] == 0)
+				event_ids[loop] = devices[loop]->subscribe_event(attributes[loop],event,callback,filters,stateless);
+		}
+	}
+}
+
 //+----------------------------------------------------------------------------
 //
 // method : 		ApiUtil::clean_locking_threads()
@@ -123,8 +123,10 @@ void AsynReq::store_request(CORBA::Request_ptr req,
 	TgRequest tmp_req(dev,type,cb);
 
 	omni_mutex_lock sync(*this);
-	cb_dev_table.insert(map<Connection *,TgRequest>::value_type(dev,tmp_req_dev));
+	multimap<Connection *,TgRequest>::iterator pos;
+	pos = cb_dev_table.insert(map<Connection *,TgRequest>::value_type(dev,tmp_req_dev));
 	cb_req_table.insert(map<CORBA::Request_ptr,TgRequest>::value_type(req,tmp_req));
+	cb_dev_index.insert(make_pair(req,pos));
 
 }
 
@@ -243,17 +245,12 @@ Tango::TgRequest *AsynReq::get_request(Tango::Connection *dev)
 
 void AsynReq::mark_as_arrived(CORBA::Request_ptr req)
 {
-	multimap<Connection *,TgRequest>::iterator pos;
+	map<CORBA::Request_ptr,multimap<Connection *,TgRequest>::iterator>::iterator pos;
 
 	omni_mutex_lock sync(*this);
-	for (pos = cb_dev_table.begin();pos != cb_dev_table.end();++pos)
-	{
-		if (pos->second.request == req)
-		{
-			pos->second.arrived = true;
-			break;
-		}
-	}
+	pos = cb_dev_index.find(req);
+	if (pos != cb_dev_index.end())
+		pos->second->second.arrived = true;
 }
 
 //+----------------------------------------------------------------------------
@@ -342,18 +339,16 @@ bool AsynReq::remove_cancelled_request(long req_id)
 
 void AsynReq::remove_request(Connection *dev,CORBA::Request_ptr req)
 {
-	multimap<Connection *,TgRequest>::iterator pos;
+	map<CORBA::Request_ptr,multimap<Connection *,TgRequest>::iterator>::iterator pos;
 	map<CORBA::Request_ptr,TgRequest>::iterator pos_req;
 
 	omni_mutex_lock sync(*this);
-	for (pos = cb_dev_table.lower_bound(dev);pos != cb_dev_table.upper_bound(dev);++pos)
+	pos = cb_dev_index.find(req);
+	if ((pos != cb_dev_index.end()) && (pos->second->first == dev))
 	{
-		if (pos->second.request == req)
-		{
-			CORBA::release(pos->second.request);
-			cb_dev_table.erase(pos);
-			break;
-		}
+		CORBA::release(pos->second->second.request);
+		cb_dev_table.erase(pos->second);
+		cb_dev_index.erase(pos);
 	}
 
 	pos_req = cb_req_table.find(req);
@@ -82,10 +82,23 @@ private :
     class DatabaseExt
     {
     public:
-        DatabaseExt():db_tg(NULL) {};
+        DatabaseExt():db_tg(NULL),prop_cache_ttl(0),prop_cache_hits(0),prop_cache_misses(0) {};
 
         Tango::Util 	*db_tg;
         omni_mutex		map_mutex;
+        omni_mutex		db_cache_mutex;		// Protect the server cache (parallel device creation)
+
+        struct PropCacheEntry
+        {
+            double			date;				// Entry insertion date (mS)
+            vector<string>	values;				// Property value(s)
+        };
+
+        omni_mutex					prop_cache_mutex;
+        map<string,PropCacheEntry>	prop_cache;			// Key is: type + object name + '/' + property name
+        long						prop_cache_ttl;		// Entry validity (mS). 0 means cache disabled
+        unsigned long				prop_cache_hits;
+        unsigned long				prop_cache_misses;
     };
 
 #ifdef HAS_UNIQUE_PTR
@@ -118,6 +131,14 @@ private :
 	void set_server_release();
 	void check_access_and_get();
 
+	bool get_prop_from_cache(char,string &,DbData &);
+	void store_prop_in_cache(char,string &,DbData &);
+	void invalidate_prop_cache(char,string &);
+	void get_property_multi(char,vector<string> &,vector<DbData> &);
+	void decode_dev_property(const DevVarStringArray *,DbData &);
+	void decode_dev_att_property(const DevVarStringArray *,DbData &);
+	void decode_class_property(const DevVarStringArray *,DbData &);
+
 public :
 	Database(CORBA::ORB *orb=NULL);
 	Database(string &host, int port, CORBA::ORB *orb=NULL);
@@ -139,6 +160,7 @@ public :
 	void set_access_checked(bool val) {access_checked = val;}
 
 	void set_tango_utils(Tango::Util *ptr) {ext->db_tg=ptr;}
+	omni_mutex &get_db_cache_mutex() {return ext->db_cache_mutex;}
 	int get_server_release() {return serv_version;}
 
 	DevErrorList &get_access_except_errors() {return access_except_errors;}
@@ -227,6 +249,7 @@ public :
 
 	void get_device_property(string, DbData &, DbServerCache *dsc);
 	void get_device_property(string st, DbData &db) {get_device_property(st,db,NULL);}
+	void get_device_property(vector<string> &devs,vector<DbData> &dbs) {get_property_multi('d',devs,dbs);}
 	void put_device_property(string, DbData &);
 	void delete_device_property(string, DbData &);
 	vector<DbHistory> get_device_property_history(string &,string &);
@@ -235,6 +258,7 @@ public :
 
 	void get_device_attribute_property(string, DbData &, DbServerCache *dsc);
 	void get_device_attribute_property(string st, DbData &db) {get_device_attribute_property(st,db,NULL);}
+	void get_device_attribute_property(vector<string> &devs,vector<DbData> &dbs) {get_property_multi('a',devs,dbs);}
 	void put_device_attribute_property(string, DbData &);
 	void delete_device_attribute_property(string, DbData &);
 	void delete_all_device_attribute_property(string, DbData &);
@@ -242,6 +266,7 @@ public :
 
 	void get_class_property(string, DbData &, DbServerCache *dsc);
 	void get_class_property(string st,DbData &db) {get_class_property(st,db,NULL);}
+	void get_class_property(vector<string> &classes,vector<DbData> &dbs) {get_property_multi('c',classes,dbs);}
 	void put_class_property(string, DbData &);
 	void delete_class_property(string, DbData &);
 	vector<DbHistory> get_class_property_history(string &,string &);
@@ -256,6 +281,16 @@ public :
 	DbDatum get_class_attribute_list(string &,string &);
 
 
+//
+// property cache methods
+//
+
+	void set_property_cache_ttl(long);
+	long get_property_cache_ttl() {return ext->prop_cache_ttl;}
+	void clear_property_cache();
+	unsigned long get_property_cache_hits();
+	unsigned long get_property_cache_misses();
+
 // attribute methods
 
 	void get_attribute_alias(string, string&);
@@ -808,6 +843,8 @@ private:
 	int find_dev_att(DevString,int &,int &);
 	int find_obj(DevString obj_name,int &);
 	void get_obj_prop_list(DevVarStringArray *,PropEltIdx &);
+	void build_name_maps();
+	int find_att(int,DevString);
 
 	CORBA::Any_var			received;
 	const DevVarStringArray *data_list;
@@ -832,6 +869,11 @@ private:
 	DevVarStringArray		ret_dev_list;
 	DevVarStringArray		ret_obj_att_prop;
 	DevVarStringArray		ret_prop_list;
+
+	map<string,int>			class_map;		// Lower case class name -> class index
+	map<string,pair<int,int> > dev_map;		// Lower case device name -> class and device index
+	map<pair<int,string>,int> prop_map;		// Object first index + lower case prop name -> index in props_idx
+	map<pair<int,string>,int> att_map;		// Object first index + lower case att name -> index in data_list
 };
 
 } // End of Tango namespace
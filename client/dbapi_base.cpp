@@ -380,6 +380,7 @@ Database::Database(const Database &sou):Connection(sou),ext(Tango_NullPtr)
     {
         ext.reset(new DatabaseExt);
         ext->db_tg = sou.ext->db_tg;
+        ext->prop_cache_ttl = sou.ext->prop_cache_ttl;
     }
 #else
 	if (sou.ext == NULL)
@@ -388,6 +389,7 @@ Database::Database(const Database &sou):Connection(sou),ext(Tango_NullPtr)
 	{
 		ext = new DatabaseExt();
 		ext->db_tg = sou.ext->db_tg;
+		ext->prop_cache_ttl = sou.ext->prop_cache_ttl;
 	}
 #endif
 
@@ -440,6 +442,7 @@ Database &Database::operator=(const Database &rval)
         {
             ext.reset(new DatabaseExt);
             ext->db_tg = rval.ext->db_tg;
+            ext->prop_cache_ttl = rval.ext->prop_cache_ttl;
         }
         else
             ext.reset();
@@ -449,6 +452,7 @@ Database &Database::operator=(const Database &rval)
         {
             ext = new DatabaseExt;
             ext->db_tg = rval.ext->db_tg;
+            ext->prop_cache_ttl = rval.ext->prop_cache_ttl;
         }
         else
             ext = NULL;
@@ -752,6 +756,7 @@ DbDevImportInfo Database::import_device(string &dev)
 	Any_var received;
 	AutoConnectTimeout act(DB_RECONNECT_TIMEOUT);
 	const DevVarLongStringArray *dev_import_list = NULL;
+	DevVarLongStringArray tac_import;
 
 //
 // Import device is allways possible whatever access rights are
@@ -798,7 +803,9 @@ DbDevImportInfo Database::import_device(string &dev)
                             DbServerCache *dsc = ext->db_tg->get_db_cache();
                             if (dsc != NULL)
                             {
-                                dev_import_list = dsc->import_tac_dev(dev);
+                                omni_mutex_lock guard(ext->db_cache_mutex);
+                                tac_import = *(dsc->import_tac_dev(dev));
+                                dev_import_list = &tac_import;
                                 imported_from_cache = true;
                             }
                         }
@@ -1131,9 +1138,17 @@ void Database::get_device_property(string dev, DbData &db_data,DbServerCache *db
 	unsigned int i;
 	Any_var received;
 	const DevVarStringArray *property_values = NULL;
+	DevVarStringArray cache_values;
 
 	check_access_and_get();
 
+//
+// First, try the client property cache
+//
+
+	if ((db_cache == NULL) && (get_prop_from_cache('d',dev,db_data) == true))
+		return;
+
 	DevVarStringArray *property_names = new DevVarStringArray;
 	property_names->length(db_data.size()+1);
 	(*property_names)[0] = string_dup(dev.c_str());
@@ -1170,7 +1185,9 @@ void Database::get_device_property(string dev, DbData &db_data,DbServerCache *db
 
 		try
 		{
-			property_values = db_cache->get_dev_property(property_names);
+			omni_mutex_lock guard(ext->db_cache_mutex);
+			cache_values = *(db_cache->get_dev_property(property_names));
+			property_values = &cache_values;
 			delete property_names;
 		}
 		catch(Tango::DevFailed &e)
@@ -1201,7 +1218,25 @@ void Database::get_device_property(string dev, DbData &db_data,DbServerCache *db
 		}
 	}
 
-	unsigned int n_props, index;
+	decode_dev_property(property_values,db_data);
+
+	if (db_cache == NULL)
+		store_prop_in_cache('d',dev,db_data);
+
+	return;
+}
+
+//-----------------------------------------------------------------------------
+//
+// Database::decode_dev_property() - private method to build the DbData
+//				     returned to the caller from the data received
+//				     from the db server (or from the server cache)
+//
+//-----------------------------------------------------------------------------
+
+void Database::decode_dev_property(const DevVarStringArray *property_values,DbData &db_data)
+{
+	unsigned int i,n_props, index;
 	stringstream iostream;
 
 	iostream << (*property_values)[1].in() << ends;
@@ -1230,8 +1265,6 @@ void Database::get_device_property(string dev, DbData &db_data,DbServerCache *db
 			}
 		}
 	}
-
-	return;
 }
 
 //-----------------------------------------------------------------------------
@@ -1277,6 +1310,8 @@ void Database::put_device_property(string dev, DbData &db_data)
 	}
 	send <<= property_values;
 
+	invalidate_prop_cache('d',dev);
+
 	if (filedb != 0)
 	{
 		CORBA::Any_var the_any;
@@ -1311,6 +1346,8 @@ void Database::delete_device_property(string dev, DbData &db_data)
 	}
 	send <<= property_names;
 
+	invalidate_prop_cache('d',dev);
+
 	if (filedb != 0)
 		filedb->DbDeleteDeviceProperty(send);
 	else
@@ -1329,12 +1366,20 @@ void Database::delete_device_property(string dev, DbData &db_data)
 
 void Database::get_device_attribute_property(string dev, DbData &db_data, DbServerCache *db_cache)
 {
-	unsigned int i,j;
+	unsigned int i;
 	Any_var received;
 	const DevVarStringArray *property_values = NULL;
+	DevVarStringArray cache_values;
 
 	check_access_and_get();
 
+//
+// First, try the client property cache
+//
+
+	if ((db_cache == NULL) && (get_prop_from_cache('a',dev,db_data) == true))
+		return;
+
 	DevVarStringArray *property_names = new DevVarStringArray;
 	property_names->length(db_data.size()+1);
 	(*property_names)[0] = string_dup(dev.c_str());
@@ -1386,7 +1431,9 @@ void Database::get_device_attribute_property(string dev, DbData &db_data, DbServ
 
 		try
 		{
-			property_values = db_cache->get_dev_att_property(property_names);
+			omni_mutex_lock guard(ext->db_cache_mutex);
+			cache_values = *(db_cache->get_dev_att_property(property_names));
+			property_values = &cache_values;
 			delete property_names;
 		}
 		catch (Tango::DevFailed &e)
@@ -1421,6 +1468,27 @@ void Database::get_device_attribute_property(string dev, DbData &db_data, DbServ
 		}
 	}
 
+	decode_dev_att_property(property_values,db_data);
+
+	if (db_cache == NULL)
+		store_prop_in_cache('a',dev,db_data);
+
+    cout4 << "Leaving get_device_attribute_property" << endl;
+	return;
+}
+
+//-----------------------------------------------------------------------------
+//
+// Database::decode_dev_att_property() - private method to build the DbData
+//					 returned to the caller from the data
+//					 received from the db server (or from the
+//					 server cache)
+//
+//-----------------------------------------------------------------------------
+
+void Database::decode_dev_att_property(const DevVarStringArray *property_values,DbData &db_data)
+{
+	unsigned int i,j;
 	unsigned int n_attribs, index;
 	int i_total_props;
 	stringstream iostream;
@@ -1498,9 +1566,6 @@ void Database::get_device_attribute_property(string dev, DbData &db_data, DbServ
 			}
 		}
 	}
-
-    cout4 << "Leaving get_device_attribute_property" << endl;
-	return;
 }
 
 //-----------------------------------------------------------------------------
@@ -1604,6 +1669,7 @@ void Database::put_device_attribute_property(string dev, DbData &db_data)
 		}
 		send <<= property_values;
 
+		invalidate_prop_cache('a',dev);
 
 		if (filedb != 0)
 		{
@@ -1656,6 +1722,8 @@ void Database::delete_device_attribute_property(string dev, DbData &db_data)
 
 	send <<= property_values;
 
+	invalidate_prop_cache('a',dev);
+
 	if (filedb != 0)
 		filedb->DbDeleteDeviceAttributeProperty(send);
 	else
@@ -1675,8 +1743,16 @@ void Database::get_class_property(string device_class, DbData &db_data, DbServer
 {
 	unsigned int i;
 	const DevVarStringArray *property_values = NULL;
+	DevVarStringArray cache_values;
 	Any_var received;
 
+//
+// First, try the client property cache
+//
+
+	if ((db_cache == NULL) && (get_prop_from_cache('c',device_class,db_data) == true))
+		return;
+
 //
 // Parameters for db server call
 //
@@ -1703,7 +1779,9 @@ void Database::get_class_property(string device_class, DbData &db_data, DbServer
 
 		try
 		{
-			property_values = db_cache->get_class_property(property_names);
+			omni_mutex_lock guard(ext->db_cache_mutex);
+			cache_values = *(db_cache->get_class_property(property_names));
+			property_values = &cache_values;
 			delete property_names;
 		}
 		catch(Tango::DevFailed &e)
@@ -1758,7 +1836,26 @@ void Database::get_class_property(string device_class, DbData &db_data, DbServer
 // Build data returned to caller from those received from db server or from cache
 //
 
-	unsigned int n_props, index;
+	decode_class_property(property_values,db_data);
+
+	if (db_cache == NULL)
+		store_prop_in_cache('c',device_class,db_data);
+
+	return;
+}
+
+//-----------------------------------------------------------------------------
+//
+// Database::decode_class_property() - private method to build the DbData
+//				       returned to the caller from the data
+//				       received from the db server (or from the
+//				       server cache)
+//
+//-----------------------------------------------------------------------------
+
+void Database::decode_class_property(const DevVarStringArray *property_values,DbData &db_data)
+{
+	unsigned int i,n_props, index;
 	stringstream iostream;
 
 	iostream << (*property_values)[1].in() << ends;
@@ -1779,8 +1876,6 @@ void Database::get_class_property(string device_class, DbData &db_data, DbServer
 			index++;
 		}
 	}
-
-	return;
 }
 
 //-----------------------------------------------------------------------------
@@ -1826,6 +1921,8 @@ void Database::put_class_property(string device_class, DbData &db_data)
 	}
 	send <<= property_values;
 
+	invalidate_prop_cache('c',device_class);
+
 	if (filedb != 0)
 	{
 		CORBA::Any_var the_any;
@@ -1857,6 +1954,8 @@ void Database::delete_class_property(string device_class, DbData &db_data)
 	}
 	send <<= property_names;
 
+	invalidate_prop_cache('c',device_class);
+
 	if (filedb != 0)
 		filedb->DbDeleteClassProperty(send);
 	else
@@ -1877,6 +1976,7 @@ void Database::get_class_attribute_property(string device_class, DbData &db_data
 	unsigned int i;
 	Any_var received;
 	const DevVarStringArray *property_values = NULL;
+	DevVarStringArray cache_values;
 
 	check_access_and_get();
 
@@ -1933,7 +2033,9 @@ void Database::get_class_attribute_property(string device_class, DbData &db_data
 
 		try
 		{
-			property_values = db_cache->get_class_att_property(property_names);
+			omni_mutex_lock guard(ext->db_cache_mutex);
+			cache_values = *(db_cache->get_class_att_property(property_names));
+			property_values = &cache_values;
 			delete property_names;
 		}
 		catch (Tango::DevFailed &e)
@@ -2219,6 +2321,7 @@ DbDatum Database::get_device_name(string &device_server, string &device_class, D
 {
 	Any_var received;
 	const DevVarStringArray *device_names = NULL;
+	DevVarStringArray cache_names;
 
 	check_access_and_get();
 
@@ -2242,7 +2345,9 @@ DbDatum Database::get_device_name(string &device_server, string &device_class, D
 	}
 	else
 	{
-		device_names = db_cache->get_dev_list(device_server_class);
+		omni_mutex_lock guard(ext->db_cache_mutex);
+		cache_names = *(db_cache->get_dev_list(device_server_class));
+		device_names = &cache_names;
 		delete device_server_class;
 	}
 
@@ -2472,6 +2577,7 @@ void Database::get_property(string obj, DbData &db_data,DbServerCache *db_cache)
 	unsigned int i;
 	Any_var received;
 	const DevVarStringArray *property_values = NULL;
+	DevVarStringArray cache_values;
 
 	{
 		WriterLock guard(Connection::ext->con_to_mon);
@@ -2511,7 +2617,9 @@ void Database::get_property(string obj, DbData &db_data,DbServerCache *db_cache)
 
 		try
 		{
-			property_values = db_cache->get_obj_property(property_names);
+			omni_mutex_lock guard(ext->db_cache_mutex);
+			cache_values = *(db_cache->get_obj_property(property_names));
+			property_values = &cache_values;
 			delete property_names;
 		}
 		catch(Tango::DevFailed &e)
@@ -2916,6 +3024,7 @@ void Database::get_device_property_list(string &dev, const string &wildcard, vec
 
 		try
 		{
+			omni_mutex_lock guard(ext->db_cache_mutex);
 			const DevVarStringArray *recev;
 			recev = db_cache->get_device_property_list(&send_seq);
 			prop_list << *recev;
@@ -4143,7 +4252,10 @@ void Database::delete_all_device_attribute_property(string dev_name,DbData &db_d
 				       		(const char *)"Database::delete_all_device_attribute_property");
 	}
 	else
+	{
+		invalidate_prop_cache('a',dev_name);
 		CALL_DB_SERVER_NO_RET("DbDeleteAllDeviceAttributeProperty",send);
+	}
 }
 
 
@@ -4360,4 +4472,452 @@ void Database::write_event_channel_ior_filedatabase(string &ec_ior)
 	filedb->write_event_channel_ior(ec_ior);
 }
 
+//-----------------------------------------------------------------------------
+//
+// method :			prop_cache_date() -
+//
+// description : 	Return the current date in mS (used by the property cache)
+//
+//-----------------------------------------------------------------------------
+
+static double prop_cache_date()
+{
+#ifdef _TG_WINDOWS_
+	struct _timeb t;
+	_ftime(&t);
+
+	return (double)t.time * 1000.0 + (double)t.millitm;
+#else
+	struct timeval tv;
+	gettimeofday(&tv,NULL);
+
+	return (double)tv.tv_sec * 1000.0 + (double)tv.tv_usec / 1000.0;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :			Database::set_property_cache_ttl() -
+//
+// description : 	Enable/disable the client property cache. When enabled,
+//					property(ies) returned by the get_device_property(),
+//					get_device_attribute_property() and get_class_property()
+//					methods are kept for ttl mS and returned without any
+//					call to the db server. Property(ies) changed or deleted
+//					through this object are removed from the cache.
+//
+// argument : in :	ttl : The cache entries validity (in mS). 0 disables
+//						  the cache
+//
+//-----------------------------------------------------------------------------
+
+void Database::set_property_cache_ttl(long ttl)
+{
+	if (ttl < 0)
+	{
+		Tango::Except::throw_exception((const char *)"API_MethodArgument",
+				       		(const char *)"The property cache time to live can not be negative",
+				       		(const char *)"Database::set_property_cache_ttl");
+	}
+
+	omni_mutex_lock guard(ext->prop_cache_mutex);
+
+	ext->prop_cache_ttl = ttl;
+	if (ttl == 0)
+		ext->prop_cache.clear();
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :			Database::clear_property_cache() -
+//
+// description : 	Remove all entries from the client property cache
+//
+//-----------------------------------------------------------------------------
+
+void Database::clear_property_cache()
+{
+	omni_mutex_lock guard(ext->prop_cache_mutex);
+	ext->prop_cache.clear();
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :			Database::get_property_cache_hits() -
+//
+// description : 	Return the number of property requests answered by the
+//					client property cache
+//
+//-----------------------------------------------------------------------------
+
+unsigned long Database::get_property_cache_hits()
+{
+	omni_mutex_lock guard(ext->prop_cache_mutex);
+	return ext->prop_cache_hits;
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :			Database::get_property_cache_misses() -
+//
+// description : 	Return the number of property requests which had to be
+//					sent to the db server while the property cache is enabled
+//
+//-----------------------------------------------------------------------------
+
+unsigned long Database::get_property_cache_misses()
+{
+	omni_mutex_lock guard(ext->prop_cache_mutex);
+	return ext->prop_cache_misses;
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :			Database::get_prop_from_cache() -
+//
+// description : 	Try to get property(ies) from the client property cache.
+//					The request is answered from the cache only if all the
+//					wanted property(ies) are in the cache and are not too old
+//
+// argument : in :	type : The property type ('d' for device, 'a' for device
+//						   attribute and 'c' for class)
+//					obj_name : The device or class name
+//			  out :	db_data : The property(ies)
+//
+// This method returns true if the data has been found in cache
+//
+//-----------------------------------------------------------------------------
+
+bool Database::get_prop_from_cache(char type,string &obj_name,DbData &db_data)
+{
+	if (filedb != 0)
+		return false;
+
+	omni_mutex_lock guard(ext->prop_cache_mutex);
+
+	if (ext->prop_cache_ttl == 0)
+		return false;
+
+	string prefix(1,type);
+	prefix = prefix + obj_name + '/';
+	transform(prefix.begin(),prefix.end(),prefix.begin(),::tolower);
+
+	double limit = prop_cache_date() - ext->prop_cache_ttl;
+
+	vector<map<string,DatabaseExt::PropCacheEntry>::iterator> entries;
+	for (unsigned int i = 0;i < db_data.size();i++)
+	{
+		string key(db_data[i].name);
+		transform(key.begin(),key.end(),key.begin(),::tolower);
+		key = prefix + key;
+
+		map<string,DatabaseExt::PropCacheEntry>::iterator pos = ext->prop_cache.find(key);
+		if (pos == ext->prop_cache.end())
+		{
+			ext->prop_cache_misses++;
+			return false;
+		}
+		if (pos->second.date < limit)
+		{
+			ext->prop_cache.erase(pos);
+			ext->prop_cache_misses++;
+			return false;
+		}
+		entries.push_back(pos);
+	}
+
+//
+// Everything is in cache. For device attribute, the cache entry is the
+// attribute property number followed by name, value number and value(s)
+// for each property
+//
+
+	if (type != 'a')
+	{
+		for (unsigned int i = 0;i < db_data.size();i++)
+			db_data[i].value_string = entries[i]->second.values;
+	}
+	else
+	{
+		DbData res;
+		for (unsigned int i = 0;i < db_data.size();i++)
+		{
+			vector<string> &vals = entries[i]->second.values;
+
+			DbDatum att(db_data[i].name);
+			short n_props = (short)::atoi(vals[0].c_str());
+			att << n_props;
+			res.push_back(att);
+
+			unsigned int ind = 1;
+			for (short j = 0;j < n_props;j++)
+			{
+				DbDatum prop(vals[ind]);
+				int n_values = ::atoi(vals[ind + 1].c_str());
+				ind = ind + 2;
+				prop.value_string.assign(vals.begin() + ind,vals.begin() + ind + n_values);
+				ind = ind + n_values;
+				res.push_back(prop);
+			}
+		}
+		db_data.swap(res);
+	}
+
+	ext->prop_cache_hits++;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :			Database::store_prop_in_cache() -
+//
+// description : 	Store property(ies) received from the db server in the
+//					client property cache (if enabled)
+//
+// argument : in :	type : The property type ('d' for device, 'a' for device
+//						   attribute and 'c' for class)
+//					obj_name : The device or class name
+//					db_data : The property(ies)
+//
+//-----------------------------------------------------------------------------
+
+void Database::store_prop_in_cache(char type,string &obj_name,DbData &db_data)
+{
+	if (filedb != 0)
+		return;
+
+	if ((type == 'a') && (serv_version < 230))
+		return;
+
+	omni_mutex_lock guard(ext->prop_cache_mutex);
+
+	if (ext->prop_cache_ttl == 0)
+		return;
+
+	double now = prop_cache_date();
+
+//
+// Remove old entries if the cache becomes large
+//
+
+	if (ext->prop_cache.size() > DB_PROP_CACHE_PURGE)
+	{
+		double limit = now - ext->prop_cache_ttl;
+		map<string,DatabaseExt::PropCacheEntry>::iterator pos = ext->prop_cache.begin();
+		while (pos != ext->prop_cache.end())
+		{
+			if (pos->second.date < limit)
+				ext->prop_cache.erase(pos++);
+			else
+				++pos;
+		}
+	}
+
+	string prefix(1,type);
+	prefix = prefix + obj_name + '/';
+	transform(prefix.begin(),prefix.end(),prefix.begin(),::tolower);
+
+	unsigned int i = 0;
+	while (i < db_data.size())
+	{
+		string key(db_data[i].name);
+		transform(key.begin(),key.end(),key.begin(),::tolower);
+		key = prefix + key;
+
+		DatabaseExt::PropCacheEntry &entry = ext->prop_cache[key];
+		entry.date = now;
+
+		if (type != 'a')
+		{
+			entry.values = db_data[i].value_string;
+			i++;
+		}
+		else
+		{
+			short n_props = 0;
+			db_data[i] >> n_props;
+			entry.values.clear();
+			entry.values.push_back(db_data[i].value_string[0]);
+			i++;
+
+			for (short j = 0;(j < n_props) && (i < db_data.size());j++,i++)
+			{
+				stringstream ss;
+				ss << db_data[i].value_string.size();
+
+				entry.values.push_back(db_data[i].name);
+				entry.values.push_back(ss.str());
+				entry.values.insert(entry.values.end(),db_data[i].value_string.begin(),db_data[i].value_string.end());
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :			Database::invalidate_prop_cache() -
+//
+// description : 	Remove all the property(ies) of one object from the
+//					client property cache
+//
+// argument : in :	type : The property type ('d' for device, 'a' for device
+//						   attribute and 'c' for class)
+//					obj_name : The device or class name
+//
+//-----------------------------------------------------------------------------
+
+void Database::invalidate_prop_cache(char type,string &obj_name)
+{
+	omni_mutex_lock guard(ext->prop_cache_mutex);
+
+	if (ext->prop_cache.empty() == true)
+		return;
+
+	string prefix(1,type);
+	prefix = prefix + obj_name + '/';
+	transform(prefix.begin(),prefix.end(),prefix.begin(),::tolower);
+
+	map<string,DatabaseExt::PropCacheEntry>::iterator pos = ext->prop_cache.lower_bound(prefix);
+	while ((pos != ext->prop_cache.end()) && (pos->first.compare(0,prefix.size(),prefix) == 0))
+		ext->prop_cache.erase(pos++);
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :			Database::get_property_multi() -
+//
+// description : 	Get property(ies) for several devices or classes.
+//					Property(ies) not found in the client property cache are
+//					requested from the db server using asynchronous calls.
+//					All the requests are sent before waiting for the first
+//					reply, so that the whole batch costs about one round trip.
+//					A request which failed is retried using the classical
+//					synchronous call. If this call also fails, the requests
+//					still waiting for their replies are cancelled and the
+//					error is re-thrown.
+//
+// argument : in :	type : The property type ('d' for device, 'a' for device
+//						   attribute and 'c' for class)
+//					obj_names : The device or class names
+//			  in/out : db_datas : One DbData per object
+//
+//-----------------------------------------------------------------------------
+
+void Database::get_property_multi(char type,vector<string> &obj_names,vector<DbData> &db_datas)
+{
+	if (obj_names.size() != db_datas.size())
+	{
+		Tango::Except::throw_exception((const char *)"API_MethodArgument",
+				       		(const char *)"The object names and property data vectors do not have the same size",
+				       		(const char *)"Database::get_property_multi");
+	}
+
+	unsigned int nb_obj = obj_names.size();
+	vector<long> ids(nb_obj,-1);
+	vector<bool> done(nb_obj,false);
+
+	string cmd_name;
+	if (type == 'd')
+		cmd_name = "DbGetDeviceProperty";
+	else if (type == 'c')
+		cmd_name = "DbGetClassProperty";
+	else if (serv_version >= 230)
+		cmd_name = "DbGetDeviceAttributeProperty2";
+	else
+		cmd_name = "DbGetDeviceAttributeProperty";
+
+//
+// Send requests
+//
+
+	if ((filedb == 0) && (nb_obj > 1))
+	{
+		check_access_and_get();
+
+		for (unsigned int i = 0;i < nb_obj;i++)
+		{
+			if (get_prop_from_cache(type,obj_names[i],db_datas[i]) == true)
+			{
+				done[i] = true;
+				continue;
+			}
+
+			vector<string> names;
+			names.push_back(obj_names[i]);
+			for (unsigned int j = 0;j < db_datas[i].size();j++)
+				names.push_back(db_datas[i][j].name);
+
+			DeviceData din;
+			din << names;
+
+			try
+			{
+				ids[i] = command_inout_asynch(cmd_name,din);
+			}
+			catch (Tango::DevFailed &) {}
+		}
+	}
+
+//
+// Get replies
+//
+
+	for (unsigned int i = 0;i < nb_obj;i++)
+	{
+		if (done[i] == true)
+			continue;
+
+		if (ids[i] != -1)
+		{
+			try
+			{
+				DeviceData dout = command_inout_reply(ids[i],0);
+				const DevVarStringArray *property_values;
+				if ((dout >> property_values) == true)
+				{
+					if (type == 'd')
+						decode_dev_property(property_values,db_datas[i]);
+					else if (type == 'c')
+						decode_class_property(property_values,db_datas[i]);
+					else
+						decode_dev_att_property(property_values,db_datas[i]);
+
+					store_prop_in_cache(type,obj_names[i],db_datas[i]);
+					done[i] = true;
+				}
+			}
+			catch (Tango::DevFailed &) {}
+			ids[i] = -1;
+		}
+
+		if (done[i] == false)
+		{
+			try
+			{
+				if (type == 'd')
+					get_device_property(obj_names[i],db_datas[i],NULL);
+				else if (type == 'c')
+					get_class_property(obj_names[i],db_datas[i],NULL);
+				else
+					get_device_attribute_property(obj_names[i],db_datas[i],NULL);
+			}
+			catch (Tango::DevFailed &)
+			{
+
+//
+// Cancel the requests still waiting for their replies. Otherwise, they would stay
+// in the asynchronous request table
+//
+
+				for (unsigned int j = i + 1;j < nb_obj;j++)
+				{
+					if (ids[j] != -1)
+						cancel_asynch_request(ids[j]);
+				}
+				throw;
+			}
+		}
+	}
+}
+
 } // End of Tango namespace
@@ -229,6 +229,40 @@ DbServerCache::DbServerCache(Database *db,string &ds_name,string &host)
         imp_tac.last_idx = stop_idx;
     }
 
+//
+// Build class and device name indexes
+//
+
+	build_name_maps();
+}
+
+//-----------------------------------------------------------------------------
+//
+//  DbServerCache::build_name_maps()
+//
+//	This method builds the maps used to find a class or a device within the
+//	data returned by the DB server without scanning them.
+//	Names are case independent and stored in lower case.
+//	The first class (device) with a given name is the one which is found,
+//	like it was with a linear search
+//
+//-----------------------------------------------------------------------------
+
+void DbServerCache::build_name_maps()
+{
+	for (int loop = 0;loop < class_nb;loop++)
+	{
+		string cl_name((*data_list)[classes_idx[loop].class_prop.first_idx]);
+		transform(cl_name.begin(),cl_name.end(),cl_name.begin(),::tolower);
+		class_map.insert(make_pair(cl_name,loop));
+
+		for (int ll = 0;ll < classes_idx[loop].dev_nb;ll++)
+		{
+			string d_name((*data_list)[classes_idx[loop].dev_list.first_idx + 2 + ll]);
+			transform(d_name.begin(),d_name.end(),d_name.begin(),::tolower);
+			dev_map.insert(make_pair(d_name,make_pair(loop,ll)));
+		}
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -409,33 +443,32 @@ void DbServerCache::get_obj_prop(DevVarStringArray *in_param,PropEltIdx &obj,boo
 	char n_prop_str[256];
 
 	int nb_wanted_prop = in_param->length() - 1;
-	int obj_prop = obj.prop_nb;
 
 	for (int loop = 0;loop < nb_wanted_prop;loop++)
 	{
-		int lo;
-		for (lo = 0;lo < obj_prop * 2;lo = lo + 2)
+		string p_name((*in_param)[loop + 1]);
+		transform(p_name.begin(),p_name.end(),p_name.begin(),::tolower);
+
+		map<pair<int,string>,int>::iterator pos = prop_map.find(make_pair(obj.first_idx,p_name));
+		if (pos != prop_map.end())
 		{
-			if (TG_strcasecmp((*in_param)[loop + 1],(*data_list)[obj.props_idx[lo]]) == 0)
-			{
-				int old_ret_length = ret_length;
-				int nb_elt = obj.props_idx[lo + 1];
+			int lo = pos->second;
+			int old_ret_length = ret_length;
+			int nb_elt = obj.props_idx[lo + 1];
 
-				ret_length = ret_length + 2 + nb_elt;
+			ret_length = ret_length + 2 + nb_elt;
 
-				ret_obj_prop.length(ret_length);
-				ret_obj_prop[old_ret_length] = CORBA::string_dup((*in_param)[loop + 1]);
-				ret_obj_prop[old_ret_length + 1] = CORBA::string_dup((*data_list)[obj.props_idx[lo] + 1]);
+			ret_obj_prop.length(ret_length);
+			ret_obj_prop[old_ret_length] = CORBA::string_dup((*in_param)[loop + 1]);
+			ret_obj_prop[old_ret_length + 1] = CORBA::string_dup((*data_list)[obj.props_idx[lo] + 1]);
 
-				for (int k = 0;k < nb_elt;k++)
-				{
-					ret_obj_prop[old_ret_length + 2 + k] = CORBA::string_dup((*data_list)[obj.props_idx[lo] + 2 + k]);
-				}
-				found_prop++;
-				break;
+			for (int k = 0;k < nb_elt;k++)
+			{
+				ret_obj_prop[old_ret_length + 2 + k] = CORBA::string_dup((*data_list)[obj.props_idx[lo] + 2 + k]);
 			}
+			found_prop++;
 		}
-		if (lo >= (obj_prop * 2))
+		else
 		{
 			int old_length = ret_length;
 			ret_length = ret_length + 2;
@@ -569,11 +602,38 @@ const DevVarStringArray *DbServerCache::get_dev_list(DevVarStringArray *in_param
 
 int DbServerCache::find_class(DevString cl_name)
 {
-	for (int loop = 0;loop < class_nb;loop++)
-	{
-		if (TG_strcasecmp((*data_list)[classes_idx[loop].class_prop.first_idx],cl_name) == 0)
-			return loop;
-	}
+	string name(cl_name);
+	transform(name.begin(),name.end(),name.begin(),::tolower);
+
+	map<string,int>::iterator pos = class_map.find(name);
+	if (pos != class_map.end())
+		return pos->second;
+
+	return -1;
+}
+
+//-----------------------------------------------------------------------------
+//
+//  DbServerCache::find_att()
+//
+//	This method returns the index within the data returned by the DB server
+//	of an attribute (for device or class attribute properties)
+//
+// 	in :	obj_first_idx : The first index of the attribute properties object
+//			att_name : The attribute name
+//
+//	This method returns the attribute index or -1 if it is not found
+//-----------------------------------------------------------------------------
+
+int DbServerCache::find_att(int obj_first_idx,DevString att_name)
+{
+	string name(att_name);
+	transform(name.begin(),name.end(),name.begin(),::tolower);
+
+	map<pair<int,string>,int>::iterator pos = att_map.find(make_pair(obj_first_idx,name));
+	if (pos != att_map.end())
+		return pos->second;
+
 	return -1;
 }
 
@@ -611,41 +671,35 @@ const DevVarStringArray *DbServerCache::get_class_att_property(DevVarStringArray
 //
 
 		int wanted_att_nb = in_param->length() - 1;
-		int class_att_nb = classes_idx[cl_idx].class_att_prop.att_nb;
 		for (int loop = 0;loop < wanted_att_nb;loop++)
 		{
-			int ll;
-			for (ll = 0;ll < class_att_nb;ll++)
+			int att_index = find_att(classes_idx[cl_idx].class_att_prop.first_idx,(*in_param)[loop + 1]);
+			if (att_index != -1)
 			{
-				if (TG_strcasecmp((*in_param)[loop + 1],(*data_list)[classes_idx[cl_idx].class_att_prop.atts_idx[ll]]) == 0)
-				{
 
 //
 // The attribute is found, copy all its properties
 //
 
-					int att_index = classes_idx[cl_idx].class_att_prop.atts_idx[ll];
-					int nb_prop = ::atoi((*data_list)[att_index + 1]);
-					int nb_elt = 0;
-					int nb_to_copy = 0;
-					int tmp_idx = att_index + 2;
-					nb_to_copy = 2;
-					for (int k = 0;k < nb_prop;k++)
-					{
-						nb_elt = ::atoi((*data_list)[tmp_idx + 1]);
-						tmp_idx = tmp_idx + nb_elt + 2;
-						nb_to_copy = nb_to_copy + 2 + nb_elt;
-					}
-
-					int old_length = ret_obj_att_prop.length();
-					ret_obj_att_prop.length(old_length + nb_to_copy);
-					for (int j = 0;j < nb_to_copy;j++)
-						ret_obj_att_prop[old_length + j] = CORBA::string_dup((*data_list)[att_index + j]);
-					found_att++;
-					break;
+				int nb_prop = ::atoi((*data_list)[att_index + 1]);
+				int nb_elt = 0;
+				int nb_to_copy = 0;
+				int tmp_idx = att_index + 2;
+				nb_to_copy = 2;
+				for (int k = 0;k < nb_prop;k++)
+				{
+					nb_elt = ::atoi((*data_list)[tmp_idx + 1]);
+					tmp_idx = tmp_idx + nb_elt + 2;
+					nb_to_copy = nb_to_copy + 2 + nb_elt;
 				}
+
+				int old_length = ret_obj_att_prop.length();
+				ret_obj_att_prop.length(old_length + nb_to_copy);
+				for (int j = 0;j < nb_to_copy;j++)
+					ret_obj_att_prop[old_length + j] = CORBA::string_dup((*data_list)[att_index + j]);
+				found_att++;
 			}
-			if (ll == class_att_nb)
+			else
 			{
 				found_att++;
 				int old_length = ret_obj_att_prop.length();
@@ -704,36 +758,30 @@ const DevVarStringArray *DbServerCache::get_dev_att_property(DevVarStringArray *
 	if (ret_value != -1)
 	{
 		int wanted_att_nb = in_param->length() - 1;
-		int dev_att_nb = classes_idx[class_ind].devs_idx[dev_ind].dev_att_prop.att_nb;
 		for (int loop = 0;loop < wanted_att_nb;loop++)
 		{
-			int ll;
-			for (ll = 0;ll < dev_att_nb;ll++)
+			int att_index = find_att(classes_idx[class_ind].devs_idx[dev_ind].dev_att_prop.first_idx,(*in_param)[loop + 1]);
+			if (att_index != -1)
 			{
-				if (TG_strcasecmp((*in_param)[loop + 1],(*data_list)[classes_idx[class_ind].devs_idx[dev_ind].dev_att_prop.atts_idx[ll]]) == 0)
+				int nb_prop = ::atoi((*data_list)[att_index + 1]);
+				int nb_elt = 0;
+				int nb_to_copy = 0;
+				int tmp_idx = att_index + 2;
+				nb_to_copy = 2;
+				for (int k = 0;k < nb_prop;k++)
 				{
-					int att_index = classes_idx[class_ind].devs_idx[dev_ind].dev_att_prop.atts_idx[ll];
-					int nb_prop = ::atoi((*data_list)[att_index + 1]);
-					int nb_elt = 0;
-					int nb_to_copy = 0;
-					int tmp_idx = att_index + 2;
-					nb_to_copy = 2;
-					for (int k = 0;k < nb_prop;k++)
-					{
-						nb_elt = ::atoi((*data_list)[tmp_idx + 1]);
-						tmp_idx = tmp_idx + nb_elt + 2;
-						nb_to_copy = nb_to_copy + 2 + nb_elt;
-					}
-
-					int old_length = ret_obj_att_prop.length();
-					ret_obj_att_prop.length(old_length + nb_to_copy);
-					for (int j = 0;j < nb_to_copy;j++)
-						ret_obj_att_prop[old_length + j] = CORBA::string_dup((*data_list)[att_index + j]);
-					found_att++;
-					break;
+					nb_elt = ::atoi((*data_list)[tmp_idx + 1]);
+					tmp_idx = tmp_idx + nb_elt + 2;
+					nb_to_copy = nb_to_copy + 2 + nb_elt;
 				}
+
+				int old_length = ret_obj_att_prop.length();
+				ret_obj_att_prop.length(old_length + nb_to_copy);
+				for (int j = 0;j < nb_to_copy;j++)
+					ret_obj_att_prop[old_length + j] = CORBA::string_dup((*data_list)[att_index + j]);
+				found_att++;
 			}
-			if (ll == dev_att_nb)
+			else
 			{
 				found_att++;
 				int old_length = ret_obj_att_prop.length();
@@ -779,17 +827,15 @@ const DevVarStringArray *DbServerCache::get_dev_att_property(DevVarStringArray *
 
 int DbServerCache::find_dev_att(DevString dev_name,int &class_ind,int &dev_ind)
 {
-	for (int loop = 0;loop < class_nb;loop++)
+	string name(dev_name);
+	transform(name.begin(),name.end(),name.begin(),::tolower);
+
+	map<string,pair<int,int> >::iterator pos = dev_map.find(name);
+	if (pos != dev_map.end())
 	{
-		for (int ll = 0;ll < classes_idx[loop].dev_nb;ll++)
-		{
-			if (TG_strcasecmp((*data_list)[classes_idx[loop].dev_list.first_idx + 2 + ll],dev_name) == 0)
-			{
-				class_ind = loop;
-				dev_ind = ll;
-				return 0;
-			}
-		}
+		class_ind = pos->second.first;
+		dev_ind = pos->second.second;
+		return 0;
 	}
 	return -1;
 }
@@ -890,6 +936,10 @@ void DbServerCache::prop_indexes(int &start,int &stop,PropEltIdx &obj,const DevV
 	obj.props_idx = new int[nb_prop * 2];
 	for (int loop = 0;loop < nb_prop;loop++)
 	{
+		string p_name((*list)[stop + 1]);
+		transform(p_name.begin(),p_name.end(),p_name.begin(),::tolower);
+		prop_map.insert(make_pair(make_pair(start,p_name),id));
+
 		obj.props_idx[id++] = stop + 1;
 		int nb_elt = atoi((*list)[stop + 2]);
 		obj.props_idx[id++] = nb_elt;
@@ -938,6 +988,10 @@ void DbServerCache::prop_att_indexes(int &start,int &stop,AttPropEltIdx &obj,con
 
 	for (int ll = 0;ll < nb_att;ll++)
 	{
+		string a_name((*list)[stop]);
+		transform(a_name.begin(),a_name.end(),a_name.begin(),::tolower);
+		att_map.insert(make_pair(make_pair(start,a_name),stop));
+
 		obj.atts_idx[id++] = stop;
 		int nb_prop = atoi((*list)[stop + 1]);
 		stop = stop + 2;
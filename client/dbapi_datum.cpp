@@ -33,8 +33,6 @@ static const char *RcsId = "$Id$\n$Name$";
 
 #include <tango.h>
 
-#include <iomanip>
-
 using namespace CORBA;
 
 namespace Tango
@@ -219,11 +217,11 @@ bool DbDatum::operator >> (bool &datum)
 
 void DbDatum::operator << (short datum)
 {
-	ostringstream ostream;
-	ostream << datum;
+	char buf[TANGO_NUM_BUF_SIZE];
+	num_to_str(buf,datum);
 
 	value_string.resize(1);
-	value_string[0] = string(ostream.str());
+	value_string[0] = buf;
 
 	value_type = DEV_SHORT;
 	value_size = 1;
@@ -251,10 +249,7 @@ bool DbDatum::operator >> (short &datum)
 	}
 	else
 	{
-		istringstream istream(value_string[0]);
-
-		istream >> datum;
-		if (!istream)
+		if (str_to_num(value_string[0].c_str(),datum) == NULL)
 		{
 			if (exceptions_flags.test(wrongtype_flag))
 			{
@@ -279,11 +274,11 @@ bool DbDatum::operator >> (short &datum)
 
 void DbDatum::operator << (unsigned char datum)
 {
-	ostringstream ostream;
-	ostream << (short)datum; // to accept only numbers
+	char buf[TANGO_NUM_BUF_SIZE];
+	num_to_str(buf,(short)datum); // to accept only numbers
 
 	value_string.resize(1);
-	value_string[0] = string(ostream.str());
+	value_string[0] = buf;
 
 	value_type = DEV_UCHAR;
 	value_size = 1;
@@ -337,11 +332,11 @@ bool DbDatum::operator >> (unsigned char& datum)
 
 void DbDatum::operator << (unsigned short datum)
 {
-	ostringstream ostream;
-	ostream << datum;
+	char buf[TANGO_NUM_BUF_SIZE];
+	num_to_str(buf,datum);
 
 	value_string.resize(1);
-	value_string[0] = string(ostream.str());
+	value_string[0] = buf;
 
 	value_type = DEV_USHORT;
 	value_size = 1;
@@ -368,9 +363,7 @@ bool DbDatum::operator >> (unsigned short& datum)
 	}
 	else
 	{
-		istringstream istream(value_string[0]);
-		istream >> datum;
-		if (!istream)
+		if (str_to_num(value_string[0].c_str(),datum) == NULL)
 		{
 			if (exceptions_flags.test(wrongtype_flag))
 			{
@@ -395,11 +388,11 @@ bool DbDatum::operator >> (unsigned short& datum)
 
 void DbDatum::operator << (DevLong datum)
 {
-	ostringstream ostream;
-	ostream << datum;
+	char buf[TANGO_NUM_BUF_SIZE];
+	num_to_str(buf,datum);
 
 	value_string.resize(1);
-	value_string[0] = string(ostream.str());
+	value_string[0] = buf;
 
 	value_type = DEV_LONG;
 	value_size = 1;
@@ -426,9 +419,7 @@ bool DbDatum::operator >> (DevLong& datum)
 	}
 	else
 	{
-		istringstream istream(value_string[0]);
-		istream >> datum;
-		if (!istream)
+		if (str_to_num(value_string[0].c_str(),datum) == NULL)
 		{
 			if (exceptions_flags.test(wrongtype_flag))
 			{
@@ -453,11 +444,11 @@ bool DbDatum::operator >> (DevLong& datum)
 
 void DbDatum::operator << (DevULong datum)
 {
-	ostringstream ostream;
-	ostream << datum;
+	char buf[TANGO_NUM_BUF_SIZE];
+	num_to_str(buf,datum);
 
 	value_string.resize(1);
-	value_string[0] = string(ostream.str());
+	value_string[0] = buf;
 
 	value_type = DEV_ULONG;
 	value_size = 1;
@@ -484,9 +475,7 @@ bool DbDatum::operator >> (DevULong& datum)
 	}
 	else
 	{
-		istringstream istream(value_string[0]);
-		istream >> datum;
-		if (!istream)
+		if (str_to_num(value_string[0].c_str(),datum) == NULL)
 		{
 			if (exceptions_flags.test(wrongtype_flag))
 			{
@@ -511,11 +500,11 @@ bool DbDatum::operator >> (DevULong& datum)
 
 void DbDatum::operator << (DevLong64 datum)
 {
-	ostringstream ostream;
-	ostream << datum;
+	char buf[TANGO_NUM_BUF_SIZE];
+	num_to_str(buf,datum);
 
 	value_string.resize(1);
-	value_string[0] = string(ostream.str());
+	value_string[0] = buf;
 
 	value_type = DEV_LONG64;
 	value_size = 1;
@@ -542,9 +531,7 @@ bool DbDatum::operator >> (DevLong64 &datum)
 	}
 	else
 	{
-		istringstream istream(value_string[0]);
-		istream >> datum;
-		if (!istream)
+		if (str_to_num(value_string[0].c_str(),datum) == NULL)
 		{
 			if (exceptions_flags.test(wrongtype_flag))
 			{
@@ -569,11 +556,11 @@ bool DbDatum::operator >> (DevLong64 &datum)
 
 void DbDatum::operator << (DevULong64 datum)
 {
-	ostringstream ostream;
-	ostream << datum;
+	char buf[TANGO_NUM_BUF_SIZE];
+	num_to_str(buf,datum);
 
 	value_string.resize(1);
-	value_string[0] = string(ostream.str());
+	value_string[0] = buf;
 
 	value_type = DEV_ULONG64;
 	value_size = 1;
@@ -600,9 +587,7 @@ bool DbDatum::operator >> (DevULong64 &datum)
 	}
 	else
 	{
-		istringstream istream(value_string[0]);
-		istream >> datum;
-		if (!istream)
+		if (str_to_num(value_string[0].c_str(),datum) == NULL)
 		{
 			if (exceptions_flags.test(wrongtype_flag))
 			{
@@ -627,11 +612,11 @@ bool DbDatum::operator >> (DevULong64 &datum)
 
 void DbDatum::operator << (float datum)
 {
-	ostringstream ostream;
-	ostream << std::setprecision(TANGO_FLOAT_PRECISION) << datum;
+	char buf[TANGO_NUM_BUF_SIZE];
+	num_to_str(buf,datum);
 
 	value_string.resize(1);
-	value_string[0] = string(ostream.str());
+	value_string[0] = buf;
 
 	value_type = DEV_FLOAT;
 	value_size = 1;
@@ -658,9 +643,7 @@ bool DbDatum::operator >> (float& datum)
 	}
 	else
 	{
-		istringstream istream(value_string[0]);
-		istream >> datum;
-		if (!istream)
+		if (str_to_num(value_string[0].c_str(),datum) == NULL)
 		{
 			if (exceptions_flags.test(wrongtype_flag))
 			{
@@ -685,11 +668,11 @@ bool DbDatum::operator >> (float& datum)
 
 void DbDatum::operator << (double datum)
 {
-	ostringstream ostream;
-	ostream << setprecision(TANGO_FLOAT_PRECISION) << datum;
+	char buf[TANGO_NUM_BUF_SIZE];
+	num_to_str(buf,datum);
 
 	value_string.resize(1);
-	value_string[0] = string(ostream.str());
+	value_string[0] = buf;
 
 	value_type = DEV_DOUBLE;
 	value_size = 1;
@@ -716,9 +699,7 @@ bool DbDatum::operator >> (double& datum)
 	}
 	else
 	{
-		istringstream istream(value_string[0]);
-		istream >> std::setprecision(TANGO_FLOAT_PRECISION) >> datum;
-		if (!istream)
+		if (str_to_num(value_string[0].c_str(),datum) == NULL)
 		{
 			if (exceptions_flags.test(wrongtype_flag))
 			{
@@ -858,14 +839,12 @@ bool DbDatum::operator >> (const char*& datum)
 
 void DbDatum::operator << (vector<short>& datum)
 {
-	ostringstream ostream;
+	char buf[TANGO_NUM_BUF_SIZE];
 	value_string.resize(datum.size());
 	for (unsigned int i=0; i<datum.size(); i++)
 	{
-		ostream << datum[i];
-		value_string[i] = ostream.str();
-
-		ostream.str("");
+		num_to_str(buf,datum[i]);
+		value_string[i] = buf;
 	}
 	value_type = DEVVAR_SHORTARRAY;
 	value_size = datum.size();
@@ -893,15 +872,10 @@ bool DbDatum::operator >> (vector<short>& datum)
 	}
 	else
 	{
-		stringstream iostream;
-
 		datum.resize(value_string.size());
 		for (unsigned int i=0; i<value_string.size(); i++)
 		{
-			iostream.seekp (0); iostream.seekg(0); iostream.clear();
-			iostream << value_string[i] << ends;
-			iostream >> datum[i];
-			if (!iostream)
+			if (str_to_num(value_string[i].c_str(),datum[i]) == NULL)
 			{
 				if (exceptions_flags.test(wrongtype_flag))
 				{
@@ -930,13 +904,12 @@ bool DbDatum::operator >> (vector<short>& datum)
 
 void DbDatum::operator << (vector<unsigned short>& datum)
 {
-	ostringstream ostream;
+	char buf[TANGO_NUM_BUF_SIZE];
 	value_string.resize(datum.size());
 	for (unsigned int i=0; i<datum.size(); i++)
 	{
-		ostream << datum[i];
-		value_string[i] = ostream.str();
-		ostream.str("");
+		num_to_str(buf,datum[i]);
+		value_string[i] = buf;
 	}
 	value_type = DEVVAR_USHORTARRAY;
 	value_size = datum.size();
@@ -964,15 +937,10 @@ bool DbDatum::operator >> (vector<unsigned short>& datum)
 	}
 	else
 	{
-		stringstream iostream;
-
 		datum.resize(value_string.size());
 		for (unsigned int i=0; i<value_string.size(); i++)
 		{
-			iostream.seekp (0); iostream.seekg(0); iostream.clear();
-			iostream << value_string[i] << ends;
-			iostream >> datum[i];
-			if (!iostream)
+			if (str_to_num(value_string[i].c_str(),datum[i]) == NULL)
 			{
 				if (exceptions_flags.test(wrongtype_flag))
 				{
@@ -1001,14 +969,13 @@ bool DbDatum::operator >> (vector<unsigned short>& datum)
 
 void DbDatum::operator << (vector<DevLong>& datum)
 {
-	ostringstream ostream;
+	char buf[TANGO_NUM_BUF_SIZE];
 
 	value_string.resize(datum.size());
 	for (unsigned int i=0; i<datum.size(); i++)
 	{
-		ostream << datum[i];
-		value_string[i] = ostream.str();
-		ostream.str("");
+		num_to_str(buf,datum[i]);
+		value_string[i] = buf;
 	}
 	value_type = DEVVAR_LONGARRAY;
 	value_size = datum.size();
@@ -1036,15 +1003,10 @@ bool DbDatum::operator >> (vector<DevLong>& datum)
 	}
 	else
 	{
-		stringstream iostream;
-
 		datum.resize(value_string.size());
 		for (unsigned int i=0; i<value_string.size(); i++)
 		{
-			iostream.seekp (0); iostream.seekg(0); iostream.clear();
-			iostream << value_string[i] << ends;
-			iostream >> datum[i];
-			if (!iostream)
+			if (str_to_num(value_string[i].c_str(),datum[i]) == NULL)
 			{
 				if (exceptions_flags.test(wrongtype_flag))
 				{
@@ -1073,14 +1035,13 @@ bool DbDatum::operator >> (vector<DevLong>& datum)
 
 void DbDatum::operator << (vector<DevULong>& datum)
 {
-	ostringstream ostream;
+	char buf[TANGO_NUM_BUF_SIZE];
 
 	value_string.resize(datum.size());
 	for (unsigned int i=0; i<datum.size(); i++)
 	{
-		ostream << datum[i];
-		value_string[i] = ostream.str();
-		ostream.str("");
+		num_to_str(buf,datum[i]);
+		value_string[i] = buf;
 	}
 	value_type = DEVVAR_ULONGARRAY;
 	value_size = datum.size();
@@ -1108,14 +1069,10 @@ bool DbDatum::operator >> (vector<DevULong>& datum)
 	}
 	else
 	{
-		stringstream iostream;
 		datum.resize(value_string.size());
 		for (unsigned int i=0; i<value_string.size(); i++)
 		{
-			iostream.seekp (0); iostream.seekg(0); iostream.clear();
-			iostream << value_string[i] << ends;
-			iostream >> datum[i];
-			if (!iostream)
+			if (str_to_num(value_string[i].c_str(),datum[i]) == NULL)
 			{
 				if (exceptions_flags.test(wrongtype_flag))
 				{
@@ -1144,14 +1101,13 @@ bool DbDatum::operator >> (vector<DevULong>& datum)
 
 void DbDatum::operator << (vector<DevLong64>& datum)
 {
-	ostringstream ostream;
+	char buf[TANGO_NUM_BUF_SIZE];
 
 	value_string.resize(datum.size());
 	for (unsigned int i=0; i<datum.size(); i++)
 	{
-		ostream << datum[i];
-		value_string[i] = ostream.str();
-		ostream.str("");
+		num_to_str(buf,datum[i]);
+		value_string[i] = buf;
 	}
 	value_type = DEVVAR_LONG64ARRAY;
 	value_size = datum.size();
@@ -1179,15 +1135,10 @@ bool DbDatum::operator >> (vector<DevLong64>& datum)
 	}
 	else
 	{
-		stringstream iostream;
-
 		datum.resize(value_string.size());
 		for (unsigned int i=0; i<value_string.size(); i++)
 		{
-			iostream.seekp (0); iostream.seekg(0); iostream.clear();
-			iostream << value_string[i] << ends;
-			iostream >> datum[i];
-			if (!iostream)
+			if (str_to_num(value_string[i].c_str(),datum[i]) == NULL)
 			{
 				if (exceptions_flags.test(wrongtype_flag))
 				{
@@ -1216,14 +1167,13 @@ bool DbDatum::operator >> (vector<DevLong64>& datum)
 
 void DbDatum::operator << (vector<DevULong64>& datum)
 {
-	ostringstream ostream;
+	char buf[TANGO_NUM_BUF_SIZE];
 
 	value_string.resize(datum.size());
 	for (unsigned int i=0; i<datum.size(); i++)
 	{
-		ostream << datum[i];
-		value_string[i] = ostream.str();
-		ostream.str("");
+		num_to_str(buf,datum[i]);
+		value_string[i] = buf;
 	}
 	value_type = DEVVAR_ULONG64ARRAY;
 	value_size = datum.size();
@@ -1251,15 +1201,10 @@ bool DbDatum::operator >> (vector<DevULong64>& datum)
 	}
 	else
 	{
-		stringstream iostream;
-
 		datum.resize(value_string.size());
 		for (unsigned int i=0; i<value_string.size(); i++)
 		{
-			iostream.seekp (0); iostream.seekg(0); iostream.clear();
-			iostream << value_string[i] << ends;
-			iostream >> datum[i];
-			if (!iostream)
+			if (str_to_num(value_string[i].c_str(),datum[i]) == NULL)
 			{
 				if (exceptions_flags.test(wrongtype_flag))
 				{
@@ -1288,14 +1233,13 @@ bool DbDatum::operator >> (vector<DevULong64>& datum)
 
 void DbDatum::operator << (vector<float>& datum)
 {
-	ostringstream ostream;
+	char buf[TANGO_NUM_BUF_SIZE];
 
 	value_string.resize(datum.size());
 	for (unsigned int i=0; i<datum.size(); i++)
 	{
-		ostream << std::setprecision(TANGO_FLOAT_PRECISION) << datum[i];
-		value_string[i] = ostream.str();
-		ostream.str("");
+		num_to_str(buf,datum[i]);
+		value_string[i] = buf;
 	}
 	value_type = DEVVAR_FLOATARRAY;
 	value_size = datum.size();
@@ -1323,15 +1267,10 @@ bool DbDatum::operator >> (vector<float>& datum)
 	}
 	else
 	{
-		stringstream iostream;
-
 		datum.resize(value_string.size());
 		for (unsigned int i=0; i<value_string.size(); i++)
 		{
-			iostream.seekp (0); iostream.seekg(0); iostream.clear();
-			iostream << value_string[i] << ends;
-			iostream >> datum[i];
-			if (!iostream)
+			if (str_to_num(value_string[i].c_str(),datum[i]) == NULL)
 			{
 				if (exceptions_flags.test(wrongtype_flag))
 				{
@@ -1360,14 +1299,13 @@ bool DbDatum::operator >> (vector<float>& datum)
 
 void DbDatum::operator << (vector<double>& datum)
 {
-	ostringstream ostream;
+	char buf[TANGO_NUM_BUF_SIZE];
 	value_string.resize(datum.size());
 
 	for (unsigned int i=0; i<datum.size(); i++)
 	{
-		ostream << std::setprecision(TANGO_FLOAT_PRECISION) << datum[i];
-		value_string[i] = ostream.str();
-		ostream.str("");
+		num_to_str(buf,datum[i]);
+		value_string[i] = buf;
 	}
 
 	value_type = DEVVAR_DOUBLEARRAY;
@@ -1396,15 +1334,10 @@ bool DbDatum::operator >> (vector<double>& datum)
 	}
 	else
 	{
-		stringstream iostream;
-
 		datum.resize(value_string.size());
 		for (unsigned int i=0; i<value_string.size(); i++)
 		{
-			iostream.seekp (0); iostream.seekg(0); iostream.clear();
-			iostream << value_string[i] << ends;
-			iostream >> std::setprecision(TANGO_FLOAT_PRECISION) >> datum[i];
-			if (!iostream)
+			if (str_to_num(value_string[i].c_str(),datum[i]) == NULL)
 			{
 				if (exceptions_flags.test(wrongtype_flag))
 				{
@@ -54,6 +54,7 @@ class DbAttribute;
 class DbDatum;
 class DbDevImportInfo;
 class Database;
+class DeviceProxy;
 class AsynReq;
 class NotifdEventConsumer;
 class ZmqEventConsumer;
@@ -320,6 +321,15 @@ public:
 	DevLong get_user_sub_hwm() {return ext->user_sub_hwm;}
 	void set_event_buffer_hwm(DevLong val) {if (ext->user_sub_hwm == -1)ext->user_sub_hwm=val;}
 
+//
+// Event callbacks executed by a pool of threads. A callback object is never
+// executed by two threads at the same time, even if it is used by several
+// subscriptions. Callbacks of different objects may run concurrently
+//
+
+	int get_event_dispatch_threads() {return ext->event_dispatch_threads;}
+	void set_event_dispatch_threads(int val) {if (ext->event_dispatch_threads == -1)ext->event_dispatch_threads=val;}
+
 	void get_ip_from_if(vector<string> &);
 
 //
@@ -335,6 +345,9 @@ public:
 	bool is_zmq_event_consumer_created() {return ext->zmq_event_consumer != NULL;}
 	ZmqEventConsumer *get_zmq_event_consumer();
 
+	void subscribe_event(const vector<DeviceProxy *> &,const vector<string> &,EventType,CallBack *,
+					   const vector<string> &,vector<int> &,bool stateless = false);
+
 //
 // Asynchronous methods
 //
@@ -385,7 +398,7 @@ private:
     {
     public:
         ApiUtilExt():notifd_event_consumer(NULL),cl_pid(0),user_connect_timeout(-1),
-                     zmq_event_consumer(NULL),user_sub_hwm(-1) {};
+                     zmq_event_consumer(NULL),user_sub_hwm(-1),event_dispatch_threads(-1) {};
 
         NotifdEventConsumer *notifd_event_consumer;
         TangoSys_Pid		cl_pid;
@@ -393,6 +406,7 @@ private:
         ZmqEventConsumer    *zmq_event_consumer;
         vector<string>      host_ip_adrs;
         DevLong             user_sub_hwm;
+        int                 event_dispatch_threads;
     };
 
 	TANGO_IMP static ApiUtil 	*_instance;
@@ -614,6 +628,7 @@ public :
 #endif
 
 	void deep_copy(const DeviceAttribute &);
+	void shared_copy(DeviceAttribute &);
 
 	DeviceAttribute(AttributeValue);
 
@@ -961,15 +976,28 @@ protected :
 	bool check_for_data();
 	bool check_wrong_type_exception();
 	int  check_set_value_size(int seq_length);
+	void unshare_data();
+	void share_buffers(DeviceAttribute &);
 
 protected:
+    struct SharedAttrData
+    {
+        SharedAttrData(DeviceAttribute *da):ref_ctr(1),data(da) {};
+
+        omni_mutex              ref_mutex;
+        int                     ref_ctr;            // Number of DeviceAttribute using the data
+        DeviceAttribute         *data;              // The DeviceAttribute owning the data buffers
+    };
+
     class DeviceAttributeExt
     {
     public:
-        DeviceAttributeExt():w_dim_x(0),w_dim_y(0) {};
+        DeviceAttributeExt():w_dim_x(0),w_dim_y(0),shared(NULL) {};
+        ~DeviceAttributeExt() {release_shared();}
         DeviceAttributeExt & operator=(const DeviceAttributeExt &);
 
         void deep_copy(const DeviceAttributeExt &);
+        void release_shared();
 
         DevErrorList_var		err_list;
         long 					w_dim_x;
@@ -980,6 +1008,8 @@ protected:
         DevVarULong64Array_var	ULong64Seq;
         DevVarStateArray_var	StateSeq;
         DevVarEncodedArray_var	EncodedSeq;
+
+        SharedAttrData          *shared;            // Not NULL if data buffers are shared (copy on write)
     };
 
 #ifdef HAS_UNIQUE_PTR
@@ -1328,6 +1358,9 @@ protected :
 	};
 
 	bool is_polled(polled_object,string &, string &);
+	bool is_polled(polled_object,string &, int &);
+	void get_poll_periods(map<string,int> &);
+	void invalidate_poll_cache();
 	virtual void reconnect(bool);
 	void get_remaining_param(AttributeInfoListEx *);
 	void from_hist4_2_AttHistory(DevAttrHistory_4_var &,vector<DeviceAttributeHistory> *);
@@ -1341,9 +1374,16 @@ private:
     class DeviceProxyExt
     {
     public:
-        DeviceProxyExt() {};
+        DeviceProxyExt():poll_cache_date(0.0),poll_cache_ttl(POLL_STATUS_CACHE_TTL),poll_cache_gen(0),poll_bin_cmd(true) {};
 
         omni_mutex			lock_mutex;
+
+        omni_mutex			poll_cache_mutex;
+        map<string,int>		poll_cache;			// Polled object ('c' or 'a' + lower case name) -> period
+        double				poll_cache_date;	// Cache fill date (mS)
+        long				poll_cache_ttl;		// Cache validity (mS)
+        unsigned long		poll_cache_gen;		// Incremented at each cache invalidation
+        bool				poll_bin_cmd;		// Admin device supports DevPollStatusBin
     };
 
 #ifdef HAS_UNIQUE_PTR
@@ -1464,6 +1504,8 @@ public :
 	virtual void stop_poll_command(const char *na) {string tmp(na);stop_poll_command(tmp);}
 	virtual void stop_poll_attribute(string &);
 	virtual void stop_poll_attribute(const char *na) {string tmp(na);stop_poll_attribute(tmp);}
+
+	void set_poll_cache_ttl(long);		// Opt-in cache of the polling periods used by is_polled() (mS)
 //
 // Asynchronous methods
 //
@@ -67,6 +67,22 @@ DeviceAttribute::DeviceAttributeExt &DeviceAttribute::DeviceAttributeExt::operat
 	if (nc_source.EncodedSeq.operator->() != NULL)
 		EncodedSeq = nc_source.EncodedSeq._retn();
 
+//
+// Sequences coming from a DeviceAttribute sharing its buffers do not own them.
+// Also keep a reference on the shared data
+//
+
+	if (rval.shared != shared)
+	{
+		release_shared();
+		if (rval.shared != NULL)
+		{
+			omni_mutex_lock oml(rval.shared->ref_mutex);
+			rval.shared->ref_ctr++;
+			shared = rval.shared;
+		}
+	}
+
 	return *this;
 }
 
@@ -82,6 +98,51 @@ void DeviceAttribute::DeviceAttributeExt::deep_copy(const DeviceAttribute::Devic
 	StateSeq = rval.StateSeq;
 	EncodedSeq = rval.EncodedSeq;
 
+//
+// All buffers have been copied, shared data are not used any more
+//
+
+	release_shared();
+}
+
+//-----------------------------------------------------------------------------
+//
+// DeviceAttributeExt::release_shared() - Release the reference on the shared
+// data (if any). The shared data are deleted with their last reference
+//
+//-----------------------------------------------------------------------------
+
+void DeviceAttribute::DeviceAttributeExt::release_shared()
+{
+	if (shared != NULL)
+	{
+		bool last_ref = false;
+		{
+			omni_mutex_lock oml(shared->ref_mutex);
+			shared->ref_ctr--;
+			if (shared->ref_ctr == 0)
+				last_ref = true;
+		}
+
+		if (last_ref == true)
+		{
+			delete shared->data;
+			delete shared;
+		}
+		shared = NULL;
+	}
+}
+
+//-----------------------------------------------------------------------------
+//
+// Build a sequence using (but not owning) the buffer of another sequence
+//
+//-----------------------------------------------------------------------------
+
+template <typename T>
+static T *shared_seq(T &src)
+{
+	return new T(src.maximum(),src.length(),src.get_buffer(),false);
 }
 //-----------------------------------------------------------------------------
 //
@@ -253,6 +314,191 @@ void DeviceAttribute::deep_copy(const DeviceAttribute & source)
 #endif
 }
 
+//-----------------------------------------------------------------------------
+//
+// DeviceAttribute::shared_copy() - Copy a DeviceAttribute without copying its
+// data buffers. Both objects share the buffers until one of them is modified
+// (copy on write). Used when one event is given to several callbacks.
+// The source must own its data buffers
+//
+//-----------------------------------------------------------------------------
+
+void DeviceAttribute::shared_copy(DeviceAttribute &source)
+{
+	if (this == &source)
+		return;
+
+//
+// The first time the source data are shared, move them into a DeviceAttribute
+// owned by the shared data and make the source use them
+//
+
+	if (source.ext->shared == NULL)
+	{
+		DeviceAttribute *owner = new DeviceAttribute();
+		if (source.LongSeq.operator->() != NULL)
+			owner->LongSeq = source.LongSeq._retn();
+		if (source.ShortSeq.operator->() != NULL)
+			owner->ShortSeq = source.ShortSeq._retn();
+		if (source.DoubleSeq.operator->() != NULL)
+			owner->DoubleSeq = source.DoubleSeq._retn();
+		if (source.StringSeq.operator->() != NULL)
+			owner->StringSeq = source.StringSeq._retn();
+		if (source.FloatSeq.operator->() != NULL)
+			owner->FloatSeq = source.FloatSeq._retn();
+		if (source.BooleanSeq.operator->() != NULL)
+			owner->BooleanSeq = source.BooleanSeq._retn();
+		if (source.UShortSeq.operator->() != NULL)
+			owner->UShortSeq = source.UShortSeq._retn();
+		if (source.UCharSeq.operator->() != NULL)
+			owner->UCharSeq = source.UCharSeq._retn();
+		if (source.ext->Long64Seq.operator->() != NULL)
+			owner->ext->Long64Seq = source.ext->Long64Seq._retn();
+		if (source.ext->ULongSeq.operator->() != NULL)
+			owner->ext->ULongSeq = source.ext->ULongSeq._retn();
+		if (source.ext->ULong64Seq.operator->() != NULL)
+			owner->ext->ULong64Seq = source.ext->ULong64Seq._retn();
+		if (source.ext->StateSeq.operator->() != NULL)
+			owner->ext->StateSeq = source.ext->StateSeq._retn();
+		if (source.ext->EncodedSeq.operator->() != NULL)
+			owner->ext->EncodedSeq = source.ext->EncodedSeq._retn();
+
+		source.ext->shared = new SharedAttrData(owner);
+		source.share_buffers(*owner);
+	}
+
+	SharedAttrData *sh = source.ext->shared;
+	{
+		omni_mutex_lock oml(sh->ref_mutex);
+		sh->ref_ctr++;
+	}
+
+	share_buffers(*(sh->data));
+	ext->release_shared();
+	ext->shared = sh;
+
+	name = source.name;
+	exceptions_flags = source.exceptions_flags;
+	dim_x = source.dim_x;
+	dim_y = source.dim_y;
+	quality = source.quality;
+	data_format = source.data_format;
+	time = source.time;
+
+	d_state = source.d_state;
+	d_state_filled = source.d_state_filled;
+
+	ext->err_list = source.ext->err_list;
+	ext->w_dim_x = source.ext->w_dim_x;
+	ext->w_dim_y = source.ext->w_dim_y;
+}
+
+//-----------------------------------------------------------------------------
+//
+// DeviceAttribute::share_buffers() - Make all the sequences of this object
+// use (without owning them) the buffers of the owner object
+//
+//-----------------------------------------------------------------------------
+
+void DeviceAttribute::share_buffers(DeviceAttribute &owner)
+{
+	if (owner.LongSeq.operator->() != NULL)
+		LongSeq = shared_seq(owner.LongSeq.inout());
+	else
+		LongSeq = (DevVarLongArray *)NULL;
+	if (owner.ShortSeq.operator->() != NULL)
+		ShortSeq = shared_seq(owner.ShortSeq.inout());
+	else
+		ShortSeq = (DevVarShortArray *)NULL;
+	if (owner.DoubleSeq.operator->() != NULL)
+		DoubleSeq = shared_seq(owner.DoubleSeq.inout());
+	else
+		DoubleSeq = (DevVarDoubleArray *)NULL;
+	if (owner.StringSeq.operator->() != NULL)
+		StringSeq = shared_seq(owner.StringSeq.inout());
+	else
+		StringSeq = (DevVarStringArray *)NULL;
+	if (owner.FloatSeq.operator->() != NULL)
+		FloatSeq = shared_seq(owner.FloatSeq.inout());
+	else
+		FloatSeq = (DevVarFloatArray *)NULL;
+	if (owner.BooleanSeq.operator->() != NULL)
+		BooleanSeq = shared_seq(owner.BooleanSeq.inout());
+	else
+		BooleanSeq = (DevVarBooleanArray *)NULL;
+	if (owner.UShortSeq.operator->() != NULL)
+		UShortSeq = shared_seq(owner.UShortSeq.inout());
+	else
+		UShortSeq = (DevVarUShortArray *)NULL;
+	if (owner.UCharSeq.operator->() != NULL)
+		UCharSeq = shared_seq(owner.UCharSeq.inout());
+	else
+		UCharSeq = (DevVarCharArray *)NULL;
+	if (owner.ext->Long64Seq.operator->() != NULL)
+		ext->Long64Seq = shared_seq(owner.ext->Long64Seq.inout());
+	else
+		ext->Long64Seq = (DevVarLong64Array *)NULL;
+	if (owner.ext->ULongSeq.operator->() != NULL)
+		ext->ULongSeq = shared_seq(owner.ext->ULongSeq.inout());
+	else
+		ext->ULongSeq = (DevVarULongArray *)NULL;
+	if (owner.ext->ULong64Seq.operator->() != NULL)
+		ext->ULong64Seq = shared_seq(owner.ext->ULong64Seq.inout());
+	else
+		ext->ULong64Seq = (DevVarULong64Array *)NULL;
+	if (owner.ext->StateSeq.operator->() != NULL)
+		ext->StateSeq = shared_seq(owner.ext->StateSeq.inout());
+	else
+		ext->StateSeq = (DevVarStateArray *)NULL;
+	if (owner.ext->EncodedSeq.operator->() != NULL)
+		ext->EncodedSeq = shared_seq(owner.ext->EncodedSeq.inout());
+	else
+		ext->EncodedSeq = (DevVarEncodedArray *)NULL;
+}
+
+//-----------------------------------------------------------------------------
+//
+// DeviceAttribute::unshare_data() - If the data buffers are shared with other
+// DeviceAttribute, copy them before this object is modified or its data
+// given to the caller
+//
+//-----------------------------------------------------------------------------
+
+void DeviceAttribute::unshare_data()
+{
+	if (ext->shared == NULL)
+		return;
+
+	if (LongSeq.operator->() != NULL)
+		LongSeq = new DevVarLongArray(LongSeq.in());
+	if (ShortSeq.operator->() != NULL)
+		ShortSeq = new DevVarShortArray(ShortSeq.in());
+	if (DoubleSeq.operator->() != NULL)
+		DoubleSeq = new DevVarDoubleArray(DoubleSeq.in());
+	if (StringSeq.operator->() != NULL)
+		StringSeq = new DevVarStringArray(StringSeq.in());
+	if (FloatSeq.operator->() != NULL)
+		FloatSeq = new DevVarFloatArray(FloatSeq.in());
+	if (BooleanSeq.operator->() != NULL)
+		BooleanSeq = new DevVarBooleanArray(BooleanSeq.in());
+	if (UShortSeq.operator->() != NULL)
+		UShortSeq = new DevVarUShortArray(UShortSeq.in());
+	if (UCharSeq.operator->() != NULL)
+		UCharSeq = new DevVarCharArray(UCharSeq.in());
+	if (ext->Long64Seq.operator->() != NULL)
+		ext->Long64Seq = new DevVarLong64Array(ext->Long64Seq.in());
+	if (ext->ULongSeq.operator->() != NULL)
+		ext->ULongSeq = new DevVarULongArray(ext->ULongSeq.in());
+	if (ext->ULong64Seq.operator->() != NULL)
+		ext->ULong64Seq = new DevVarULong64Array(ext->ULong64Seq.in());
+	if (ext->StateSeq.operator->() != NULL)
+		ext->StateSeq = new DevVarStateArray(ext->StateSeq.in());
+	if (ext->EncodedSeq.operator->() != NULL)
+		ext->EncodedSeq = new DevVarEncodedArray(ext->EncodedSeq.in());
+
+	ext->release_shared();
+}
+
 //-----------------------------------------------------------------------------
 //
 // DeviceAttribute::get_x_dimension - Get attribute data transfer dimension
@@ -303,6 +549,8 @@ DeviceAttribute & DeviceAttribute::operator=(const DeviceAttribute &rval)
 {
     if (this != &rval)
     {
+        unshare_data();
+
         name = rval.name;
         exceptions_flags = rval.exceptions_flags;
         dim_x = rval.dim_x;
@@ -375,6 +623,8 @@ DeviceAttribute & DeviceAttribute::operator=(const DeviceAttribute &rval)
 #ifdef HAS_RVALUE
 DeviceAttribute & DeviceAttribute::operator=(DeviceAttribute &&rval)
 {
+	unshare_data();
+
 	name = move(rval.name);
 	exceptions_flags = rval.exceptions_flags;
 	dim_x = rval.dim_x;
@@ -1872,6 +2122,8 @@ bool DeviceAttribute::operator >> (short &datum)
 
 void DeviceAttribute::operator << (short datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -1923,6 +2175,8 @@ bool DeviceAttribute::operator >> (DevLong &datum)
 
 void DeviceAttribute::operator << (DevLong datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -1974,6 +2228,8 @@ bool DeviceAttribute::operator >> (DevLong64 &datum)
 
 void DeviceAttribute::operator << (DevLong64 datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2024,6 +2280,8 @@ bool DeviceAttribute::operator >> (double &datum)
 
 void DeviceAttribute::operator << (double datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2074,6 +2332,8 @@ bool DeviceAttribute::operator >> (string& datum)
 
 void DeviceAttribute::operator << (string& datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2089,6 +2349,8 @@ void DeviceAttribute::operator << (string& datum)
 
 void DeviceAttribute::operator << (DevString datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2104,6 +2366,8 @@ void DeviceAttribute::operator << (DevString datum)
 
 void DeviceAttribute::operator << (const char *datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2154,6 +2418,8 @@ bool DeviceAttribute::operator >> (float &datum)
 
 void DeviceAttribute::operator << (float datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2205,6 +2471,8 @@ bool DeviceAttribute::operator >> (bool &datum)
 
 void DeviceAttribute::operator << (bool datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2255,6 +2523,8 @@ bool DeviceAttribute::operator >> (unsigned short &datum)
 
 void DeviceAttribute::operator << (unsigned short datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2305,6 +2575,8 @@ bool DeviceAttribute::operator >> (unsigned char &datum)
 
 void DeviceAttribute::operator << (unsigned char datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2356,6 +2628,8 @@ bool DeviceAttribute::operator >> (DevULong &datum)
 
 void DeviceAttribute::operator << (DevULong datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2407,6 +2681,8 @@ bool DeviceAttribute::operator >> (DevULong64 &datum)
 
 void DeviceAttribute::operator << (DevULong64 datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2467,6 +2743,8 @@ bool DeviceAttribute::operator >> (DevState &datum)
 
 void DeviceAttribute::operator << (DevState datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2519,6 +2797,8 @@ bool DeviceAttribute::operator >> (DevEncoded &datum)
 
 void DeviceAttribute::operator << (DevEncoded &datum)
 {
+	unshare_data();
+
 	dim_x = 1;
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2573,6 +2853,8 @@ void DeviceAttribute::insert(string &str,vector<unsigned char> &array)
 
 void DeviceAttribute::operator << (vector<string> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2641,6 +2923,8 @@ bool DeviceAttribute::operator >> (vector<string>& datum)
 
 void DeviceAttribute::operator << (vector<short> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2708,6 +2992,8 @@ bool DeviceAttribute::operator >> (vector<short>& datum)
 
 void DeviceAttribute::operator << (vector<DevLong> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2776,6 +3062,8 @@ bool DeviceAttribute::operator >> (vector<DevLong>& datum)
 
 void DeviceAttribute::operator << (vector<DevLong64> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2843,6 +3131,8 @@ bool DeviceAttribute::operator >> (vector<DevLong64>& datum)
 
 void DeviceAttribute::operator << (vector<double> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2911,6 +3201,8 @@ bool DeviceAttribute::operator >> (vector<double>& datum)
 
 void DeviceAttribute::operator << (vector<float> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -2979,6 +3271,8 @@ bool DeviceAttribute::operator >> (vector<float>& datum)
 
 void DeviceAttribute::operator << (vector<bool> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3047,6 +3341,8 @@ bool DeviceAttribute::operator >> (vector<bool>& datum)
 
 void DeviceAttribute::operator << (vector<unsigned short> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3114,6 +3410,8 @@ bool DeviceAttribute::operator >> (vector<unsigned short>& datum)
 
 void DeviceAttribute::operator << (vector<unsigned char> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3181,6 +3479,8 @@ bool DeviceAttribute::operator >> (vector<unsigned char>& datum)
 
 void DeviceAttribute::operator << (vector<DevULong> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3248,6 +3548,8 @@ bool DeviceAttribute::operator >> (vector<DevULong>& datum)
 
 void DeviceAttribute::operator << (vector<DevULong64> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3315,6 +3617,8 @@ bool DeviceAttribute::operator >> (vector<DevULong64>& datum)
 
 void DeviceAttribute::operator << (vector<DevState> &datum)
 {
+	unshare_data();
+
 	dim_x = datum.size();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3383,6 +3687,8 @@ bool DeviceAttribute::operator >> (vector<DevState>& datum)
 
 bool DeviceAttribute::operator >> (DevVarShortArray* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3415,6 +3721,8 @@ bool DeviceAttribute::operator >> (DevVarShortArray* &datum)
 
 bool DeviceAttribute::operator >> (DevVarLongArray* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3447,6 +3755,8 @@ bool DeviceAttribute::operator >> (DevVarLongArray* &datum)
 
 bool DeviceAttribute::operator >> (DevVarDoubleArray* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3479,6 +3789,8 @@ bool DeviceAttribute::operator >> (DevVarDoubleArray* &datum)
 
 bool DeviceAttribute::operator >> (DevVarStringArray* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3512,6 +3824,8 @@ bool DeviceAttribute::operator >> (DevVarStringArray* &datum)
 
 bool DeviceAttribute::operator >> (DevVarFloatArray* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3544,6 +3858,8 @@ bool DeviceAttribute::operator >> (DevVarFloatArray* &datum)
 
 bool DeviceAttribute::operator >> (DevVarBooleanArray* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3577,6 +3893,8 @@ bool DeviceAttribute::operator >> (DevVarBooleanArray* &datum)
 
 bool DeviceAttribute::operator >> (DevVarUShortArray* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3609,6 +3927,8 @@ bool DeviceAttribute::operator >> (DevVarUShortArray* &datum)
 
 bool DeviceAttribute::operator >> (DevVarCharArray* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3641,6 +3961,8 @@ bool DeviceAttribute::operator >> (DevVarCharArray* &datum)
 
 bool DeviceAttribute::operator >> (DevVarLong64Array* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3673,6 +3995,8 @@ bool DeviceAttribute::operator >> (DevVarLong64Array* &datum)
 
 bool DeviceAttribute::operator >> (DevVarULongArray* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3705,6 +4029,8 @@ bool DeviceAttribute::operator >> (DevVarULongArray* &datum)
 
 bool DeviceAttribute::operator >> (DevVarULong64Array* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3737,6 +4063,8 @@ bool DeviceAttribute::operator >> (DevVarULong64Array* &datum)
 
 bool DeviceAttribute::operator >> (DevVarStateArray* &datum)
 {
+	unshare_data();
+
 	// check for available data
 
 	bool ret = check_for_data();
@@ -3769,6 +4097,8 @@ bool DeviceAttribute::operator >> (DevVarStateArray* &datum)
 
 bool DeviceAttribute::operator >> (DevVarEncodedArray* &datum)
 {
+	unshare_data();
+
 	bool ret = true;
 
 	if (ext->err_list.operator->() != NULL)
@@ -3818,6 +4148,8 @@ bool DeviceAttribute::operator >> (DevVarEncodedArray* &datum)
 
 void DeviceAttribute::operator << (const DevVarShortArray &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3847,6 +4179,8 @@ void DeviceAttribute::insert(const DevVarShortArray &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarShortArray *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3874,6 +4208,8 @@ void DeviceAttribute::insert(DevVarShortArray *datum,int x,int y)
 
 void DeviceAttribute::operator << (const DevVarLongArray &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3903,6 +4239,8 @@ void DeviceAttribute::insert(const DevVarLongArray &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarLongArray *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3930,6 +4268,8 @@ void DeviceAttribute::insert(DevVarLongArray *datum,int x,int y)
 
 void DeviceAttribute::operator << (const DevVarDoubleArray &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3959,6 +4299,8 @@ void DeviceAttribute::insert(const DevVarDoubleArray &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarDoubleArray *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -3986,6 +4328,8 @@ void DeviceAttribute::insert(DevVarDoubleArray *datum,int x,int y)
 
 void DeviceAttribute::operator << (const DevVarStringArray &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4015,6 +4359,8 @@ void DeviceAttribute::insert(const DevVarStringArray &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarStringArray *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4043,6 +4389,8 @@ void DeviceAttribute::insert(DevVarStringArray *datum,int x,int y)
 
 void DeviceAttribute::operator << (const DevVarFloatArray &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4072,6 +4420,8 @@ void DeviceAttribute::insert(const DevVarFloatArray &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarFloatArray *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4099,6 +4449,8 @@ void DeviceAttribute::insert(DevVarFloatArray *datum,int x,int y)
 
 void DeviceAttribute::operator << (const DevVarBooleanArray &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4128,6 +4480,8 @@ void DeviceAttribute::insert(const DevVarBooleanArray &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarBooleanArray *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4156,6 +4510,8 @@ void DeviceAttribute::insert(DevVarBooleanArray *datum,int x,int y)
 
 void DeviceAttribute::operator << (const DevVarUShortArray &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4185,6 +4541,8 @@ void DeviceAttribute::insert(const DevVarUShortArray &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarUShortArray *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4213,6 +4571,8 @@ void DeviceAttribute::insert(DevVarUShortArray *datum,int x,int y)
 
 void DeviceAttribute::operator << (const DevVarCharArray &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4242,6 +4602,8 @@ void DeviceAttribute::insert(const DevVarCharArray &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarCharArray *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4269,6 +4631,8 @@ void DeviceAttribute::insert(DevVarCharArray *datum,int x,int y)
 
 void DeviceAttribute::operator << (const DevVarLong64Array &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4298,6 +4662,8 @@ void DeviceAttribute::insert(const DevVarLong64Array &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarLong64Array *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4325,6 +4691,8 @@ void DeviceAttribute::insert(DevVarLong64Array *datum,int x,int y)
 
 void DeviceAttribute::operator << (const DevVarULongArray &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4354,6 +4722,8 @@ void DeviceAttribute::insert(const DevVarULongArray &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarULongArray *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4381,6 +4751,8 @@ void DeviceAttribute::insert(DevVarULongArray *datum,int x,int y)
 
 void DeviceAttribute::operator << (const DevVarULong64Array &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4410,6 +4782,8 @@ void DeviceAttribute::insert(const DevVarULong64Array &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarULong64Array *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4437,6 +4811,8 @@ void DeviceAttribute::insert(DevVarULong64Array *datum,int x,int y)
 
 void DeviceAttribute::operator << (const DevVarStateArray &datum)
 {
+	unshare_data();
+
 	dim_x = datum.length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4466,6 +4842,8 @@ void DeviceAttribute::insert(const DevVarStateArray &datum,int x,int y)
 
 void DeviceAttribute::operator << (DevVarStateArray *datum)
 {
+	unshare_data();
+
 	dim_x = datum->length();
 	dim_y = 0;
 	quality = Tango::ATTR_VALID;
@@ -4494,6 +4872,8 @@ void DeviceAttribute::insert(DevVarStateArray *datum,int x,int y)
 
 bool DeviceAttribute::extract(const char *&str,unsigned char *&data_ptr,unsigned int &data_size)
 {
+	unshare_data();
+
 // check for available data
 
 	bool ret = check_for_data();
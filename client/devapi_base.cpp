@@ -5860,48 +5860,89 @@ vector<string> *DeviceProxy::polling_status()
 
 //-----------------------------------------------------------------------------
 //
-// DeviceProxy::is_polled() - return true if the object "obj_name" is polled.
-//			      In this case, the upd string is initialised with
-//			      the polling period.
+// DeviceProxy::get_poll_periods() - Get the polling period of every polled
+//				     object of the device. Keys are 'c' (command)
+//				     or 'a' (attribute) followed by the lower
+//				     case object name. Use the DevPollStatusBin
+//				     admin command and revert to the
+//				     DevPollStatus strings for older servers
 //
 //-----------------------------------------------------------------------------
 
-bool DeviceProxy::is_polled(polled_object obj, string &obj_name,string &upd)
+void DeviceProxy::get_poll_periods(map<string,int> &periods)
 {
-	bool ret = false;
-	vector<string> *poll_str;
+	periods.clear();
 
-	poll_str = polling_status();
-	if (poll_str->size() == 0)
+	if (ext_proxy->poll_bin_cmd == true)
 	{
-		delete poll_str;
-		return ret;
+		check_connect_adm_device();
+
+		DeviceData dout,din;
+		string cmd("DevPollStatusBin");
+		din.any <<= device_name.c_str();
+
+		try
+		{
+			try
+			{
+				dout = adm_device->command_inout(cmd,din);
+			}
+			catch (Tango::CommunicationFailed &)
+			{
+				dout = adm_device->command_inout(cmd,din);
+			}
+
+			const DevVarDoubleStringArray *out;
+			dout >> out;
+
+			for (unsigned int i = 0;i < out->svalue.length();i++)
+			{
+				string name(out->svalue[i].in());
+				transform(name.begin(),name.end(),name.begin(),::tolower);
+				CORBA::Double type = out->dvalue[i * POLL_STATUS_BIN_FIELDS];
+				name.insert(0,1,(type == 0.0) ? 'c' : 'a');
+				periods[name] = (int)out->dvalue[(i * POLL_STATUS_BIN_FIELDS) + 1];
+			}
+			return;
+		}
+		catch (DevFailed &e)
+		{
+
+//
+// Old server or read only client (controlled access) not allowed to
+// execute the new command
+//
+
+			string reason(e.errors[0].reason.in());
+			if ((reason != "API_CommandNotFound") && (reason != "API_ReadOnlyMode"))
+				throw;
+			ext_proxy->poll_bin_cmd = false;
+		}
 	}
 
-	string loc_obj_name(obj_name);
-	transform(loc_obj_name.begin(),loc_obj_name.end(),loc_obj_name.begin(),::tolower);
+//
+// Old server, parse the polling status strings
+//
+
+	vector<string> *poll_str;
+	poll_str = polling_status();
 
 	for (unsigned int i = 0;i < poll_str->size();i++)
 	{
 		string &tmp_str = (*poll_str)[i];
+
+//
+// Skip strings not related to one polled object (polling thread statistics)
+//
+
+		if (tmp_str.compare(0,7,"Polled ") != 0)
+			continue;
+
 		string::size_type pos,end;
 		pos = tmp_str.find(' ');
 		pos++;
 		end = tmp_str.find(' ',pos + 1);
 		string obj_type = tmp_str.substr(pos, end - pos);
-		if (obj_type == "command")
-		{
-			if (obj == Attr)
-				continue;
-		}
-		else if (obj_type == "attribute")
-		{
-			if (obj == Cmd)
-			{
-				if ((loc_obj_name != "state") && (loc_obj_name != "status"))
-					continue;
-			}
-		}
 
 		pos = tmp_str.find('=');
 		pos = pos + 2;
@@ -5910,37 +5951,144 @@ bool DeviceProxy::is_polled(polled_object obj, string &obj_name,string &upd)
 			end = tmp_str.find('\n',pos + 1);
 		string name = tmp_str.substr(pos, end - pos);
 		transform(name.begin(),name.end(),name.begin(),::tolower);
+		name.insert(0,1,(obj_type == "command") ? 'c' : 'a');
 
-		if (name == loc_obj_name)
+		int per = 0;
+		pos = tmp_str.find("triggered",end);
+		if (pos == string::npos)
 		{
+			pos = tmp_str.find('=',end);
+			pos = pos + 2;
+			per = atoi(tmp_str.c_str() + pos);
+		}
+		periods[name] = per;
+	}
 
+	delete poll_str;
+}
+
+//-----------------------------------------------------------------------------
 //
-// Now that it's found, search for its polling period
+// DeviceProxy::is_polled() - return true if the object "obj_name" is polled.
+//			      In this case, the upd parameter is initialised
+//			      with the polling period (0 if externally
+//			      triggered). The device polling periods are
+//			      cached for poll_cache_ttl mS (no cache by
+//			      default, see set_poll_cache_ttl())
 //
+//-----------------------------------------------------------------------------
 
-			pos = tmp_str.find("triggered",end);
-			if (pos != string::npos)
-			{
-				ret = true;
-				upd = "0";
-				break;
-			}
-			else
-			{
-				pos = tmp_str.find('=',end);
-				pos = pos + 2;
-				end = tmp_str.find('\n',pos + 1);
-				string per = tmp_str.substr(pos, end - pos);
-				upd = per;
-				ret = true;
-				break;
-			}
+bool DeviceProxy::is_polled(polled_object obj, string &obj_name,int &upd)
+{
+	string loc_obj_name(obj_name);
+	transform(loc_obj_name.begin(),loc_obj_name.end(),loc_obj_name.begin(),::tolower);
+
+	struct timeval now;
+#ifndef _TG_WINDOWS_
+	gettimeofday(&now, NULL);
+#else
+	struct _timeb now_win;
+	_ftime(&now_win);
+	now.tv_sec = (unsigned long)now_win.time;
+	now.tv_usec = (long)now_win.millitm * 1000;
+#endif /* _TG_WINDOWS_ */
+	double now_ms = ((double)now.tv_sec * 1000) + ((double)now.tv_usec / 1000);
+
+//
+// Use the cache if it is still valid. Otherwise, read the polling periods
+// from the device server without holding the cache mutex
+//
+
+	map<string,int> cache;
+	bool cache_valid = false;
+	unsigned long gen;
+
+	{
+		omni_mutex_lock guard(ext_proxy->poll_cache_mutex);
+		gen = ext_proxy->poll_cache_gen;
+
+		double age = now_ms - ext_proxy->poll_cache_date;
+		if ((ext_proxy->poll_cache_ttl > 0) && (age >= 0) && (age < ext_proxy->poll_cache_ttl))
+		{
+			cache = ext_proxy->poll_cache;
+			cache_valid = true;
 		}
 	}
 
-	delete poll_str;
+	if (cache_valid == false)
+	{
+		get_poll_periods(cache);
+
+		omni_mutex_lock guard(ext_proxy->poll_cache_mutex);
+		if ((ext_proxy->poll_cache_ttl > 0) && (gen == ext_proxy->poll_cache_gen))
+		{
+			ext_proxy->poll_cache = cache;
+			ext_proxy->poll_cache_date = now_ms;
+		}
+	}
+
+	map<string,int>::iterator ite = cache.end();
+
+	if (obj == Cmd)
+	{
+		ite = cache.find('c' + loc_obj_name);
+		if ((ite == cache.end()) && ((loc_obj_name == "state") || (loc_obj_name == "status")))
+			ite = cache.find('a' + loc_obj_name);
+	}
+	else
+		ite = cache.find('a' + loc_obj_name);
+
+	if (ite == cache.end())
+		return false;
+
+	upd = ite->second;
+	return true;
+}
+
+bool DeviceProxy::is_polled(polled_object obj, string &obj_name,string &upd)
+{
+	int per;
+	bool ret = is_polled(obj,obj_name,per);
+	if (ret == true)
+	{
+		TangoSys_OMemStream o;
+		o << per;
+		upd = o.str();
+	}
+	return ret;
+}
+
+//-----------------------------------------------------------------------------
+//
+// DeviceProxy::invalidate_poll_cache() - Force the next is_polled() call to
+//					  re-read the device polling status
+//
+//-----------------------------------------------------------------------------
 
-	return  ret;
+void DeviceProxy::invalidate_poll_cache()
+{
+	omni_mutex_lock guard(ext_proxy->poll_cache_mutex);
+	ext_proxy->poll_cache_date = 0.0;
+	ext_proxy->poll_cache_gen++;
+}
+
+//-----------------------------------------------------------------------------
+//
+// DeviceProxy::set_poll_cache_ttl() - Set how long (in mS) polling periods
+//				       read from the device server are re-used
+//				       by is_polled(). 0 (the default) disables
+//				       the cache. When enabled, polling changes
+//				       done by other clients are seen up to ttl
+//				       mS later
+//
+//-----------------------------------------------------------------------------
+
+void DeviceProxy::set_poll_cache_ttl(long ttl)
+{
+	omni_mutex_lock guard(ext_proxy->poll_cache_mutex);
+	ext_proxy->poll_cache_ttl = ttl;
+	ext_proxy->poll_cache_date = 0.0;
+	ext_proxy->poll_cache_gen++;
 }
 
 //-----------------------------------------------------------------------------
@@ -5952,18 +6100,10 @@ bool DeviceProxy::is_polled(polled_object obj, string &obj_name,string &upd)
 
 int DeviceProxy::get_command_poll_period(string &cmd_name)
 {
-	string poll_per;
-	bool poll = is_polled(Cmd,cmd_name,poll_per);
-
 	int ret;
-	if (poll == true)
-	{
-		TangoSys_MemStream stream;
+	bool poll = is_polled(Cmd,cmd_name,ret);
 
-		stream << poll_per << ends;
-		stream >> ret;
-	}
-	else
+	if (poll == false)
 		ret = 0;
 
 	return ret;
@@ -5978,18 +6118,10 @@ int DeviceProxy::get_command_poll_period(string &cmd_name)
 
 int DeviceProxy::get_attribute_poll_period(string &attr_name)
 {
-	string poll_per;
-	bool poll = is_polled(Attr,attr_name,poll_per);
-
 	int ret;
-	if (poll == true)
-	{
-		TangoSys_MemStream stream;
+	bool poll = is_polled(Attr,attr_name,ret);
 
-		stream << poll_per << ends;
-		stream >> ret;
-	}
-	else
+	if (poll == false)
 		ret = 0;
 
 	return ret;
@@ -6005,8 +6137,15 @@ int DeviceProxy::get_attribute_poll_period(string &attr_name)
 
 void DeviceProxy::poll_command(string &cmd_name, int period)
 {
-	string poll_per;
-	bool poll = is_polled(Cmd,cmd_name,poll_per);
+
+//
+// Always get fresh polling status before changing it
+//
+
+	invalidate_poll_cache();
+
+	int per;
+	bool poll = is_polled(Cmd,cmd_name,per);
 
 	DevVarLongStringArray in;
 	in.lvalue.length(1);
@@ -6023,11 +6162,6 @@ void DeviceProxy::poll_command(string &cmd_name, int period)
 //
 // If object is polled and the polling period is the same, simply retruns
 //
-		TangoSys_MemStream stream;
-		int per;
-
-		stream << poll_per << ends;
-		stream >> per;
 
 		if ((per == period) || (per == 0))
 			return;
@@ -6075,6 +6209,7 @@ void DeviceProxy::poll_command(string &cmd_name, int period)
 
 	}
 
+	invalidate_poll_cache();
 }
 
 //-----------------------------------------------------------------------------
@@ -6087,8 +6222,15 @@ void DeviceProxy::poll_command(string &cmd_name, int period)
 
 void DeviceProxy::poll_attribute(string &attr_name, int period)
 {
-	string poll_per;
-	bool poll = is_polled(Attr,attr_name,poll_per);
+
+//
+// Always get fresh polling status before changing it
+//
+
+	invalidate_poll_cache();
+
+	int per;
+	bool poll = is_polled(Attr,attr_name,per);
 
 	DevVarLongStringArray in;
 	in.lvalue.length(1);
@@ -6105,11 +6247,6 @@ void DeviceProxy::poll_attribute(string &attr_name, int period)
 //
 // If object is polled and the polling period is the same, simply retruns
 //
-		TangoSys_MemStream stream;
-		int per;
-
-		stream << poll_per << ends;
-		stream >> per;
 
 		if ((per == period) || (per == 0))
 			return;
@@ -6157,6 +6294,7 @@ void DeviceProxy::poll_attribute(string &attr_name, int period)
 
 	}
 
+	invalidate_poll_cache();
 }
 
 //-----------------------------------------------------------------------------
@@ -6213,6 +6351,7 @@ void DeviceProxy::stop_poll_command(string &cmd_name)
 		adm_device->command_inout(cmd,din);
 	}
 
+	invalidate_poll_cache();
 }
 
 //-----------------------------------------------------------------------------
@@ -6245,6 +6384,7 @@ void DeviceProxy::stop_poll_attribute(string &attr_name)
 		adm_device->command_inout(cmd,din);
 	}
 
+	invalidate_poll_cache();
 }
 
 #ifdef TANGO_HAS_LOG4TANGO
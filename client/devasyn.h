@@ -29,6 +29,8 @@
 #include <tango.h>
 
 #include <map>
+#include <deque>
+#include <set>
 
 using namespace std;
 
@@ -198,6 +200,94 @@ private:
 #endif
 };
 
+/********************************************************************************
+ * 																				*
+ * 						AsynCompletion class									*
+ * 																				*
+ *******************************************************************************/
+
+class AsynCompletion
+{
+public:
+	enum CompletionType
+	{
+		CMD_INOUT,
+		READ_ATTR,
+		WRITE_ATTR
+	};
+
+	AsynCompletion(long,CompletionType,Tango::DeviceProxy *);
+	~AsynCompletion();
+
+	long					tag;		// Tag given when the request was sent
+	CompletionType			type;
+	Tango::DeviceProxy		*device;
+	vector<string>			obj_names;	// Command or attribute name(s)
+	DeviceData				*cmd_data;	// Command result (CMD_INOUT)
+	vector<DeviceAttribute>	*attr_data;	// Attribute values (READ_ATTR)
+	bool					err;
+	DevErrorList			errors;
+	vector<NamedDevFailed>	err_list;	// Per attribute errors (WRITE_ATTR, see NamedDevFailedList)
+
+private:
+	AsynCompletion(const AsynCompletion &);
+	AsynCompletion &operator=(const AsynCompletion &);
+};
+
+/********************************************************************************
+ * 																				*
+ * 						AsynCompletionQueue class								*
+ * 																				*
+ *******************************************************************************/
+
+//
+// The replies are received by the API callback thread. Creating a queue
+// therefore switches the process-wide asynchronous callback sub-model to
+// PUSH_CALLBACK (see ApiUtil::set_asynch_cb_sub_model()). The constructor
+// throws if callback requests sent in PULL_CALLBACK mode are still waiting
+// for ApiUtil::get_asynch_replies()
+// A completion is queued only once the library does not use its device
+// any more: the caller of get_completion() may then delete the device
+//
+
+class AsynCompletionQueue: public omni_mutex
+{
+public:
+	AsynCompletionQueue();
+	~AsynCompletionQueue();
+
+	void command_inout(Tango::DeviceProxy *,const char *,DeviceData &,long tag = 0);
+	void command_inout(Tango::DeviceProxy *,const char *,long tag = 0);
+	void read_attribute(Tango::DeviceProxy *,const char *,long tag = 0);
+	void read_attributes(Tango::DeviceProxy *,vector<string> &,long tag = 0);
+	void write_attribute(Tango::DeviceProxy *,DeviceAttribute &,long tag = 0);
+	void write_attributes(Tango::DeviceProxy *,vector<DeviceAttribute> &,long tag = 0);
+
+	AsynCompletion *get_completion(long timeout = 0);
+	size_t get_pending_nb() {omni_mutex_lock sync(*this);return pending;}
+	size_t get_completed_nb() {omni_mutex_lock sync(*this);return completed.size();}
+
+	void push_completion(AsynCompletion *);
+
+	static void publish(CallBack *);			// Library use only, once the request is removed
+
+private:
+	friend class AsynCompletionCb;
+
+	AsynCompletionQueue(const AsynCompletionQueue &);
+	AsynCompletionQueue &operator=(const AsynCompletionQueue &);
+
+	void push_error(AsynCompletion *,DevFailed &);
+	static void stage(CallBack *);
+
+	static omni_mutex			staged_mutex;	// Protect staged_cb
+	static set<CallBack *>		staged_cb;		// Fired callbacks not yet published
+
+	deque<AsynCompletion *>		completed;	// Replies, in arrival order
+	size_t						pending;	// Requests sent without reply yet
+	omni_condition				cond;
+};
+
 //------------------------------------------------------------------------------
 
 class UniqIdent: public omni_mutex
@@ -273,6 +363,7 @@ protected:
 
 	multimap<Connection *,TgRequest>	cb_dev_table;
 	map<CORBA::Request_ptr,TgRequest>	cb_req_table;
+	map<CORBA::Request_ptr,multimap<Connection *,TgRequest>::iterator> cb_dev_index;
 
 	vector<long>				cancelled_request;
 
@@ -1135,27 +1135,306 @@ int EventConsumer::subscribe_event (DeviceProxy *device,
 		// yet connected events.
 		// Retry to connect in the next heartbeat period.
 
-		EventNotConnected conn_params;
-		conn_params.device           = device;
-		conn_params.attribute        = attribute;
-		conn_params.event_type       = event;
-		conn_params.event_name       = event_name;
-		conn_params.callback         = callback;
-		conn_params.ev_queue         = ev_queue;
-		conn_params.filters          = filters;
-		conn_params.last_heartbeat   = time(NULL);
-
-		// protect the vector as the other maps!
-
-		// create and save the unique event ID
-		subscribe_event_id++;
-		conn_params.event_id = subscribe_event_id;
+		return store_not_connected_event(device,attribute,event,event_name,callback,ev_queue,filters);
+	}
+}
 
-		event_not_connected.push_back (conn_params);
-		return subscribe_event_id;
+//+----------------------------------------------------------------------------
+//
+// method : 		EventConsumer::subscribe_event()
+//
+// description : 	Method to subscribe to the same event type for a list of
+//			attributes. The attributes are grouped per device server
+//			and the subscription is done with one
+//			ZmqEventSubscriptionChangeBulk command per device server
+//			(for EVENT_BULK_SUBSCRIPTION_MAX attributes) instead of one
+//			subscription command per attribute. Attributes from device
+//			servers which do not support this command are subscribed
+//			one at a time. Applications call it through
+//			ApiUtil::subscribe_event().
+//
+// argument : in :  devices   : The device handles
+//			        attributes : The attribute names (one per device handle)
+//			        event     : The type of event to subscribe for
+//			        callback  : A pointer to the callback object
+//			        filters   : Eventual event filter strings
+//                  stateless : Flag to enable the stateless connection when set to true
+//			 out :  event_ids : The event identifiers (one per attribute)
+//
+// For non stateless subscription, the first error is re-thrown. The events
+// already subscribed stay subscribed and their identifiers are in event_ids
+//
+//-----------------------------------------------------------------------------
+void EventConsumer::subscribe_event (const vector<DeviceProxy *> &devices,
+				   const vector<string> &attributes,
+				   EventType event,
+				   CallBack *callback,
+				   const vector<string> &filters,
+				   vector<int> &event_ids,
+				   bool stateless)
+{
+	size_t nb_event = devices.size();
+	bool wrong_args = (callback == NULL) || (nb_event != attributes.size());
+	for (size_t loop = 0;loop < nb_event && wrong_args == false;loop++)
+	{
+		if (devices[loop] == NULL)
+			wrong_args = true;
+	}
+
+	if (wrong_args == true)
+	{
+		EventSystemExcept::throw_exception((const char*)"API_InvalidArgs",
+                       	(const char*)"Device or callback pointer NULL or device and attribute lists with different size",
+                       	(const char*)"EventConsumer::subscribe_event()");
+	}
+
+	if (event == QUALITY_EVENT)
+	{
+        EventSystemExcept::throw_exception((const char*)"API_InvalidArgs",
+            (const char*)"The quality change event does`nt exist any more. A change event is fired on a qaulity change!",
+            (const char*)"EventConsumer::subscribe_event()");
+	}
+	string event_name(EventName[event]);
+
+	event_ids.clear();
+	event_ids.resize(nb_event,0);
+
+    DelayEvent de(this);
+	WriterLock w(map_modification_lock);
+
+//
+// Get the subscription data of all the events from one device server in one go
+// (ZMQ only)
+//
+
+	map<size_t,DeviceData> sub_data;
+	string cmd_name;
+	get_subscription_command_name(cmd_name);
+	if (cmd_name == "ZmqEventSubscriptionChange")
+		get_bulk_subscription_data(devices,attributes,event_name,sub_data);
+
+	for (size_t loop = 0;loop < nb_event;loop++)
+	{
+		DeviceData *dd_ptr = NULL;
+		map<size_t,DeviceData>::iterator pos = sub_data.find(loop);
+		if (pos != sub_data.end())
+			dd_ptr = &(pos->second);
+
+		try
+		{
+			event_ids[loop] = connect_event(devices[loop],attributes[loop],event,callback,NULL,filters,event_name,0,dd_ptr);
+		}
+		catch (Tango::DevFailed &e)
+		{
+			string reason(e.errors[0].reason.in());
+			if ((stateless == false) || (reason == "API_CommandNotFound"))
+			{
+				throw;
+			}
+
+			event_ids[loop] = store_not_connected_event(devices[loop],attributes[loop],event,event_name,callback,NULL,filters);
+		}
+	}
+
+//
+// connect_event() does not wait for ZMQ subscription propagation when it
+// receives the subscription data. Do it once for all the events
+//
+
+	if (sub_data.empty() == false)
+	{
+#ifndef _TG_WINDOWS_
+		struct timespec ts;
+		ts.tv_nsec = 20000000;
+		ts.tv_sec = 0;
+
+		nanosleep(&ts,NULL);
+#else
+		Sleep(20);
+#endif
 	}
 }
 
+//+----------------------------------------------------------------------------
+//
+// method : 		EventConsumer::get_bulk_subscription_data()
+//
+// description : 	Group the events per device server admin device and
+//			send them the ZmqEventSubscriptionChangeBulk command.
+//			Convert the command result for each event into what the
+//			ZmqEventSubscriptionChange command would have returned.
+//			Nothing is returned for failed subscriptions or when the
+//			device server does not support the command. connect_event()
+//			then sends the classical command.
+//
+// argument : in :  devices   : The device handles
+//			        attributes : The attribute names (one per device handle)
+//			        event_name : The event name
+//			 out :  sub_data  : The subscription data (key is the index in
+//			                    the device list)
+//
+//-----------------------------------------------------------------------------
+void EventConsumer::get_bulk_subscription_data(const vector<DeviceProxy *> &devices,
+				   const vector<string> &attributes,
+				   string &event_name,
+				   map<size_t,DeviceData> &sub_data)
+{
+	map<string,vector<size_t> > adm_groups;
+	map<DeviceProxy *,string> adm_names;
+
+	for (size_t loop = 0;loop < devices.size();loop++)
+	{
+		map<DeviceProxy *,string>::iterator pos = adm_names.find(devices[loop]);
+		if (pos == adm_names.end())
+		{
+			string adm;
+			try
+			{
+				adm = devices[loop]->adm_name();
+			}
+			catch (...) {}		// connect_event() will report the error
+			pos = adm_names.insert(make_pair(devices[loop],adm)).first;
+		}
+
+		if (pos->second.empty() == false)
+			adm_groups[pos->second].push_back(loop);
+	}
+
+	map<string,vector<size_t> >::iterator ite;
+	for (ite = adm_groups.begin();ite != adm_groups.end();++ite)
+	{
+		vector<size_t> &ind = ite->second;
+		if (ind.size() < 2)
+			continue;
+
+		DeviceProxy *adm_dev = NULL;
+		try
+		{
+			adm_dev = new DeviceProxy(ite->first);
+		}
+		catch (...)
+		{
+			continue;
+		}
+
+		for (size_t start = 0;start < ind.size();start = start + EVENT_BULK_SUBSCRIPTION_MAX)
+		{
+			size_t nb = ind.size() - start;
+			if (nb > EVENT_BULK_SUBSCRIPTION_MAX)
+				nb = EVENT_BULK_SUBSCRIPTION_MAX;
+
+			DeviceData subscriber_in,subscriber_out;
+			vector<string> subscriber_info;
+			subscriber_info.reserve(1 + (nb * 4));
+			subscriber_info.push_back(BATCH_EVENT_CLIENT);
+			for (size_t loop = start;loop < start + nb;loop++)
+			{
+				string att_lower(attributes[ind[loop]]);
+				transform(att_lower.begin(),att_lower.end(),att_lower.begin(),::tolower);
+
+				subscriber_info.push_back(devices[ind[loop]]->dev_name());
+				subscriber_info.push_back(att_lower);
+				subscriber_info.push_back("subscribe");
+				subscriber_info.push_back(event_name);
+			}
+			subscriber_in << subscriber_info;
+
+			const DevVarLongStringArray *dvlsa;
+			try
+			{
+				subscriber_out = adm_dev->command_inout("ZmqEventSubscriptionChangeBulk",subscriber_in);
+				if ((subscriber_out >> dvlsa) == false)
+					break;
+			}
+			catch (...)
+			{
+				break;
+			}
+
+			if (dvlsa->lvalue.length() < (2 + (nb * 4)) || dvlsa->svalue.length() < (2 + (nb * 2)))
+				continue;
+
+			for (size_t loop = 0;loop < nb;loop++)
+			{
+				unsigned long l_ind = 2 + (loop * 4);
+				unsigned long s_ind = 2 + (loop * 2);
+				if (dvlsa->lvalue[l_ind] != 0)
+					continue;
+
+				DevVarLongStringArray *ev_data = new DevVarLongStringArray();
+				ev_data->lvalue.length(5);
+				ev_data->lvalue[0] = dvlsa->lvalue[0];
+				ev_data->lvalue[1] = dvlsa->lvalue[l_ind + 1];
+				ev_data->lvalue[2] = dvlsa->lvalue[1];
+				ev_data->lvalue[3] = dvlsa->lvalue[l_ind + 2];
+				ev_data->lvalue[4] = dvlsa->lvalue[l_ind + 3];
+
+				if (::strlen(dvlsa->svalue[1].in()) != 0)
+				{
+					ev_data->svalue.length(3);
+					ev_data->svalue[2] = CORBA::string_dup(dvlsa->svalue[1].in());
+				}
+				else
+					ev_data->svalue.length(2);
+				ev_data->svalue[0] = CORBA::string_dup(dvlsa->svalue[0].in());
+				ev_data->svalue[1] = CORBA::string_dup(dvlsa->svalue[s_ind].in());
+
+				sub_data[ind[start + loop]] << ev_data;
+			}
+		}
+
+		delete adm_dev;
+	}
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		EventConsumer::store_not_connected_event()
+//
+// description : 	Store the data of an event which cannot be subscribed
+//			now in the vector of not yet connected events.
+//			The keep alive thread retries to connect it every heartbeat
+//			period
+//
+// argument : in :  device    : The device handle
+//			        attribute : The name of the attribute
+//			        event     : The type of event to subscribe for
+//					event_name : The event name
+//			        callback  : A pointer to the callback object
+//					ev_queue  : A pointer to the event queue
+//			        filters   : Eventual event filter strings
+//
+// This method returns the event identifier
+//
+//-----------------------------------------------------------------------------
+int EventConsumer::store_not_connected_event(DeviceProxy *device,
+				   const string &attribute,
+				   EventType event,
+				   string &event_name,
+				   CallBack *callback,
+				   EventQueue *ev_queue,
+				   const vector<string> &filters)
+{
+	EventNotConnected conn_params;
+	conn_params.device           = device;
+	conn_params.attribute        = attribute;
+	conn_params.event_type       = event;
+	conn_params.event_name       = event_name;
+	conn_params.callback         = callback;
+	conn_params.ev_queue         = ev_queue;
+	conn_params.filters          = filters;
+	conn_params.last_heartbeat   = time(NULL);
+
+	// protect the vector as the other maps!
+
+	// create and save the unique event ID
+	subscribe_event_id++;
+	conn_params.event_id = subscribe_event_id;
+
+	event_not_connected.push_back (conn_params);
+	return subscribe_event_id;
+}
+
 
 //+----------------------------------------------------------------------------
 //
@@ -1171,6 +1450,8 @@ int EventConsumer::subscribe_event (DeviceProxy *device,
 //			        filters : Eventual event filter strings
 //					event_name : The event name
 //                  event_id  : the unique event ID
+//					sub_data : The subscription command output when already
+//							   received (bulk subscription)
 //
 //-----------------------------------------------------------------------------
 
@@ -1181,7 +1462,8 @@ int EventConsumer::connect_event(DeviceProxy *device,
 				   EventQueue *ev_queue,
 				   const vector<string> &filters,
 				   string &event_name,
-				   int event_id)
+				   int event_id,
+				   DeviceData *sub_data)
 {
 	int ret_event_id = event_id;
 	device_name = device->dev_name();
@@ -1251,6 +1533,7 @@ int EventConsumer::connect_event(DeviceProxy *device,
 	subscriber_info.push_back(att_name_lower);
 	subscriber_info.push_back("subscribe");
 	subscriber_info.push_back(event_name);
+	subscriber_info.push_back(BATCH_EVENT_CLIENT);
 	subscriber_in << subscriber_info;
 
 	DeviceProxy *adm_dev = NULL;
@@ -1301,10 +1584,15 @@ int EventConsumer::connect_event(DeviceProxy *device,
 
 	try
 	{
-	    string cmd_name;
-	    get_subscription_command_name(cmd_name);
+		if (sub_data != NULL)
+			dd = *sub_data;
+		else
+		{
+	    	string cmd_name;
+	    	get_subscription_command_name(cmd_name);
 
-    	dd = adm_dev->command_inout(cmd_name,subscriber_in);
+    		dd = adm_dev->command_inout(cmd_name,subscriber_in);
+		}
 
 		dd.reset_exceptions(DeviceData::isempty_flag);
 
@@ -1477,18 +1765,21 @@ int EventConsumer::connect_event(DeviceProxy *device,
 
 //
 // Sleep for some mS (20) in order to give to ZMQ some times to propagate the subscription
-// to the publisher
+// to the publisher. In case of bulk subscription, the caller does it once for all events
 //
 
+	if (sub_data == NULL)
+	{
 #ifndef _TG_WINDOWS_
-    struct timespec ts;
-    ts.tv_nsec = 20000000;
-    ts.tv_sec = 0;
+	    struct timespec ts;
+	    ts.tv_nsec = 20000000;
+	    ts.tv_sec = 0;
 
-    nanosleep(&ts,NULL);
+	    nanosleep(&ts,NULL);
 #else
-	Sleep(20);
+		Sleep(20);
 #endif
+	}
 
 	return ret_event_id;
 }
@@ -1514,6 +1805,7 @@ void EventConsumer::unsubscribe_event(int event_id)
 
 	std::map<std::string,EventCallBackStruct>::iterator epos;
 	std::vector<EventSubscribeStruct>::iterator esspos;
+	bool marked = false;
 
 //
 // First, we need to check if the unsubscribe is not done within a callback
@@ -1540,25 +1832,50 @@ void EventConsumer::unsubscribe_event(int event_id)
 					{
 //						cout << event_id << ": Unsubscribing for an event while it is in its callback !!!!!!!!!!" << endl;
 						esspos->id = -event_id;
+						purge_dispatched_events(event_id,false);
 
 						DelayedEventUnsubThread *th = new DelayedEventUnsubThread(this,event_id,epos->second.callback_monitor);
 						th->start();
 
 						return;
 					}
+
+//
+// Otherwise, also mark the callback as unusable. No new event will be given to the
+// dispatch threads for it
+//
+
+					if (event_id > 0)
+					{
+						esspos->id = -event_id;
+						marked = true;
+					}
 				}
 			}
 		}
 	}
 
+//
+// Remove the events waiting for a dispatch thread and wait for the one
+// being executed (if any). This has to be done before the ZMQ thread is
+// delayed: The callback being executed may itself subscribe or unsubscribe
+// which also needs the ZMQ thread and the map lock
+//
+
+	purge_dispatched_events(event_id,true);
+
 //
 // Ask the main ZMQ thread to delay all incoming event until this meethod
 // exit. A dead lock could happen if we don't do this (really experienced!)
 //
 
     DelayEvent de(this);
+
 	WriterLock w(map_modification_lock);
 
+	if (marked == true)
+		event_id = -event_id;
+
 //
 // First remove the callback entry from the callback map
 //
@@ -1609,7 +1926,7 @@ void EventConsumer::unsubscribe_event(int event_id)
 					}
 					else
 					{
-					    disconnect_event(evt_cb.fully_qualified_event_name);
+					    disconnect_event(evt_cb.fully_qualified_event_name,evt_cb.batch_event_name);
 					}
 
 					// delete the allocated callback monitor
@@ -287,7 +287,8 @@ public:
 
 	int      size();
 	TimeVal get_last_event_date();
-	bool     is_empty() {if (event_buffer.empty() == true) return true;else return false;}
+	bool     is_empty() {if (nb_elt == 0) return true;else return false;}
+	long     get_dropped_events_nb();
 
 	void get_events(EventDataList         	&event_list);
 	void get_events(AttrConfEventDataList 	&event_list);
@@ -296,6 +297,8 @@ public:
 
 private:
 	void inc_indexes();
+	template <typename T> T *insert_in_buffer(vector<T *> &,T *);
+	template <typename T> void drain_buffer(vector<T *> &,vector<T *> &);
 
 	vector<EventData *>         	event_buffer;
 	vector<AttrConfEventData *> 	conf_event_buffer;
@@ -304,6 +307,7 @@ private:
 	long	max_elt;
 	long	insert_elt;
 	long	nb_elt;
+	long	dropped_elt;				// Number of events overwritten in the circular buffer
 
 	omni_mutex	modification_mutex;
 };
@@ -50,6 +50,8 @@
 #include <COS/CosNotifyComm.hh>
 #include <omnithread.h>
 #include <map>
+#include <set>
+#include <deque>
 
 #include <readers_writers_lock.h>
 
@@ -291,6 +293,7 @@ typedef struct event_callback_zmq
 {
     DevLong                         device_idl;
     DevULong                        ctr;
+    string                          batch_event_name;       // Batch event name (empty if the event is not batched)
 }EventCallBackZmq;
 
 typedef struct event_callback: public EventCallBackBase, public EventCallBackZmq
@@ -311,6 +314,7 @@ typedef struct event_channel_base
 	bool 							heartbeat_skipped;
 	TangoMonitor					*channel_monitor;
 	ChannelType                     channel_type;
+	bool                            bulk_subscription;      // Adm device supports the bulk subscription command
 } EventChannelBase;
 
 typedef struct channel_struct: public EventChannelBase
@@ -342,7 +346,7 @@ public :
 	EventConsumer(ApiUtil *ptr);
 	virtual ~EventConsumer() {}
 
-	int connect_event(DeviceProxy *,const string &,EventType,CallBack *,EventQueue *,const vector<string> &,string &,int event_id = 0);
+	int connect_event(DeviceProxy *,const string &,EventType,CallBack *,EventQueue *,const vector<string> &,string &,int event_id = 0,DeviceData *sub_data = NULL);
 	void connect(DeviceProxy *,string &,DeviceData &,string &);
 
 	void shutdown();
@@ -355,6 +359,8 @@ public :
 	                   CallBack *callback, const vector<string> &filters, bool stateless = false);
 	int subscribe_event(DeviceProxy *device, const string &attribute, EventType event,
 	                   int event_queue_size, const vector<string> &filters, bool stateless = false);
+	void subscribe_event(const vector<DeviceProxy *> &devices, const vector<string> &attributes, EventType event,
+	                   CallBack *callback, const vector<string> &filters, vector<int> &event_ids, bool stateless = false);
 	void unsubscribe_event(int event_id);
 
 	// methods to access data in event queues
@@ -398,12 +404,15 @@ protected :
 	string													callback_key;
 
 	int add_new_callback(EvCbIte &,CallBack *,EventQueue *,int);
+	int store_not_connected_event(DeviceProxy *,const string &,EventType,string &,CallBack *,EventQueue *,const vector<string> &);
+	void get_bulk_subscription_data(const vector<DeviceProxy *> &,const vector<string> &,string &,map<size_t,DeviceData> &);
 	void get_fire_sync_event(DeviceProxy *,CallBack *,EventQueue *,EventType,string &,const string &,EventCallBackStruct &);
 
 	virtual void connect_event_channel(string &,Database *,bool,DeviceData &) = 0;
     virtual void disconnect_event_channel(TANGO_UNUSED(string &channel_name)) {}
     virtual void connect_event_system(string &,string &,string &e,const vector<string> &,EvChanIte &,EventCallBackStruct &,DeviceData &) = 0;
-    virtual void disconnect_event(string &) {}
+    virtual void disconnect_event(string &,string &) {}
+    virtual void purge_dispatched_events(int,bool) {}
 
     virtual void set_channel_type(EventChannelStruct &) = 0;
 };
@@ -455,6 +464,36 @@ private :
 };
 
 
+class ZmqEventConsumer;
+
+/********************************************************************************
+ * 																				*
+ * 						Event dispatching related classes						*
+ * 																				*
+ *******************************************************************************/
+
+struct DispatchedEvent
+{
+    int                     event_id;               // The subscription event id
+    CallBack                *callback;              // The user callback
+    TangoMonitor            *cb_monitor;            // The event callback monitor
+    string                  ev_name;                // The event name (for error message)
+    EventData               *ev_data;               // Only one of these three is not NULL
+    AttrConfEventData       *conf_data;             //
+    DataReadyEventData      *ready_data;            //
+};
+
+class DispatchEventThread: public omni_thread
+{
+public:
+	DispatchEventThread(ZmqEventConsumer *ec):omni_thread(),ev_cons(ec) {start_undetached();}
+
+	void *run_undetached(void *);
+
+private:
+	ZmqEventConsumer		*ev_cons;
+};
+
 /********************************************************************************
  * 																				*
  * 						ZmqEventConsumer class  								*
@@ -489,9 +528,10 @@ protected :
 	virtual void connect_event_channel(string &,Database *,bool,DeviceData &);
     virtual void disconnect_event_channel(string &channel_name);
     virtual void connect_event_system(string &,string &,string &e,const vector<string> &,EvChanIte &,EventCallBackStruct &,DeviceData &);
-    virtual void disconnect_event(string &);
+    virtual void disconnect_event(string &,string &);
 
     virtual void set_channel_type(EventChannelStruct &ecs) {ecs.channel_type = ZMQ;}
+    virtual void purge_dispatched_events(int,bool);
 
 private :
 	TANGO_IMP static ZmqEventConsumer       *_instance;
@@ -503,6 +543,7 @@ private :
 	map<string,zmq::socket_t *>             event_mcast;            // multicast socket(s)
 	vector<string>                          connected_pub;          //
 	vector<string>                          connected_heartbeat;    //
+	map<string,int>                         batch_event_ctr;        // Batch event name -> number of events using it
 
     AttributeValue_var                      av;
     AttributeValue_3_var                    av3;
@@ -515,17 +556,34 @@ private :
     int                                     old_poll_nb;
 	omni_mutex								subscription_mutex;
 
+	omni_mutex                              dispatch_mutex;         // Protect the dispatch data
+	omni_condition                          dispatch_cond;          // Event queued or executed
+	deque<DispatchedEvent>                  dispatch_queue;         // Events waiting for a dispatch thread
+	set<int>                                dispatch_busy;          // Event id being executed by a dispatch thread
+	set<CallBack *>                         dispatch_busy_cb;       // Callback being executed by a dispatch thread
+	vector<DispatchEventThread *>           dispatch_threads;       // The dispatch threads
+	bool                                    dispatch_exit;          // Dispatch threads exit flag
+
 	void *run_undetached(void *arg);
 	void push_heartbeat_event(string &);
-    void push_zmq_event(string &,unsigned char,zmq::message_t &,bool,const DevULong &);
+    void push_zmq_event(string &,unsigned char,zmq::message_t &,bool,const DevULong &,bool batched = false);
     bool process_ctrl(zmq::message_t &,zmq::pollitem_t *,int &);
     void process_heartbeat(zmq::message_t &,zmq::message_t &,zmq::message_t &);
-    void process_event(zmq::message_t &,zmq::message_t &,zmq::message_t &,zmq::message_t &);
+    void process_event(zmq::message_t &,zmq::message_t &,zmq::message_t &,zmq::message_t &,bool batched = false);
+    bool is_event_batch(zmq::message_t &);
+    void process_event_batch();
     void process_event(zmq_msg_t &,zmq_msg_t &,zmq_msg_t &,zmq_msg_t &);
     void multi_tango_host(zmq::socket_t *,SocketCmd,string &);
 	void print_error_message(const char *);
 
+    void dispatch_event(int,CallBack *,TangoMonitor *,const string &,EventData *,AttrConfEventData *,DataReadyEventData *);
+    bool get_dispatched_event(DispatchedEvent &);
+    void exec_dispatched_event(DispatchedEvent &);
+    void dispatched_event_done(DispatchedEvent &);
+    void stop_dispatch_threads();
+
     friend class DelayEvent;
+    friend class DispatchEventThread;
 };
 
 class DelayEvent
@@ -568,6 +626,7 @@ private :
 
     bool reconnect_to_zmq_channel(EvChanIte &,EventConsumer *,DeviceData &);
 	void reconnect_to_zmq_event(EvChanIte &,EventConsumer *,DeviceData &);
+	bool bulk_re_subscribe(EvChanIte &,EventConsumer *,set<string> &);
 };
 
 /********************************************************************************
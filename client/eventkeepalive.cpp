@@ -188,6 +188,7 @@ bool EventConsumerKeepAliveThread::reconnect_to_zmq_channel(EvChanIte &ipos,Even
                     subscriber_info.push_back(epos->second.attr_name);
                     subscriber_info.push_back("subscribe");
                     subscriber_info.push_back(epos->second.event_name);
+                    subscriber_info.push_back(BATCH_EVENT_CLIENT);
                     subscriber_in << subscriber_info;
 
                     subscriber_out = ipos->second.adm_device_proxy->command_inout("ZmqEventSubscriptionChange",subscriber_in);
@@ -420,7 +421,6 @@ void EventConsumerKeepAliveThread::reconnect_to_zmq_event(EvChanIte &ipos,EventC
 
 					try
 					{
-					    EventCallBackStruct ecbs;
 					    vector<string> vs;
 
 					    vs.push_back(string("reconnect"));
@@ -433,7 +433,7 @@ void EventConsumerKeepAliveThread::reconnect_to_zmq_event(EvChanIte &ipos,EventC
                         string prefix = fqen.substr(0,pos + 1);
                         d_name.insert(0,prefix);
 
-					    event_consumer->connect_event_system(d_name,epos->second.attr_name,epos->second.event_name,vs,ipos,ecbs,dd);
+					    event_consumer->connect_event_system(d_name,epos->second.attr_name,epos->second.event_name,vs,ipos,epos->second,dd);
 
 						cout3 << "Reconnected to ZMQ event" << endl;
 					}
@@ -453,6 +453,134 @@ void EventConsumerKeepAliveThread::reconnect_to_zmq_event(EvChanIte &ipos,EventC
 	}
 }
 
+//+----------------------------------------------------------------------------
+//
+// method : 		EventConsumerKeepAliveThread::bulk_re_subscribe()
+//
+// description : 	Method to re-subscribe all the events associated to a
+//			specific ZMQ event channel using the
+//			ZmqEventSubscriptionChangeBulk command (one command for
+//			EVENT_BULK_SUBSCRIPTION_MAX events) instead of one
+//			ZmqEventSubscriptionChange command per event
+//
+// argument : in :	ipos : An iterator to the EventChannel structure in the
+//			       Event Channel map
+//			event_consumer : Pointer to the EventConsumer
+//					 singleton
+//		  out :	subscribed : The callback map key of the events
+//				     successfully re-subscribed
+//
+// This method returns false if the first bulk command failed (old device
+// server, read only client, timeout...). The caller then has to re-subscribe
+// one event at a time
+//
+//-----------------------------------------------------------------------------
+
+bool EventConsumerKeepAliveThread::bulk_re_subscribe(EvChanIte &ipos,EventConsumer *event_consumer,set<string> &subscribed)
+{
+	if (ipos->second.bulk_subscription == false)
+		return false;
+
+	cout3 << "Entering KeepAliveThread::bulk_re_subscribe()" << endl;
+
+	vector<EvCbIte> ev_list;
+	EvCbIte epos;
+
+	for (epos = event_consumer->event_callback_map.begin(); epos != event_consumer->event_callback_map.end(); ++epos)
+	{
+		if (epos->second.channel_name == ipos->first)
+			ev_list.push_back(epos);
+	}
+
+	size_t ev_nb = ev_list.size();
+	for (size_t start = 0;start < ev_nb;start = start + EVENT_BULK_SUBSCRIPTION_MAX)
+	{
+		size_t nb = ev_nb - start;
+		if (nb > EVENT_BULK_SUBSCRIPTION_MAX)
+			nb = EVENT_BULK_SUBSCRIPTION_MAX;
+
+		DeviceData subscriber_in,subscriber_out;
+		vector<string> subscriber_info;
+		subscriber_info.reserve(1 + (nb * 4));
+		subscriber_info.push_back(BATCH_EVENT_CLIENT);
+		for (size_t loop = start;loop < start + nb;loop++)
+		{
+			subscriber_info.push_back(ev_list[loop]->second.device->dev_name());
+			subscriber_info.push_back(ev_list[loop]->second.attr_name);
+			subscriber_info.push_back("subscribe");
+			subscriber_info.push_back(ev_list[loop]->second.event_name);
+		}
+		subscriber_in << subscriber_info;
+
+		const DevVarLongStringArray *dvlsa = NULL;
+		bool bulk_failed = false;
+
+		try
+		{
+			subscriber_out = ipos->second.adm_device_proxy->command_inout("ZmqEventSubscriptionChangeBulk",subscriber_in);
+			if (((subscriber_out >> dvlsa) == false) || (dvlsa->lvalue.length() < (2 + (nb * 4))))
+				bulk_failed = true;
+		}
+		catch (DevFailed &e)
+		{
+
+//
+// Old device server or client not allowed to execute the command (read only
+// mode with controlled access): Do not try the bulk command any more for this
+// channel
+//
+
+			string reason(e.errors[0].reason.in());
+			if ((reason == "API_CommandNotFound") || (reason == "API_ReadOnlyMode"))
+				ipos->second.bulk_subscription = false;
+			bulk_failed = true;
+		}
+		catch (...)
+		{
+			bulk_failed = true;
+		}
+
+//
+// If the first command failed, let the caller re-subscribe one event at a time.
+// Otherwise, re-subscribe here the events not yet handled
+//
+
+		if (bulk_failed == true)
+		{
+			if (start == 0)
+				return false;
+
+			for (size_t loop = start;loop < ev_nb;loop++)
+			{
+				try
+				{
+					DeviceData single_in;
+					vector<string> single_info;
+					single_info.push_back(ev_list[loop]->second.device->dev_name());
+					single_info.push_back(ev_list[loop]->second.attr_name);
+					single_info.push_back("subscribe");
+					single_info.push_back(ev_list[loop]->second.event_name);
+					single_info.push_back(BATCH_EVENT_CLIENT);
+					single_in << single_info;
+
+					ipos->second.adm_device_proxy->command_inout("ZmqEventSubscriptionChange",single_in);
+					subscribed.insert(ev_list[loop]->first);
+				}
+				catch (...) {}
+			}
+			break;
+		}
+
+		for (size_t loop = 0;loop < nb;loop++)
+		{
+			if (dvlsa->lvalue[2 + (loop * 4)] == 0)
+				subscribed.insert(ev_list[start + loop]->first);
+		}
+	}
+
+	return true;
+}
+
 //+----------------------------------------------------------------------------
 //
 // method : 		EventConsumerKeepAliveThread::run_undetached
@@ -619,36 +747,70 @@ void *EventConsumerKeepAliveThread::run_undetached(TANGO_UNUSED(void *arg))
 
 					if ((now - ipos->second.last_subscribed) > EVENT_RESUBSCRIBE_PERIOD/3)
 					{
-						for (epos = event_consumer->event_callback_map.begin(); epos != event_consumer->event_callback_map.end(); ++epos)
+
+//
+// For ZMQ, re-subscribe all the events of this channel with the bulk command.
+// Old device servers (and notifd) need one command per event
+//
+
+						set<string> subscribed;
+						bool bulk_done = false;
+						if (ipos->second.channel_type == ZMQ)
+							bulk_done = bulk_re_subscribe(ipos,event_consumer,subscribed);
+
+						if (bulk_done == true)
 						{
-							if (epos->second.channel_name == ipos->first )
+							if (subscribed.empty() == false)
+								ipos->second.last_subscribed = time(NULL);
+
+							set<string>::iterator sub_ite;
+							for (sub_ite = subscribed.begin();sub_ite != subscribed.end();++sub_ite)
 							{
+								epos = event_consumer->event_callback_map.find(*sub_ite);
 								try
 								{
 									// lock the callback
 									epos->second.callback_monitor->get_monitor();
-
-									DeviceData subscriber_in;
-									vector<string> subscriber_info;
-									subscriber_info.push_back(epos->second.device->dev_name());
-									subscriber_info.push_back(epos->second.attr_name);
-									subscriber_info.push_back("subscribe");
-									subscriber_info.push_back(epos->second.event_name);
-									subscriber_in << subscriber_info;
-
-									if (ipos->second.channel_type == ZMQ)
-                                        ipos->second.adm_device_proxy->command_inout("ZmqEventSubscriptionChange",subscriber_in);
-									else
-                                        ipos->second.adm_device_proxy->command_inout("EventSubscriptionChange",subscriber_in);
-
-									ipos->second.last_subscribed = time(NULL);
-        							epos->second.last_subscribed = time(NULL);
-
+									epos->second.last_subscribed = time(NULL);
 									epos->second.callback_monitor->rel_monitor();
 								}
-								catch (...)
+								catch (...) {}
+							}
+						}
+						else
+						{
+							for (epos = event_consumer->event_callback_map.begin(); epos != event_consumer->event_callback_map.end(); ++epos)
+							{
+								if (epos->second.channel_name == ipos->first )
 								{
-									epos->second.callback_monitor->rel_monitor();
+									try
+									{
+										// lock the callback
+										epos->second.callback_monitor->get_monitor();
+
+										DeviceData subscriber_in;
+										vector<string> subscriber_info;
+										subscriber_info.push_back(epos->second.device->dev_name());
+										subscriber_info.push_back(epos->second.attr_name);
+										subscriber_info.push_back("subscribe");
+										subscriber_info.push_back(epos->second.event_name);
+										subscriber_info.push_back(BATCH_EVENT_CLIENT);
+										subscriber_in << subscriber_info;
+
+										if (ipos->second.channel_type == ZMQ)
+	                                        ipos->second.adm_device_proxy->command_inout("ZmqEventSubscriptionChange",subscriber_in);
+										else
+	                                        ipos->second.adm_device_proxy->command_inout("EventSubscriptionChange",subscriber_in);
+
+										ipos->second.last_subscribed = time(NULL);
+	        							epos->second.last_subscribed = time(NULL);
+
+										epos->second.callback_monitor->rel_monitor();
+									}
+									catch (...)
+									{
+										epos->second.callback_monitor->rel_monitor();
+									}
 								}
 							}
 						}
@@ -769,6 +931,15 @@ void *EventConsumerKeepAliveThread::run_undetached(TANGO_UNUSED(void *arg))
 						DeviceAttribute *dev_attr = NULL;
 						AttributeInfoEx *dev_attr_conf = NULL;
 
+//
+// Re-subscribe all the events of a ZMQ channel with the bulk command
+//
+
+						set<string> bulk_subscribed;
+						bool bulk_done = false;
+						if ((ipos->second.channel_type == ZMQ) && (ipos->second.event_system_failed == false))
+							bulk_done = bulk_re_subscribe(ipos,event_consumer,bulk_subscribed);
+
 						for (epos = event_consumer->event_callback_map.begin(); epos != event_consumer->event_callback_map.end(); ++epos)
 						{
 							if (epos->second.channel_name == ipos->first)
@@ -916,27 +1087,41 @@ void *EventConsumerKeepAliveThread::run_undetached(TANGO_UNUSED(void *arg))
 
 									if ( ipos->second.event_system_failed == false )
 									{
-										DeviceData subscriber_in;
-       									vector<string> subscriber_info;
-       									subscriber_info.push_back(epos->second.device->dev_name());
-       									subscriber_info.push_back(epos->second.attr_name);
-       									subscriber_info.push_back("subscribe");
-       									subscriber_info.push_back(epos->second.event_name);
-       									subscriber_in << subscriber_info;
-
 										bool ds_failed = false;
 
-										try
+										if (bulk_done == true)
+										{
+											if (bulk_subscribed.find(epos->first) == bulk_subscribed.end())
+												ds_failed = true;
+											else
+											{
+												ipos->second.heartbeat_skipped = false;
+												ipos->second.last_subscribed = time(NULL);
+											}
+										}
+										else
 										{
-										    if (ipos->second.channel_type == ZMQ)
-                                                ipos->second.adm_device_proxy->command_inout("ZmqEventSubscriptionChange",subscriber_in);
-										    else
-                                                ipos->second.adm_device_proxy->command_inout("EventSubscriptionChange",subscriber_in);
+											DeviceData subscriber_in;
+											vector<string> subscriber_info;
+											subscriber_info.push_back(epos->second.device->dev_name());
+											subscriber_info.push_back(epos->second.attr_name);
+											subscriber_info.push_back("subscribe");
+											subscriber_info.push_back(epos->second.event_name);
+											subscriber_info.push_back(BATCH_EVENT_CLIENT);
+											subscriber_in << subscriber_info;
+
+											try
+											{
+											    if (ipos->second.channel_type == ZMQ)
+	                                                ipos->second.adm_device_proxy->command_inout("ZmqEventSubscriptionChange",subscriber_in);
+											    else
+	                                                ipos->second.adm_device_proxy->command_inout("EventSubscriptionChange",subscriber_in);
 
-											ipos->second.heartbeat_skipped = false;
-        									ipos->second.last_subscribed = time(NULL);
+												ipos->second.heartbeat_skipped = false;
+	        									ipos->second.last_subscribed = time(NULL);
+											}
+											catch (...) {ds_failed = true;}
 										}
-										catch (...) {ds_failed = true;}
 
 										if (ds_failed == false)
 										{
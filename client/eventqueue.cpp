@@ -68,6 +68,7 @@ EventQueue::EventQueue()
 	max_elt     = 0;
 	insert_elt  = 0;
 	nb_elt      = 0;
+	dropped_elt = 0;
 }
 
 EventQueue::EventQueue(long max_size)
@@ -79,6 +80,7 @@ EventQueue::EventQueue(long max_size)
 
 	insert_elt  = 0;
 	nb_elt      = 0;
+	dropped_elt = 0;
 }
 
 //+-------------------------------------------------------------------------
@@ -97,85 +99,103 @@ EventQueue::~EventQueue()
 	// lock the event queue
 	omni_mutex_lock l(modification_mutex);
 
-	long nb = nb_elt;
+	// The circular buffer is kept between extractions. Extracted or
+	// not yet used elements are NULL
 
-	// check whether the events are not attribute configuration events
-	if (event_buffer.size() > 0 )
-		{
-		for (long i=0; i<nb; i++)
-			delete event_buffer[i];
-
-		event_buffer.clear();
-		}
-	// for attibute configuration events
-	else
-	{
-		if (conf_event_buffer.size() > 0)
-		{
-			for (long i=0; i<nb; i++)
-				delete conf_event_buffer[i];
+	for (unsigned long i = 0;i < event_buffer.size();i++)
+		delete event_buffer[i];
+	event_buffer.clear();
 
-			conf_event_buffer.clear();
-		}
-		else
-		{
-			for (long i=0; i<nb; i++)
-				delete ready_event_buffer[i];
+	for (unsigned long i = 0;i < conf_event_buffer.size();i++)
+		delete conf_event_buffer[i];
+	conf_event_buffer.clear();
 
-			ready_event_buffer.clear();
-		}
-	}
+	for (unsigned long i = 0;i < ready_event_buffer.size();i++)
+		delete ready_event_buffer[i];
+	ready_event_buffer.clear();
 }
 
 //+-------------------------------------------------------------------------
 //
-// method :         EventQueue::insert_event
+// method :         EventQueue::insert_in_buffer
 //
-// description :    Insert a new event in the event queue
+// description :    Insert a new event in one of the event buffer.
+//                  The queue must be locked by the caller.
 //
-// argument : in :  - new_event : A pointer to the allocated event data
+// argument : in :  - buf : The event buffer
+//                  - new_event : A pointer to the allocated event data
 //                                structure.
 //
+// return :         The event overwritten in the circular buffer (if any).
+//                  It has to be deleted by the caller once the queue
+//                  is unlocked
+//
 //--------------------------------------------------------------------------
 
-void EventQueue::insert_event (EventData *new_event)
+template <typename T>
+T *EventQueue::insert_in_buffer(vector<T *> &buf,T *new_event)
 {
-	cout3 << "Entering EventQueue::insert_event" << endl;
-
-	// lock the event queue
-	omni_mutex_lock l(modification_mutex);
-
-	//
-	// Insert data in the event queue
-	//
+	T *old_event = NULL;
 
 	// when no maximum queue size is given, just add the new event
 	if ( max_elt == 0 )
     {
-		event_buffer.push_back (new_event);
+		buf.push_back (new_event);
     }
 
 	// when a maximum size is given, handle a circular buffer
 	else
     {
-		// allocate ring buffer when not yet done
-		if ( event_buffer.empty() == true )
+		// allocate ring buffer when not yet done. The ring buffer
+		// is kept between extractions
+		if ( buf.empty() == true )
         {
-			event_buffer.resize (max_elt, NULL);
+			buf.resize (max_elt, NULL);
         }
 
-		// free data when necessary
-		if ( event_buffer[insert_elt] != NULL )
+		// the oldest event is lost
+		if ( buf[insert_elt] != NULL )
         {
-			delete event_buffer[insert_elt];
+			old_event = buf[insert_elt];
+			dropped_elt++;
         }
 
 		// insert the event data pointer into the queue
-		event_buffer[insert_elt] = new_event;
+		buf[insert_elt] = new_event;
     }
 
-		// Manage insert and read indexes
+	// Manage insert and read indexes
     inc_indexes();
+
+	return old_event;
+}
+
+//+-------------------------------------------------------------------------
+//
+// method :         EventQueue::insert_event
+//
+// description :    Insert a new event in the event queue
+//
+// argument : in :  - new_event : A pointer to the allocated event data
+//                                structure.
+//
+//--------------------------------------------------------------------------
+
+void EventQueue::insert_event (EventData *new_event)
+{
+	cout3 << "Entering EventQueue::insert_event" << endl;
+
+	EventData *old_event;
+
+	{
+		// lock the event queue
+		omni_mutex_lock l(modification_mutex);
+
+		old_event = insert_in_buffer(event_buffer,new_event);
+	}
+
+	// free data out of the lock
+	delete old_event;
 }
 
 //+-------------------------------------------------------------------------
@@ -194,40 +214,17 @@ void EventQueue::insert_event (AttrConfEventData *new_event)
 {
 	cout3 << "Entering EventQueue::insert_event" << endl;
 
-	// lock the event queue
-	omni_mutex_lock l(modification_mutex);
-
-	//
-	// Insert data in the event queue
-	//
-
-	// when no maximum queue size is given, just add the new event
-	if ( max_elt == 0 )
-    {
-		conf_event_buffer.push_back (new_event);
-    }
-
-	// when a maximum size s given, handle a circular buffer
-	else
-    {
-		// allocate ring buffer when not yet done
-		if ( conf_event_buffer.empty() == true )
-        {
-			conf_event_buffer.resize (max_elt, NULL);
-        }
+	AttrConfEventData *old_event;
 
-		// free data when necessary
-		if ( conf_event_buffer[insert_elt] != NULL )
-        {
-			delete conf_event_buffer[insert_elt];
-        }
+	{
+		// lock the event queue
+		omni_mutex_lock l(modification_mutex);
 
-		// insert the event data pointer into the queue
-		conf_event_buffer[insert_elt] = new_event;
-    }
+		old_event = insert_in_buffer(conf_event_buffer,new_event);
+	}
 
-    // Manage insert and read indexes
-    inc_indexes();
+	// free data out of the lock
+	delete old_event;
 }
 
 //+-------------------------------------------------------------------------
@@ -246,40 +243,17 @@ void EventQueue::insert_event (DataReadyEventData *new_event)
 {
 	cout3 << "Entering EventQueue::insert_event" << endl;
 
-	// lock the event queue
-	omni_mutex_lock l(modification_mutex);
-
-	//
-	// Insert data in the event queue
-	//
+	DataReadyEventData *old_event;
 
-	// when no maximum queue size is given, just add the new event
-	if ( max_elt == 0 )
-    {
-		ready_event_buffer.push_back (new_event);
-    }
-
-	// when a maximum size s given, handle a circular buffer
-	else
-    {
-		// allocate ring buffer when not yet done
-		if ( ready_event_buffer.empty() == true )
-        {
-			ready_event_buffer.resize (max_elt, NULL);
-        }
-
-		// free data when necessary
-		if ( ready_event_buffer[insert_elt] != NULL )
-        {
-			delete ready_event_buffer[insert_elt];
-        }
+	{
+		// lock the event queue
+		omni_mutex_lock l(modification_mutex);
 
-		// insert the event data pointer into the queue
-		ready_event_buffer[insert_elt] = new_event;
-    }
+		old_event = insert_in_buffer(ready_event_buffer,new_event);
+	}
 
-    // Manage insert and read indexes
-    inc_indexes();
+	// free data out of the lock
+	delete old_event;
 }
 
 
@@ -330,6 +304,22 @@ int EventQueue::size()
 	return nb_elt;
 }
 
+//+-------------------------------------------------------------------------
+//
+// method :         EventQueue::get_dropped_events_nb
+//
+// description :    Returns the number of events lost because the circular
+//                  buffer was full when they have been received
+//
+//--------------------------------------------------------------------------
+long EventQueue::get_dropped_events_nb()
+{
+	// lock the event queue
+	omni_mutex_lock l(modification_mutex);
+
+	return dropped_elt;
+}
+
 
 //+-------------------------------------------------------------------------
 //
@@ -347,56 +337,77 @@ TimeVal EventQueue::get_last_event_date()
 	// lock the event queue
 	omni_mutex_lock l(modification_mutex);
 
+	if ( nb_elt == 0 )
+	{
+		TangoSys_OMemStream o;
+		o << "No new events available!\n";
+		o << "Cannot return any event date" << ends;
+		EventSystemExcept::throw_exception((const char *)"API_EventQueues",
+		        o.str(),
+		        (const char *)"EventQueue::get_last_event_date()");
+	}
+
+	long index = insert_elt;
+	if (index == 0)
+		index = max_elt;
+	index--;
+
 	if ( event_buffer.empty() == false )
-		{
-		if (insert_elt == 0)
-			{
-			return event_buffer[max_elt - 1]->get_date();
-			}
-		else
-			{
-			return event_buffer[insert_elt - 1]->get_date();
-			}
-		}
+		return event_buffer[index]->get_date();
+	else if ( conf_event_buffer.empty() == false )
+		return conf_event_buffer[index]->get_date();
 	else
+		return ready_event_buffer[index]->get_date();
+}
+
+
+//-------------------------------------------------------------------------
+//
+// method :         EventQueue::drain_buffer
+//
+// description :    Move all the events of one event buffer into the
+//                  vector returned to the caller.
+//                  In the returned vector, indice 0 is the oldest data.
+//                  The queue must be locked by the caller.
+//
+// argument : in :  - buf : The event buffer
+//            out : - event_list : The (empty) vector to be filled
+//
+//--------------------------------------------------------------------------
+
+template <typename T>
+void EventQueue::drain_buffer(vector<T *> &buf,vector<T *> &event_list)
+{
+	if ( max_elt == 0 )
 	{
-		if ( conf_event_buffer.empty() == false )
-			{
-			if (insert_elt == 0)
-				{
-				return conf_event_buffer[max_elt - 1]->get_date();
-				}
-			else
-				{
-				return conf_event_buffer[insert_elt - 1]->get_date();
-				}
-			}
-		else
+		// unlimited buffer: simply exchange the vectors
+		event_list.swap(buf);
+	}
+	else
+	{
+		// circular buffer: the buffer itself is kept for the next events
+		event_list.resize(nb_elt);
+
+		long index = insert_elt - nb_elt;
+		if (index < 0)
+			index = index + max_elt;
+
+		for (long i=0; i < nb_elt; i++)
 		{
-			if ( ready_event_buffer.empty() == false )
-			{
-				if (insert_elt == 0)
-					return ready_event_buffer[max_elt - 1]->get_date();
-				else
-					return conf_event_buffer[insert_elt - 1]->get_date();
-			}
-			else
-			{
-				TangoSys_OMemStream o;
-				o << "No new events available!\n";
-				o << "Cannot return any event date" << ends;
-				EventSystemExcept::throw_exception((const char *)"API_EventQueues",
-				        o.str(),
-				        (const char *)"EventQueue::get_last_event_date()");
-			}
+			event_list[i] = buf[index];
+
+			// we do not want to free the event data when cleaning-up
+			// the buffer
+			buf[index] = NULL;
+
+			index++;
+			if (index == max_elt)
+				index = 0;
 		}
 	}
 
-	// Should never reach here. To make compiler happy
-
-	struct TimeVal tv;
-	tv.tv_sec = tv.tv_usec = tv.tv_nsec = 0;
-	return tv;
+	insert_elt  = 0;
+	nb_elt      = 0;
 }
 
 
@@ -416,48 +427,16 @@ void EventQueue::get_events(EventDataList &event_list)
 {
 	cout3 << "Entering EventQueue::get_events" << endl;
 
-	// lock the event queue
-	omni_mutex_lock l(modification_mutex);
-
-	//
-	// Set index to read the ring buffer and to initialise the vector
-	// of pointers to return.
-	// In the returned sequence , indice 0 is the oldest data
-	//
-	long index = insert_elt;
-	if (index == 0)
-		index = max_elt;
-	index--;
-
-	long seq_index = nb_elt - 1;
-
-	// prepare the vector to be returned
-
+	// free the previously returned events before locking the queue
 	event_list.clear();
-	event_list.resize(nb_elt);
 
-	//
-	// Read buffer
-	//
-	for (long i=0; i < nb_elt; i++)
 	{
-		event_list[seq_index] = event_buffer[index];
+		// lock the event queue
+		omni_mutex_lock l(modification_mutex);
 
-		// we do not want to free the event data when cleaning-up
-		// the vector
-		event_buffer[index] = NULL;
-
-		if (index == 0)
-			index = max_elt;
-		index--;
-		seq_index--;
+		drain_buffer(event_buffer,event_list);
 	}
 
-	// empty the event queue now
-	event_buffer.clear();
-	insert_elt  = 0;
-	nb_elt      = 0;
-
 	cout3 << "EventQueue::get_events() : size = " << event_list.size() << endl;
 	return;
 }
@@ -478,48 +457,16 @@ void EventQueue::get_events(AttrConfEventDataList &event_list)
 {
 	cout3 << "Entering EventQueue::get_events" << endl;
 
-	// lock the event queue
-	omni_mutex_lock l(modification_mutex);
-
-	//
-	// Set index to read the ring buffer and to initialise the vector
-	// of pointers to return.
-	// In the returned sequence , indice 0 is the oldest data
-	//
-	long index = insert_elt;
-	if (index == 0)
-		index = max_elt;
-	index--;
-
-	long seq_index = nb_elt - 1;
-
-	// prepare the vector to be returned
-
+	// free the previously returned events before locking the queue
 	event_list.clear();
-	event_list.resize(nb_elt);
 
-	//
-	// Read buffer
-	//
-	for (long i=0; i < nb_elt; i++)
 	{
-		event_list[seq_index] = conf_event_buffer[index];
+		// lock the event queue
+		omni_mutex_lock l(modification_mutex);
 
-		// we do not want to free the event data when cleaning-up
-		// the vector
-		conf_event_buffer[index] = NULL;
-
-		if (index == 0)
-			index = max_elt;
-		index--;
-		seq_index--;
+		drain_buffer(conf_event_buffer,event_list);
 	}
 
-	// empty the event queue now
-	conf_event_buffer.clear();
-	insert_elt  = 0;
-	nb_elt      = 0;
-
 	cout3 << "EventQueue::get_events() : size = " << event_list.size() << endl;
 
 	return;
@@ -542,48 +489,16 @@ void EventQueue::get_events(DataReadyEventDataList &event_list)
 {
 	cout3 << "Entering EventQueue::get_events" << endl;
 
-	// lock the event queue
-	omni_mutex_lock l(modification_mutex);
-
-	//
-	// Set index to read the ring buffer and to initialise the vector
-	// of pointers to return.
-	// In the returned sequence , indice 0 is the oldest data
-	//
-	long index = insert_elt;
-	if (index == 0)
-		index = max_elt;
-	index--;
-
-	long seq_index = nb_elt - 1;
-
-	// prepare the vector to be returned
-
+	// free the previously returned events before locking the queue
 	event_list.clear();
-	event_list.resize(nb_elt);
 
-	//
-	// Read buffer
-	//
-	for (long i=0; i < nb_elt; i++)
 	{
-		event_list[seq_index] = ready_event_buffer[index];
+		// lock the event queue
+		omni_mutex_lock l(modification_mutex);
 
-		// we do not want to free the event data when cleaning-up
-		// the vector
-		ready_event_buffer[index] = NULL;
-
-		if (index == 0)
-			index = max_elt;
-		index--;
-		seq_index--;
+		drain_buffer(ready_event_buffer,event_list);
 	}
 
-	// empty the event queue now
-	ready_event_buffer.clear();
-	insert_elt  = 0;
-	nb_elt      = 0;
-
 	cout3 << "EventQueue::get_events() : size = " << event_list.size() << endl;
 
 	return;
@@ -21,6 +21,13 @@
 #include <iostream>
 #include <tango.h>
 
+#ifndef _TG_WINDOWS_
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
 // DbInfo                              done
 // DbImportDevice
 // DbExportDevice
@@ -229,16 +236,116 @@ bool hasAttributeName<T>::operator() (T* obj)
 }
 
 
-FileDatabaseExt::FileDatabaseExt() {}
+FileDatabaseExt::FileDatabaseExt():res_buf(NULL),journal_nb(0),replaying(false) {}
 FileDatabaseExt::~FileDatabaseExt() {}
 
+//
+// Helper class giving the whole resource file content as one memory block. On Unix, the file
+// is mapped (read-only private mapping) and the lexer works directly on the mapped pages. When the
+// file cannot be mapped (and on Windows) it is read in one go.
+//
+
+class ResFileBuffer
+{
+public:
+	ResFileBuffer(const string &);
+	~ResFileBuffer();
+
+	bool good() {return ok;}
+	const char *data() {return (buf == NULL) ? "" : buf;}
+	size_t size() {return buf_size;}
+
+private:
+	void read_in_memory(const string &);
+
+	char		*buf;
+	size_t		buf_size;
+	bool		ok;
+	bool		mapped;
+};
+
+ResFileBuffer::ResFileBuffer(const string &name):buf(NULL),buf_size(0),ok(false),mapped(false)
+{
+#ifndef _TG_WINDOWS_
+	int fd = ::open(name.c_str(),O_RDONLY);
+	if (fd == -1)
+		return;
+
+	struct stat st;
+	if (::fstat(fd,&st) == 0 && S_ISREG(st.st_mode))
+	{
+		buf_size = (size_t)st.st_size;
+		if (buf_size == 0)
+			ok = true;
+		else
+		{
+			void *ptr = ::mmap(NULL,buf_size,PROT_READ,MAP_PRIVATE,fd,0);
+			if (ptr != MAP_FAILED)
+			{
+#ifdef MADV_SEQUENTIAL
+				::madvise(ptr,buf_size,MADV_SEQUENTIAL);
+#endif
+				buf = (char *)ptr;
+				mapped = true;
+				ok = true;
+			}
+		}
+	}
+	::close(fd);
+
+	if (ok == false)
+		read_in_memory(name);
+#else
+	read_in_memory(name);
+#endif
+}
+
+ResFileBuffer::~ResFileBuffer()
+{
+#ifndef _TG_WINDOWS_
+	if (mapped == true)
+	{
+		::munmap(buf,buf_size);
+		return;
+	}
+#endif
+	delete [] buf;
+}
+
+void ResFileBuffer::read_in_memory(const string &name)
+{
+	ifstream f(name.c_str(),ifstream::in | ifstream::binary);
+	if (f.good() == false)
+		return;
+
+	f.seekg(0,ios::end);
+	streamoff l = f.tellg();
+	f.seekg(0,ios::beg);
+	if (l < 0)
+		return;
+
+	buf_size = (size_t)l;
+	buf = new char[buf_size + 1];
+	f.read(buf,buf_size);
+	buf_size = (size_t)f.gcount();
+	ok = true;
+}
+
 
 FileDatabase::FileDatabase(const std::string& file_name)
 {
 	cout4 << "FILEDATABASE: FileDatabase constructor" << endl;
 	filename = file_name;
+	ext = new FileDatabaseExt;
+	ext->journal_name = filename + FILEDB_JOURNAL_EXT;
 
 	parse_res_file(filename);
+
+//
+// Apply updates done since the last time the file has been fully written
+//
+
+	replay_journal();
 }
 
 FileDatabase::~FileDatabase()
@@ -246,6 +353,14 @@ FileDatabase::~FileDatabase()
 	cout4 << "FILEDATABASE: FileDatabase destructor" << endl;
 //	write_file();
 
+//
+// Compact the journal (if any) into the resource file
+//
+
+	if (ext->journal_nb != 0)
+		write_file();
+	delete ext;
+
 	std::vector<t_device*>::iterator i;
 	for(i = m_server.devices.begin(); i != m_server.devices.end(); ++i)
 	{
@@ -292,13 +407,12 @@ FileDatabase::~FileDatabase()
 // ****************************************************
 // read the next character in the file
 // ****************************************************
-void FileDatabase :: read_char(ifstream& f)
+void FileDatabase :: read_char()
 {
+	if(pos_buf<length_buf)
+		pos_buf++;
   	CurrentChar=NextChar;
-  	if(!f.eof())
-		f.get(NextChar);
-  	else
-		NextChar=0;
+	NextChar=(pos_buf+1<length_buf) ? ext->res_buf[pos_buf+1] : 0;
   	if(CurrentChar=='\n')
 		CrtLine++;
 }
@@ -324,48 +438,48 @@ int FileDatabase :: class_lex(string& tmp_word)
 // ****************************************************
 // Go to the next line                                */
 // ****************************************************
-void  FileDatabase :: jump_line(ifstream& f)
+void  FileDatabase :: jump_line()
 {
-	while(CurrentChar!='\n' && CurrentChar!=0) read_char(f);
-		read_char(f);
+	while(CurrentChar!='\n' && CurrentChar!=0) read_char();
+		read_char();
 }
 
 
-void  FileDatabase :: jump_space(ifstream& f)
+void  FileDatabase :: jump_space()
 {
 	while((CurrentChar<=32) && (CurrentChar>0))
-		read_char(f);
+		read_char();
 }
 
   // ****************************************************
   // Read the next word in the file                           */
   // ****************************************************
-string FileDatabase :: read_word(ifstream& f)
+string FileDatabase :: read_word()
 {
 
    string ret_word="";
 
    /* Jump space and comments */
-   jump_space(f);
+   jump_space();
    while( CurrentChar=='#' ) {
-     jump_line(f);
-     jump_space(f);
+     jump_line();
+     jump_space();
    }
 
    /* Jump C like comments */
    if( CurrentChar=='/' ) {
-     read_char(f);
+     read_char();
      if( CurrentChar=='*' ) {
        bool end=false;
-       read_char(f);
+       read_char();
        while(end) {
          while( CurrentChar!='*' )
-           read_char(f);
-         read_char(f);
+           read_char();
+         read_char();
          end=(CurrentChar=='/');
        }
-       read_char(f);
-       jump_space(f);
+       read_char();
+       jump_space();
      } else {
        ret_word="/";
        return ret_word;
@@ -382,20 +496,20 @@ string FileDatabase :: read_word(ifstream& f)
        ret_word += CurrentChar;
      } else {
        ret_word += CurrentChar;
-       read_char(f);
+       read_char();
        ret_word += CurrentChar;
      }
-     read_char(f);
+     read_char();
      return ret_word;
    }
 
    /* Treat string */
    if( CurrentChar=='"' ) {
-     read_char(f);
-     while( CurrentChar!='"' && CurrentChar!=0 && CurrentChar!='\n' ) {
-       ret_word+=CurrentChar;
-       read_char(f);
-     }
+     read_char();
+     int start=pos_buf;
+     while( CurrentChar!='"' && CurrentChar!=0 && CurrentChar!='\n' )
+       read_char();
+     ret_word.assign(ext->res_buf+start,pos_buf-start);
      if(CurrentChar==0 || CurrentChar=='\n')
      {
 		cout3 << "Error at line " << StartLine << endl;
@@ -406,19 +520,20 @@ string FileDatabase :: read_word(ifstream& f)
 				               desc.str(),
 				               (const char *)"FileDatabase::CHECK_LEX");
      }
-     read_char(f);
+     read_char();
      return ret_word;
    }
 
    /* Treat other word */
+   int start=pos_buf;
    while( CurrentChar>32 && CurrentChar!=':' && CurrentChar!='/'
 	  && CurrentChar!='\\' && CurrentChar!=',' )
    {
      if( CurrentChar=='-' && NextChar=='>' )
        break;
-     ret_word+=CurrentChar;
-     read_char(f);
+     read_char();
    }
+   ret_word.assign(ext->res_buf+start,pos_buf-start);
 
    if(ret_word.length()==0) {
      return string(lexical_word_null);
@@ -431,30 +546,29 @@ string FileDatabase :: read_word(ifstream& f)
   // Read the next word in the file
   // And allow / inside
   // ****************************************************
-string FileDatabase:: read_full_word(ifstream& f)
+string FileDatabase:: read_full_word()
 {
  	string ret_word;
 
 	StartLine=CrtLine;
-	jump_space(f);
+	jump_space();
 
 	/* Treat special character */
 	if( CurrentChar==',' || CurrentChar=='\\' )
 	{
   		ret_word += CurrentChar;
-  		read_char(f);
+  		read_char();
   		return ret_word;
 	}
 
 	/* Treat string */
 	if( CurrentChar=='"' )
 	{
-  		read_char(f);
+  		read_char();
+		int start = pos_buf;
   		while( CurrentChar!='"' && CurrentChar!=0 && CurrentChar!='\n')
-		{
-			ret_word += CurrentChar;
-			read_char(f);
-  		}
+			read_char();
+		ret_word.assign(ext->res_buf + start,pos_buf - start);
   		if( CurrentChar==0 || CurrentChar=='\n')
   		{
 			cout3 << "Warning: String too long at line " << StartLine << endl;
@@ -465,18 +579,17 @@ string FileDatabase:: read_full_word(ifstream& f)
 				       desc.str(),
 				       (const char *)"FileDatabase::read_full_word");
   		}
-  		read_char(f);
+  		read_char();
 		if (ret_word.length() == 0)
 			ret_word = string(lexical_word_null);
   		return ret_word;
 	}
 
 	/* Treat other word */
+	int start = pos_buf;
 	while( CurrentChar>32 && CurrentChar!='\\' && CurrentChar!=',')
-	{
-  		ret_word += CurrentChar;
-  		read_char(f);
-	}
+  		read_char();
+	ret_word.assign(ext->res_buf + start,pos_buf - start);
 
 	if(ret_word.length()==0)
 	{
@@ -503,7 +616,7 @@ void FileDatabase:: CHECK_LEX(int lt,int le)
 }
 
 
-vector<string> FileDatabase:: parse_resource_value(ifstream& f)
+vector<string> FileDatabase:: parse_resource_value()
 {
 	int  lex;
 	vector<string> ret;
@@ -515,13 +628,13 @@ vector<string> FileDatabase:: parse_resource_value(ifstream& f)
 
 	while( (lex==_TG_COMA || lex==_TG_ASLASH) && word!="" )
 	{
-		word=read_full_word(f);
+		word=read_full_word();
 		lex=class_lex(word);
 
   	/* allow ... ,\ syntax */
 		if( lex==_TG_ASLASH )
 		{
-			word=read_full_word(f);
+			word=read_full_word();
 			lex=class_lex(word);
 		}
 
@@ -530,7 +643,7 @@ vector<string> FileDatabase:: parse_resource_value(ifstream& f)
 		ret.push_back(word);
 		nbr++;
 
-		word=read_word(f);
+		word=read_word();
 		lex=class_lex(word);
   	}
 
@@ -545,7 +658,6 @@ vector<string> FileDatabase:: parse_resource_value(ifstream& f)
 
 std::string FileDatabase::parse_res_file(const std::string &file_name)
 {
-	ifstream f;
 	bool eof=false;
 	int lex;
 
@@ -558,15 +670,11 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
 	string name;
 	string prop_name;
 
-	CrtLine=1;
-	NextChar=' ';
-	CurrentChar=' ';
-
 	cout4 << "FILEDATABASE: entering parse_res_file" << endl;
 
-/* OPEN THE FILE                  */
+/* MAP THE FILE                   */
 
-	f.open (file_name.c_str(), ifstream::in);
+	ResFileBuffer f(file_name);
 	if ( !f.good() )
 	{
 		TangoSys_MemStream desc;
@@ -576,12 +684,24 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
 				       (const char *)"FileDatabase::parse_res_file");
 	}
 
+//
+// The lexer walks the buffer with pos_buf being the index of CurrentChar. Words are extracted
+// with a single copy from the mapped memory
+//
+
+	ext->res_buf=f.data();
+	length_buf=(int)f.size();
+	pos_buf=-1;
+	CrtLine=1;
+	CurrentChar=' ';
+	NextChar=(length_buf>0) ? ext->res_buf[0] : 0;
+
 /* CHECK BEGINING OF CONFIG FILE  */
 
-	word=read_word(f);
+	word=read_word();
 	if( word == "" )
 	{
-		f.close();
+		ext->res_buf=NULL;
 		return file_name + " is empty...";
 	}
 	lex=class_lex(word);
@@ -598,18 +718,18 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
 
 /* Domain */
            		domain=word;
-           		word=read_word(f);
+           		word=read_word();
 			lex=class_lex(word);
 			//cout << "DOMAIN " << domain << endl;;
            		CHECK_LEX(lex,_TG_SLASH);
 
 /* Family */
-           		word=read_word(f);
+           		word=read_word();
 			lex=class_lex(word);
            		CHECK_LEX(lex,_TG_STRING);
            		family=word;
 			//cout << "FAMILI " << family << endl;
-           		word=read_word(f);
+           		word=read_word();
 			lex=class_lex(word);
 
 	   		switch(lex)
@@ -617,22 +737,22 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
 	   		case _TG_SLASH:
 
 	     /* Member */
-             			word=read_word(f);lex=class_lex(word);
+             			word=read_word();lex=class_lex(word);
              			CHECK_LEX(lex,_TG_STRING);
              			member=word;
-             			word=read_word(f);
+             			word=read_word();
 				lex=class_lex(word);
 
              			switch(lex)
 				{
 	       			case _TG_SLASH:
 	         /* We have a 4 fields name */
-           				word=read_word(f);
+           				word=read_word();
 					lex=class_lex(word);
            				CHECK_LEX(lex,_TG_STRING);
 	         			name=word;
 
-           				word=read_word(f);
+           				word=read_word();
 					lex=class_lex(word);
 
 	         			switch(lex)
@@ -641,7 +761,7 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
 				     		{
 	               /* Device definition */
 						m_server.instance_name = family;
-	               				vector<string> values = parse_resource_value(f);
+	               				vector<string> values = parse_resource_value();
 	               				lex=class_lex(word);
 						//cout << "Class name : " << name << endl;
 						un_class = new t_tango_class;
@@ -665,19 +785,19 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
 	           			case _TG_ARROW:
 	             				{
 	               /* We have an attribute property definition */
-                       				word=read_word(f);
+                       				word=read_word();
 						lex=class_lex(word);
                        				CHECK_LEX(lex,_TG_STRING);
 	                		 	prop_name=word;
 						//cout << "Attribute property: " << prop_name << endl;
 
 	               				/* jump : */
-                       				word=read_word(f);
+                       				word=read_word();
 						lex=class_lex(word);
                        				CHECK_LEX(lex,_TG_COLON);
 
 	               				/* Resource value */
-	               				vector<string> values = parse_resource_value(f);
+	               				vector<string> values = parse_resource_value();
 	               				lex=class_lex(word);
 
 	               /* Device attribute definition */
@@ -717,17 +837,17 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
 
 	         /* We have a device property or attribute class definition */
 
-	        			word=read_word(f);
+	        			word=read_word();
 					lex=class_lex(word);
                 			CHECK_LEX(lex,_TG_STRING);
 	        			prop_name=word;
 
 	         /* jump : */
-                			word=read_word(f); lex=class_lex(word);
+                			word=read_word(); lex=class_lex(word);
                 			CHECK_LEX(lex,_TG_COLON);
 
 	         /* Resource value */
-	        			vector<string> values = parse_resource_value(f);
+	        			vector<string> values = parse_resource_value();
 	        			lex=class_lex(word);
 
 	         			if(equalsIgnoreCase(domain, "class"))
@@ -795,13 +915,13 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
 
 	    	 /* We have a class property */
   	    	 /* Member */
-            	 		word=read_word(f); lex=class_lex(word);
+            	 		word=read_word(); lex=class_lex(word);
             	 		CHECK_LEX(lex,_TG_STRING);
             	 		member=word;
-            	 		word=read_word(f); lex=class_lex(word);
+            	 		word=read_word(); lex=class_lex(word);
 
 	    	 /* Resource value */
-	    	 		vector<string> values = parse_resource_value(f);
+	    	 		vector<string> values = parse_resource_value();
   	    	 		lex=class_lex(word);
 
 	    	 /* Class resource */
@@ -849,7 +969,7 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
       		eof=(word == lexical_word_null);
      		}
 
-		 f.close();
+		 ext->res_buf=NULL;
      	return "";
 
 }
@@ -953,7 +1073,15 @@ void  FileDatabase :: write_file()
 		f_name.insert(pos + 1,"_",1);
 	*/
 
-	f.open (f_name.c_str());
+//
+// Write a temporary file which replaces the resource file only once complete
+//
+
+	string tmp_name = f_name + ".tmp";
+	f.open (tmp_name.c_str());
+	if (f.good() == false)
+		return;
+
 	vector<t_tango_class *>::const_iterator it;
 	for(it = m_server.classes.begin(); it != m_server.classes.end(); ++it)
 	{
@@ -1115,6 +1243,153 @@ void  FileDatabase :: write_file()
 	}
 
 	f.close();
+	if (f.fail() == true)
+	{
+		::remove(tmp_name.c_str());
+		return;
+	}
+
+#ifdef _TG_WINDOWS_
+	::remove(f_name.c_str());
+#endif
+	if (::rename(tmp_name.c_str(),f_name.c_str()) != 0)
+	{
+		::remove(tmp_name.c_str());
+		return;
+	}
+
+//
+// The file now holds every update: The journal is not needed any more
+//
+
+	::remove(ext->journal_name.c_str());
+	ext->journal_nb = 0;
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :			FileDatabase::save_update() -
+//
+// description : 	Make a property update persistent. Instead of re-writing the
+//					whole file, the command input is appended to the journal
+//					file. The journal is compacted into the resource file once
+//					it has too many records (or at object destruction)
+//
+// argument : in : cmd_name : The updating command name
+//				   data_in : The command input data
+//
+//-----------------------------------------------------------------------------
+
+void FileDatabase::save_update(const char *cmd_name,const Tango::DevVarStringArray *data_in)
+{
+	if (ext->replaying == true)
+		return;
+
+	if (ext->journal_nb >= FILEDB_JOURNAL_MAX)
+	{
+		write_file();
+		return;
+	}
+
+//
+// Record is: <cmd name> <string nb>\n then for each string <length>\n<string>\n
+//
+
+	ofstream j(ext->journal_name.c_str(),ofstream::out | ofstream::app | ofstream::binary);
+	if (j.good() == true)
+	{
+		j << cmd_name << " " << data_in->length() << "\n";
+		for (unsigned int loop = 0;loop < data_in->length();loop++)
+		{
+			const char *str = (*data_in)[loop].in();
+			size_t l = ::strlen(str);
+			j << l << "\n";
+			j.write(str,l);
+			j << "\n";
+		}
+		j.close();
+	}
+
+	if (j.fail() == true)
+		write_file();
+	else
+		ext->journal_nb++;
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :			FileDatabase::replay_journal() -
+//
+// description : 	Re-apply to the freshly parsed file the updates recorded
+//					in the journal file, then compact the journal. A truncated
+//					last record (process killed while writing it) is ignored
+//
+//-----------------------------------------------------------------------------
+
+void FileDatabase::replay_journal()
+{
+	ifstream j(ext->journal_name.c_str(),ifstream::in | ifstream::binary);
+	if (j.good() == false)
+		return;
+
+	string cmd_name;
+	unsigned long nb_str;
+
+	ext->replaying = true;
+	while (j >> cmd_name >> nb_str)
+	{
+		j.get();
+
+		Tango::DevVarStringArray *data = new Tango::DevVarStringArray(nb_str);
+		data->length(nb_str);
+
+		unsigned long loop;
+		for (loop = 0;loop < nb_str;loop++)
+		{
+			size_t l;
+			if (!(j >> l))
+				break;
+			j.get();
+
+			string str(l,' ');
+			if (l != 0)
+				j.read(&str[0],l);
+			if ((size_t)j.gcount() != l && l != 0)
+				break;
+			j.get();
+			(*data)[loop] = CORBA::string_dup(str.c_str());
+		}
+
+		if (loop != nb_str)
+		{
+			delete data;
+			break;
+		}
+
+		CORBA::Any send;
+		send <<= data;
+
+		CORBA::Any *received = NULL;
+		if (cmd_name == "DbPutDeviceProperty")
+			received = DbPutDeviceProperty(send);
+		else if (cmd_name == "DbDeleteDeviceProperty")
+			received = DbDeleteDeviceProperty(send);
+		else if (cmd_name == "DbPutDeviceAttributeProperty")
+			received = DbPutDeviceAttributeProperty(send);
+		else if (cmd_name == "DbDeleteDeviceAttributeProperty")
+			received = DbDeleteDeviceAttributeProperty(send);
+		else if (cmd_name == "DbPutClassProperty")
+			received = DbPutClassProperty(send);
+		else if (cmd_name == "DbDeleteClassProperty")
+			received = DbDeleteClassProperty(send);
+		else if (cmd_name == "DbPutClassAttributeProperty")
+			received = DbPutClassAttributeProperty(send);
+		delete received;
+	}
+	ext->replaying = false;
+	j.close();
+
+	write_file();
 }
 
 
@@ -1269,7 +1544,7 @@ CORBA::Any*   FileDatabase :: DbPutDeviceProperty(CORBA::Any& send)
 	}
 
 
-	write_file();
+	save_update("DbPutDeviceProperty",data_in);
 	return any_ptr;
 };
 
@@ -1305,7 +1580,7 @@ CORBA::Any*   FileDatabase :: DbDeleteDeviceProperty(CORBA::Any& send)
 
 	CORBA::Any* any_ptr = new CORBA::Any;
 
-	write_file();
+	save_update("DbDeleteDeviceProperty",data_in);
 	return any_ptr;
 
 };
@@ -1464,7 +1739,7 @@ CORBA::Any*   FileDatabase :: DbPutDeviceAttributeProperty(CORBA::Any& send)
 						//(*dev_it)->attribute_properties[j]->properties[k]->value.push_back( string((*data_in)[index]) );index++;
 						if (index >= data_in->length())
 						{
-							write_file();
+							save_update("DbPutDeviceAttributeProperty",data_in);
 							return ret;
 						}
 						exist = true;
@@ -1486,7 +1761,7 @@ CORBA::Any*   FileDatabase :: DbPutDeviceAttributeProperty(CORBA::Any& send)
 					temp_attribute_property->properties.push_back(new_prop);
 					if (index >= data_in->length())
 					{
-							write_file();
+							save_update("DbPutDeviceAttributeProperty",data_in);
 							return ret;
 					}
 				}
@@ -1495,7 +1770,7 @@ CORBA::Any*   FileDatabase :: DbPutDeviceAttributeProperty(CORBA::Any& send)
 		}
 
 	}
-	write_file();
+	save_update("DbPutDeviceAttributeProperty",data_in);
 	return ret;
 };
 
@@ -1538,7 +1813,7 @@ CORBA::Any*   FileDatabase :: DbDeleteDeviceAttributeProperty(CORBA::Any& send)
 
 
 	CORBA::Any* ret = new CORBA::Any;
-	write_file();
+	save_update("DbDeleteDeviceAttributeProperty",data_in);
 	return ret;
 
 };
@@ -1693,7 +1968,7 @@ CORBA::Any*   FileDatabase :: DbPutClassProperty(CORBA::Any& send)
 				classe_trovata.properties.push_back(temp_property);
 				if (index >= data_in->length())
 				{
-					write_file();
+					save_update("DbPutClassProperty",data_in);
 					return ret;
 				}
 			}
@@ -1701,7 +1976,7 @@ CORBA::Any*   FileDatabase :: DbPutClassProperty(CORBA::Any& send)
 		}
 	}
 
-	write_file();
+	save_update("DbPutClassProperty",data_in);
 	return ret;
 };
 
@@ -1737,7 +2012,7 @@ CORBA::Any*   FileDatabase :: DbDeleteClassProperty(CORBA::Any& send)
 	}
 
 	CORBA::Any* ret = new CORBA::Any;
-	write_file();
+	save_update("DbDeleteClassProperty",data_in);
 	return ret;
 };
 
@@ -1892,7 +2167,7 @@ CORBA::Any*  FileDatabase :: DbPutClassAttributeProperty(CORBA::Any& send)
 						//(*dev_it)->attribute_properties[j]->properties[k]->value.push_back( string((*data_in)[index]) );index++;
 						if (index >= data_in->length())
 						{
-							write_file();
+							save_update("DbPutClassAttributeProperty",data_in);
 							return ret;
 						}
 						exist = true;
@@ -1914,7 +2189,7 @@ CORBA::Any*  FileDatabase :: DbPutClassAttributeProperty(CORBA::Any& send)
 					temp_attribute_property->properties.push_back(new_prop);
 					if (index >= data_in->length())
 					{
-							write_file();
+							save_update("DbPutClassAttributeProperty",data_in);
 							return ret;
 					}
 				}
@@ -1925,7 +2200,7 @@ CORBA::Any*  FileDatabase :: DbPutClassAttributeProperty(CORBA::Any& send)
 	}
 
 
-	write_file();
+	save_update("DbPutClassAttributeProperty",data_in);
 	return ret;
 };
 
@@ -109,6 +109,10 @@ public:
 
 	~FileDatabaseExt();
 
+	const char		*res_buf;			// Resource file content while parsing (mapped)
+	std::string		journal_name;		// Append-only update journal file name
+	int				journal_nb;			// Number of records in journal
+	bool			replaying;			// True while replaying the journal
 };
 
 
@@ -169,15 +173,18 @@ private:
 	string 			filename;
 	t_server 		m_server;
 
-	void read_char(std::ifstream& f);
+	void read_char();
 	int class_lex(std::string& word);
-	void  jump_line(std::ifstream& f);
-	void  jump_space(std::ifstream& f);
-	std::string read_word(std::ifstream& f);
+	void  jump_line();
+	void  jump_space();
+	std::string read_word();
 	void CHECK_LEX(int lt,int le);
-	std::vector<std::string> parse_resource_value(std::ifstream& f);
+	std::vector<std::string> parse_resource_value();
 
-	std::string read_full_word(std::ifstream& f);
+	std::string read_full_word();
+
+	void save_update(const char *,const Tango::DevVarStringArray *);
+	void replay_journal();
 
 
 	static const char* lexical_word_null;
@@ -658,7 +658,7 @@ GroupElement* GroupElement::set_parent (GroupElement* _parent)
 // class Group
 //=============================================================================
 Group::Group (const std::string& name)
-  : GroupElement(name), asynch_req_id(0)
+  : GroupElement(name), asynch_req_id(0), fan_in(false)
 {
   //- noop ctor
 }
@@ -667,6 +667,12 @@ Group::~Group ()
 {
   remove_all();
   arp.clear();
+  fan_in_req.clear();
+  GroupFanInAdmRepIterator it = fan_in_adm.begin();
+  for (; it != fan_in_adm.end(); ++it) {
+    delete it->second.first;
+  }
+  fan_in_adm.clear();
 }
 //-----------------------------------------------------------------------------
 Group * Group::get_parent () const
@@ -1239,9 +1245,15 @@ long Group::read_attribute_asynch_i (const std::string& a, bool fwd, long id)
   if (id == -1) {
     id = next_asynch_request_id();
   }
+  fan_in_read_asynch_i(std::vector<std::string>(1, a), id);
+  GroupFanInRequestRepIterator fi = fan_in_req.find(id);
   GroupElementsIterator it = elements.begin();
   GroupElementsIterator end = elements.end();
   for (; it != end; ++it) {
+    if (fi != fan_in_req.end() && fi->second.index.count(*it)) {
+      //- read through its device server (see fan_in_read_asynch_i)
+      continue;
+    }
     if ((*it)->is_device_i() || fwd) {
       id = (*it)->read_attribute_asynch_i(a, fwd, id);
     }
@@ -1275,7 +1287,14 @@ GroupAttrReplyList Group::read_attribute_reply_i (long ari, long tmo)
   GroupElementsIterator it = elements.begin();
   GroupElementsIterator end = elements.end();
   for (; it != end; ++it) {
-    if ((*it)->is_device_i() || r->second) {
+    if (fan_in_read_reply_i(ari, *it, tmo, sub_reply)) {
+      reply.insert(reply.end(), sub_reply.begin(), sub_reply.end());
+      if (sub_reply.has_failed_m) {
+        reply.has_failed_m = true;
+      }
+      sub_reply.reset();
+    }
+    else if ((*it)->is_device_i() || r->second) {
       sub_reply = (*it)->read_attribute_reply_i(ari, tmo);
       if (sub_reply.empty() == false) {
         reply.insert(reply.end(), sub_reply.begin(), sub_reply.end());
@@ -1287,6 +1306,7 @@ GroupAttrReplyList Group::read_attribute_reply_i (long ari, long tmo)
     }
   }
   arp.erase(r);
+  fan_in_req.erase(ari);
   return reply;
 }
 //-----------------------------------------------------------------------------
@@ -1303,9 +1323,15 @@ long Group::read_attributes_asynch_i (const std::vector<std::string>& al, bool f
   if (id == -1) {
     id = next_asynch_request_id();
   }
+  fan_in_read_asynch_i(al, id);
+  GroupFanInRequestRepIterator fi = fan_in_req.find(id);
   GroupElementsIterator it = elements.begin();
   GroupElementsIterator end = elements.end();
   for (; it != end; ++it) {
+    if (fi != fan_in_req.end() && fi->second.index.count(*it)) {
+      //- read through its device server (see fan_in_read_asynch_i)
+      continue;
+    }
     if ((*it)->is_device_i() || fwd) {
       id = (*it)->read_attributes_asynch_i(al, fwd, id);
     }
@@ -1339,7 +1365,14 @@ GroupAttrReplyList Group::read_attributes_reply_i (long ari, long tmo)
   GroupElementsIterator it = elements.begin();
   GroupElementsIterator end = elements.end();
   for (; it != end; ++it) {
-    if ((*it)->is_device_i() || r->second) {
+    if (fan_in_read_reply_i(ari, *it, tmo, sub_reply)) {
+      reply.insert(reply.end(), sub_reply.begin(), sub_reply.end());
+      if (sub_reply.has_failed_m) {
+        reply.has_failed_m = true;
+      }
+      sub_reply.reset();
+    }
+    else if ((*it)->is_device_i() || r->second) {
       sub_reply = (*it)->read_attributes_reply_i(ari, tmo);
       if (sub_reply.empty() == false) {
         reply.insert(reply.end(), sub_reply.begin(), sub_reply.end());
@@ -1351,9 +1384,297 @@ GroupAttrReplyList Group::read_attributes_reply_i (long ari, long tmo)
     }
   }
   arp.erase(r);
+  fan_in_req.erase(ari);
   return reply;
 }
 //-----------------------------------------------------------------------------
+void Group::enable_server_fan_in (bool enable, bool fwd)
+{
+#ifdef TANGO_GROUP_HAS_THREAD_SAFE_IMPL
+  omni_mutex_lock guard(elements_mutex);
+#endif
+  fan_in = enable;
+  if (fwd) {
+    GroupElementsIterator it = elements.begin();
+    GroupElementsIterator end = elements.end();
+    for (; it != end; ++it) {
+      if ((*it)->is_group_i()) {
+        (static_cast<Group*>(*it))->enable_server_fan_in(enable, fwd);
+      }
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+void Group::fan_in_read_asynch_i (const std::vector<std::string>& al, long id)
+{
+  if (! fan_in) {
+    return;
+  }
+  //- sort the enabled device members by device server (admin device)
+  std::map<std::string, std::vector<GroupDeviceElement*> > servers;
+  GroupElementsIterator it = elements.begin();
+  GroupElementsIterator end = elements.end();
+  for (; it != end; ++it) {
+    if (! (*it)->is_device_i() || ! (*it)->is_enabled()) {
+      continue;
+    }
+    GroupDeviceElement* de = static_cast<GroupDeviceElement*>(*it);
+    try {
+      if (de->dev_proxy()->get_idl_version() >= 4) {
+        servers[de->get_adm_name()].push_back(de);
+      }
+    }
+    catch (...) {
+      //- ignore error: the member is read (and reports the error) the usual way
+    }
+  }
+  //- send one request per server hosting enough members (and per MULTI_DEV_READ_MAX_DEV members)
+  GroupFanInRequest rq;
+  rq.obj_names = al;
+  std::map<std::string, std::vector<GroupDeviceElement*> >::iterator sit = servers.begin();
+  for (; sit != servers.end(); ++sit) {
+    if (sit->second.size() < GROUP_FAN_IN_MIN_DEV) {
+      continue;
+    }
+    GroupFanInAdmRepIterator ait = fan_in_adm.find(sit->first);
+    if (ait == fan_in_adm.end()) {
+      try {
+        DeviceProxy* adm = new DeviceProxy(const_cast<std::string&>(sit->first));
+        adm->set_transparency_reconnection(true);
+        ait = fan_in_adm.insert(GroupFanInAdmRep::value_type(sit->first, std::make_pair(adm, true))).first;
+      }
+      catch (...) {
+        continue;
+      }
+    }
+    if (! ait->second.second) {
+      continue;
+    }
+    size_t first;
+    for (first = 0; first < sit->second.size(); first += MULTI_DEV_READ_MAX_DEV) {
+      size_t last = first + MULTI_DEV_READ_MAX_DEV;
+      if (last > sit->second.size()) {
+        last = sit->second.size();
+      }
+      if (last - first < GROUP_FAN_IN_MIN_DEV) {
+        //- too few members left: they are read the usual way
+        break;
+      }
+      GroupFanInBatch b;
+      b.adm = ait->second.first;
+      b.rq_id = -1;
+      b.members.assign(sit->second.begin() + first, sit->second.begin() + last);
+      b.replied = false;
+      b.failed = false;
+      b.has_error = false;
+      std::vector<GroupDeviceElement*>& members = b.members;
+      //- argin: source, attribute number, attribute names then device names
+      DevVarLongStringArray in;
+      in.lvalue.length(2);
+      in.svalue.length(al.size() + members.size());
+      in.lvalue[1] = al.size();
+      size_t i;
+      for (i = 0; i < al.size(); i++) {
+        in.svalue[i] = CORBA::string_dup(al[i].c_str());
+      }
+      int tmo_ms = 0;
+      try {
+        in.lvalue[0] = members[0]->dev_proxy()->get_source();
+        for (i = 0; i < members.size(); i++) {
+          in.svalue[al.size() + i] = CORBA::string_dup(members[i]->dev_proxy()->dev_name().c_str());
+          int m_tmo = members[i]->dev_proxy()->get_timeout_millis();
+          if (m_tmo > tmo_ms) {
+            tmo_ms = m_tmo;
+          }
+        }
+        //- the server reads the members in parallel
+        b.adm->set_timeout_millis(tmo_ms);
+        DeviceData din;
+        din << in;
+        b.rq_id = b.adm->command_inout_asynch("ReadAttrMultiDev", din);
+      }
+      catch (...) {
+        //- read the members one by one
+        fan_in_fallback_i(rq, b);
+      }
+      size_t bi = rq.batches.size();
+      for (i = 0; i < members.size(); i++) {
+        rq.index[members[i]] = std::make_pair(bi, i);
+      }
+      rq.batches.push_back(b);
+    }
+  }
+  if (! rq.batches.empty()) {
+    fan_in_req[id] = rq;
+  }
+}
+//-----------------------------------------------------------------------------
+void Group::fan_in_fallback_i (GroupFanInRequest& rq, GroupFanInBatch& b)
+{
+  b.failed = true;
+  b.replied = true;
+  b.values.clear();
+  b.member_rq_ids.assign(b.members.size(), -1);
+  b.member_rq_ex.resize(b.members.size());
+  for (size_t i = 0; i < b.members.size(); i++) {
+    try {
+      b.member_rq_ids[i] = b.members[i]->dev_proxy()->read_attributes_asynch(rq.obj_names);
+    }
+    catch (const Tango::DevFailed& df) {
+      b.member_rq_ex[i] = df;
+    }
+    catch (...) {
+      Tango::DevErrorList errors(1);
+		  errors.length(1);
+		  errors[0].severity = Tango::ERR;
+		  errors[0].desc = CORBA::string_dup("unknown error");
+		  errors[0].reason = CORBA::string_dup("unknown exception caught");
+		  errors[0].origin = CORBA::string_dup("Group::read_attribute_asynch");
+      b.member_rq_ex[i] = DevFailed(errors);
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+void Group::fan_in_get_reply_i (GroupFanInRequest& rq, GroupFanInBatch& b, long tmo)
+{
+  b.replied = true;
+  if (b.rq_id == -1) {
+    return;
+  }
+  size_t nb_val = b.members.size() * rq.obj_names.size();
+  try
+  {
+    DeviceData dout = b.adm->command_inout_reply(b.rq_id, tmo);
+    const DevEncoded* enc;
+    dout >> enc;
+    //- the reply is a CDR encapsulated AttributeValueList_4
+    cdrEncapsulationStream cdr(enc->encoded_data.get_buffer(), enc->encoded_data.length(), true);
+    AttributeValueList_4 avl;
+    avl <<= cdr;
+    if (::strcmp(enc->encoded_format.in(), MULTI_DEV_READ_FORMAT) != 0 || avl.length() != nb_val)
+    {
+      Tango::DevErrorList errors(1);
+		  errors.length(1);
+		  errors[0].severity = Tango::ERR;
+		  errors[0].desc = CORBA::string_dup("ReadAttrMultiDev returned an unexpected reply");
+		  errors[0].reason = CORBA::string_dup("API_IncoherentValues");
+		  errors[0].origin = CORBA::string_dup("Group::read_attribute_reply");
+      throw DevFailed(errors);
+    }
+    b.values.resize(nb_val);
+    for (size_t i = 0; i < nb_val; i++) {
+      ApiUtil::attr_to_device(&(avl[i]), 4, &(b.values[i]));
+    }
+  }
+  catch (const Tango::DevFailed& df)
+  {
+    b.values.clear();
+    if (::strcmp(df.errors[0].reason.in(), "API_CommandNotFound") == 0 ||
+        ::strcmp(df.errors[0].reason.in(), "API_ReadOnlyMode") == 0) {
+      //- old server or admin device not writable for this client: remember it and
+      //- read the members one by one
+      GroupFanInAdmRepIterator ait = fan_in_adm.begin();
+      for (; ait != fan_in_adm.end(); ++ait) {
+        if (ait->second.first == b.adm) {
+          ait->second.second = false;
+        }
+      }
+      fan_in_fallback_i(rq, b);
+    }
+    else {
+      //- any other error (timeout included) is the reply of each member
+      b.has_error = true;
+      b.rq_ex = df;
+      if (::strcmp(df.errors[0].reason.in(), "API_AsynReplyNotArrived") == 0) {
+        //- the reply will never be asked for again: drop the request
+        try {
+          b.adm->cancel_asynch_request(b.rq_id);
+        }
+        catch (...) {}
+      }
+    }
+  }
+  catch (...)
+  {
+    Tango::DevErrorList errors(1);
+		errors.length(1);
+		errors[0].severity = Tango::ERR;
+		errors[0].desc = CORBA::string_dup("unknown error");
+		errors[0].reason = CORBA::string_dup("unknown exception caught");
+		errors[0].origin = CORBA::string_dup("Group::read_attribute_reply");
+    b.values.clear();
+    b.has_error = true;
+    b.rq_ex = DevFailed(errors);
+  }
+}
+//-----------------------------------------------------------------------------
+bool Group::fan_in_read_reply_i (long id, GroupElement* e, long tmo, GroupAttrReplyList& rl)
+{
+  GroupFanInRequestRepIterator r = fan_in_req.find(id);
+  if (r == fan_in_req.end()) {
+    return false;
+  }
+  GroupFanInRequest& rq = r->second;
+  std::map<GroupElement*, std::pair<size_t, size_t> >::iterator ix = rq.index.find(e);
+  if (ix == rq.index.end()) {
+    return false;
+  }
+  GroupFanInBatch& b = rq.batches[ix->second.first];
+  size_t pos = ix->second.second;
+  size_t nb_attr = rq.obj_names.size();
+  size_t a;
+  if (! b.replied) {
+    fan_in_get_reply_i(rq, b, tmo);
+  }
+  //- multi-device read failed: the error is the reply of each member
+  if (b.has_error) {
+    for (a = 0; a < nb_attr; a++) {
+      rl.push_back(GroupAttrReply(e->get_name(), rq.obj_names[a], b.rq_ex));
+    }
+    return true;
+  }
+  //- multi-device read not supported: get the reply of this member on its own
+  if (b.failed) {
+    if (b.member_rq_ids[pos] == -1) {
+      for (a = 0; a < nb_attr; a++) {
+        rl.push_back(GroupAttrReply(e->get_name(), rq.obj_names[a], b.member_rq_ex[pos]));
+      }
+      return true;
+    }
+    try {
+      std::vector<DeviceAttribute>* dal = b.members[pos]->dev_proxy()->read_attributes_reply(b.member_rq_ids[pos], tmo);
+      for (a = 0; a < nb_attr && a < dal->size(); a++) {
+        if ((*dal)[a].has_failed()) {
+          DevFailed df((*dal)[a].get_err_stack());
+          rl.push_back(GroupAttrReply(e->get_name(), rq.obj_names[a], df));
+        }
+        else {
+          rl.push_back(GroupAttrReply(e->get_name(), rq.obj_names[a], (*dal)[a]));
+        }
+      }
+      delete dal;
+    }
+    catch (const Tango::DevFailed& df) {
+      for (a = 0; a < nb_attr; a++) {
+        rl.push_back(GroupAttrReply(e->get_name(), rq.obj_names[a], df));
+      }
+    }
+    return true;
+  }
+  //- scatter the values
+  for (a = 0; a < nb_attr; a++) {
+    DeviceAttribute& da = b.values[(pos * nb_attr) + a];
+    if (da.has_failed()) {
+      DevFailed df(da.get_err_stack());
+      rl.push_back(GroupAttrReply(e->get_name(), rq.obj_names[a], df));
+    }
+    else {
+      rl.push_back(GroupAttrReply(e->get_name(), rq.obj_names[a], da));
+    }
+  }
+  return true;
+}
+//-----------------------------------------------------------------------------
 GroupReplyList Group::write_attribute (const DeviceAttribute& d, bool fwd)
 {
   long id = write_attribute_asynch_i(d, fwd, -1);
@@ -1631,6 +1952,16 @@ void GroupDeviceElement::disconnect ()
     delete dp;
     dp = 0;
   }
+  adm_name.clear();
+}
+//-----------------------------------------------------------------------------
+const std::string& GroupDeviceElement::get_adm_name ()
+{
+  if (adm_name.empty()) {
+    adm_name = dev_proxy()->adm_name();
+    std::transform(adm_name.begin(), adm_name.end(), adm_name.begin(), ::tolower);
+  }
+  return adm_name;
 }
 //-----------------------------------------------------------------------------
 bool GroupDeviceElement::ping (bool)
@@ -120,6 +120,52 @@ typedef AsynchRequestRep::iterator AsynchRequestRepIterator;
 typedef AsynchRequestRep::value_type AsynchRequestRepValue;
 //=============================================================================
 
+//=============================================================================
+// struct GroupFanInBatch : one multi-device read sent to a device server
+//-----------------------------------------------------------------------------
+class GroupDeviceElement;
+//-
+struct GroupFanInBatch
+{
+  //- admin device of the server
+  DeviceProxy* adm;
+  //- asynch. request id on the admin device (-1 if the request failed)
+  long rq_id;
+  //- group members read by this request (in request order)
+  std::vector<GroupDeviceElement*> members;
+  //- true once the reply has been received (or the request has failed)
+  bool replied;
+  //- true if the server cannot run the multi-device read (members are then read one by one)
+  bool failed;
+  //- per member asynch. request id when read one by one (-1 if the request failed)
+  std::vector<long> member_rq_ids;
+  //- per member exception thrown when the request was sent
+  std::vector<DevFailed> member_rq_ex;
+  //- true if the multi-device read returned an error (reported for each member)
+  bool has_error;
+  //- the multi-device read error
+  DevFailed rq_ex;
+  //- received values (members x attributes)
+  std::vector<DeviceAttribute> values;
+};
+//-
+struct GroupFanInRequest
+{
+  //- name of requested attributes
+  std::vector<std::string> obj_names;
+  //- one batch per device server
+  std::vector<GroupFanInBatch> batches;
+  //- group member -> (batch index, position in batch)
+  std::map<GroupElement*, std::pair<size_t, size_t> > index;
+};
+//- fan-in request repository (group asynch. request id -> request)
+typedef std::map<long, GroupFanInRequest> GroupFanInRequestRep;
+typedef GroupFanInRequestRep::iterator GroupFanInRequestRepIterator;
+//- admin device proxies (admin device name -> proxy + multi-device read supported)
+typedef std::map<std::string, std::pair<DeviceProxy*, bool> > GroupFanInAdmRep;
+typedef GroupFanInAdmRep::iterator GroupFanInAdmRepIterator;
+//=============================================================================
+
 //=============================================================================
 // class GroupReply : base class for group reply
 //=============================================================================
@@ -591,6 +637,9 @@ public:
   GroupAttrReplyList read_attribute_reply (long req_id, long tmo_ms = 0);
   //-
   GroupAttrReplyList read_attributes_reply (long req_id, long tmo_ms = 0);
+  //- read members hosted by the same device server with one request
+  //- per server (requires the ReadAttrMultiDev admin command)
+  void enable_server_fan_in (bool enable, bool fwd = true);
 
   //- attribute writting
   //---------------------------------------------
@@ -653,6 +702,12 @@ private:
   AsynchRequestDesc arp;
   //- pseudo asynch. req. id generator
   long asynch_req_id;
+  //- per device server fan-in of attribute reads
+  bool fan_in;
+  //- fan-in pending requests
+  GroupFanInRequestRep fan_in_req;
+  //- fan-in admin devices
+  GroupFanInAdmRep fan_in_adm;
 
   //- forbidden methods
   Group ();
@@ -672,6 +727,12 @@ private:
   virtual long read_attributes_asynch_i (const std::vector<std::string>& al, bool fwd, long ari);
   virtual GroupAttrReplyList read_attributes_reply_i (long req_id, long tmo_ms);
 
+  //- fan-in part of the asynch attribute reading
+  void fan_in_read_asynch_i (const std::vector<std::string>& al, long ari);
+  bool fan_in_read_reply_i (long ari, GroupElement* e, long tmo_ms, GroupAttrReplyList& rl);
+  void fan_in_get_reply_i (GroupFanInRequest& rq, GroupFanInBatch& b, long tmo_ms);
+  void fan_in_fallback_i (GroupFanInRequest& rq, GroupFanInBatch& b);
+
   virtual long write_attribute_asynch_i (const DeviceAttribute& d, bool fwd, long ari);
   virtual long write_attribute_asynch_i (const std::vector<DeviceAttribute>& d, bool fwd, long ari);
   template<typename T> long write_attribute_asynch_i (const std::string& a, /*const*/ std::vector<T>& d, bool fwd, long ari);
@@ -719,6 +780,8 @@ private:
   DeviceProxy *dp;
   //- asynch request repository
   AsynchRequestRep arp;
+  //- name of the device admin device (lazily set by get_adm_name)
+  std::string adm_name;
 
   //- forbidden methods
   GroupDeviceElement ();
@@ -742,6 +805,9 @@ private:
     return dp ? dp : connect();
   }
 
+  //- the device admin device name (may throw DevFailed)
+  const std::string& get_adm_name ();
+
   //- element identification
   virtual bool is_device_i ();
   virtual bool is_group_i ();
@@ -603,6 +603,7 @@ void NotifdEventConsumer::connect_event_channel(string &channel_name,Database *d
 		new_event_channel_struct.channel_monitor = new TangoMonitor();
 		// set the timeout for the channel monitor to 500ms not to block the event consumer for to long.
 		new_event_channel_struct.channel_monitor->timeout(500);
+		new_event_channel_struct.bulk_subscription = false;
 		set_channel_type(new_event_channel_struct);
 
 		channel_map[channel_name] = new_event_channel_struct;
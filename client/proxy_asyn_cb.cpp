@@ -217,7 +217,9 @@ void Connection::get_asynch_replies()
 					break;
 				}
 
+				CallBack *cb = tg_req.cb_ptr;
 				remove_asyn_cb_request(this,req);
+				AsynCompletionQueue::publish(cb);
 			}
 		}
 
@@ -252,7 +254,9 @@ void Connection::get_asynch_replies()
 			break;
 		}
 
+		CallBack *cb = tg_ptr->cb_ptr;
 		remove_asyn_cb_request(this,tg_ptr->request);
+		AsynCompletionQueue::publish(cb);
 	}
 
 }
@@ -927,7 +931,9 @@ void Connection::get_asynch_replies(long call_timeout)
 			break;
 		}
 
+		CallBack *cb = tg_ptr->cb_ptr;
 		remove_asyn_cb_request(this,tg_ptr->request);
+		AsynCompletionQueue::publish(cb);
 	}
 
 //
@@ -998,7 +1004,9 @@ void Connection::get_asynch_replies(long call_timeout)
 							break;
 						}
 
+						CallBack *cb = tg_req.cb_ptr;
 						remove_asyn_cb_request(this,req);
+						AsynCompletionQueue::publish(cb);
 					}
 				}
 			}
@@ -1060,7 +1068,9 @@ void Connection::get_asynch_replies(long call_timeout)
 						break;
 					}
 
+					CallBack *cb = tg_req.cb_ptr;
 					remove_asyn_cb_request(this,req);
+					AsynCompletionQueue::publish(cb);
 				}
 			}
 		}
@@ -1367,4 +1377,371 @@ void DeviceProxy::write_attribute_asynch(DeviceAttribute &attr,CallBack &cb)
 }
 
 
+//-----------------------------------------------------------------------------
+//
+// AsynCompletionCb class : The callback object used for each request sent
+//			    through a completion queue. When fired, it only
+//			    copies the reply into its completion. The library
+//			    still uses the device and the request after the
+//			    callback, so the completion is pushed into the
+//			    queue (and the callback deleted) later, by
+//			    AsynCompletionQueue::publish()
+//
+//-----------------------------------------------------------------------------
+
+class AsynCompletionCb: public CallBack
+{
+public:
+	AsynCompletionCb(AsynCompletionQueue *q,AsynCompletion *c):queue(q),comp(c) {};
+	virtual ~AsynCompletionCb() {};
+
+	virtual void cmd_ended(CmdDoneEvent *);
+	virtual void attr_read(AttrReadEvent *);
+	virtual void attr_written(AttrWrittenEvent *);
+
+	AsynCompletionQueue	*queue;
+	AsynCompletion		*comp;
+};
+
+void AsynCompletionCb::cmd_ended(CmdDoneEvent *ev)
+{
+	comp->err = ev->err;
+	if (ev->err == true)
+		comp->errors = ev->errors;
+	else
+	{
+		comp->cmd_data = new DeviceData();
+		comp->cmd_data->any = ev->argout.any._retn();
+	}
+
+	AsynCompletionQueue::stage(this);
+}
+
+void AsynCompletionCb::attr_read(AttrReadEvent *ev)
+{
+	comp->err = ev->err;
+	comp->errors = ev->errors;
+	comp->attr_data = ev->argout;
+
+	AsynCompletionQueue::stage(this);
+}
+
+void AsynCompletionCb::attr_written(AttrWrittenEvent *ev)
+{
+	comp->err = ev->err;
+	if (ev->err == true)
+	{
+		comp->errors = ev->errors.errors;
+		comp->err_list = ev->errors.err_list;
+	}
+
+	AsynCompletionQueue::stage(this);
+}
+
+//-----------------------------------------------------------------------------
+//
+// AsynCompletion::AsynCompletion() - The result of one request sent through
+//				      a completion queue. The caller gets it
+//				      from AsynCompletionQueue::get_completion()
+//				      and deletes it (with its data)
+//
+//-----------------------------------------------------------------------------
+
+AsynCompletion::AsynCompletion(long t,CompletionType ty,Tango::DeviceProxy *dev)
+:tag(t),type(ty),device(dev),cmd_data(NULL),attr_data(NULL),err(false)
+{
+}
+
+AsynCompletion::~AsynCompletion()
+{
+	delete cmd_data;
+	delete attr_data;
+}
+
+//-----------------------------------------------------------------------------
+//
+// AsynCompletionQueue::AsynCompletionQueue() - A completion queue. Requests
+//				sent through it are all answered in the
+//				queue, in their completion order, whatever the
+//				device. The replies are received by the API
+//				callback thread: the constructor switches the
+//				process-wide asynchronous callback sub-model to
+//				PUSH_CALLBACK. It refuses to do it if callback
+//				requests sent in PULL_CALLBACK mode are still
+//				waiting for ApiUtil::get_asynch_replies(): they
+//				would then be fired by the callback thread
+//
+//-----------------------------------------------------------------------------
+
+AsynCompletionQueue::AsynCompletionQueue():pending(0),cond(this)
+{
+	ApiUtil *au = ApiUtil::instance();
+	if (au->get_asynch_cb_sub_model() != PUSH_CALLBACK)
+	{
+		if (au->pending_asynch_call(CALL_BACK) != 0)
+		{
+			TangoSys_OMemStream desc;
+			desc << "Some asynchronous callback request(s) sent in PULL_CALLBACK mode are still waiting for their replies." << endl;
+			desc << "Get them with ApiUtil::get_asynch_replies() before creating a completion queue" << ends;
+			ApiAsynExcept::throw_exception((const char *)"API_PullCallbackPending",
+						       desc.str(),
+						       (const char *)"AsynCompletionQueue::AsynCompletionQueue()");
+		}
+		au->set_asynch_cb_sub_model(PUSH_CALLBACK);
+	}
+}
+
+//-----------------------------------------------------------------------------
+//
+// AsynCompletionQueue::~AsynCompletionQueue() - Wait for requests still
+//				waiting for their replies (their callback
+//				refers to this queue) and delete replies not
+//				taken by the caller
+//
+//-----------------------------------------------------------------------------
+
+AsynCompletionQueue::~AsynCompletionQueue()
+{
+	omni_mutex_lock sync(*this);
+
+	while (pending != 0)
+		cond.wait();
+
+	while (completed.empty() == false)
+	{
+		delete completed.front();
+		completed.pop_front();
+	}
+}
+
+//-----------------------------------------------------------------------------
+//
+// AsynCompletionQueue::command_inout() etc - Send a request. Each request
+//				gets exactly one completion, also when it
+//				cannot be sent (the error is then in the
+//				completion)
+//
+// argin(s) :		dev : The device
+//			... : The request parameters (see DeviceProxy)
+//			tag : A user value returned in the completion
+//
+//-----------------------------------------------------------------------------
+
+void AsynCompletionQueue::command_inout(Tango::DeviceProxy *dev,const char *cmd,DeviceData &data_in,long tag)
+{
+	AsynCompletion *comp = new AsynCompletion(tag,AsynCompletion::CMD_INOUT,dev);
+	comp->obj_names.push_back(cmd);
+	AsynCompletionCb *cb = new AsynCompletionCb(this,comp);
+
+	{
+		omni_mutex_lock sync(*this);
+		pending++;
+	}
+
+	try
+	{
+		dev->command_inout_asynch(cmd,data_in,*cb);
+	}
+	catch (DevFailed &e)
+	{
+		delete cb;
+		push_error(comp,e);
+	}
+}
+
+void AsynCompletionQueue::command_inout(Tango::DeviceProxy *dev,const char *cmd,long tag)
+{
+	DeviceData data_in;
+	command_inout(dev,cmd,data_in,tag);
+}
+
+void AsynCompletionQueue::read_attribute(Tango::DeviceProxy *dev,const char *att_name,long tag)
+{
+	vector<string> names(1,att_name);
+	read_attributes(dev,names,tag);
+}
+
+void AsynCompletionQueue::read_attributes(Tango::DeviceProxy *dev,vector<string> &att_names,long tag)
+{
+	AsynCompletion *comp = new AsynCompletion(tag,AsynCompletion::READ_ATTR,dev);
+	comp->obj_names = att_names;
+	AsynCompletionCb *cb = new AsynCompletionCb(this,comp);
+
+	{
+		omni_mutex_lock sync(*this);
+		pending++;
+	}
+
+	try
+	{
+		dev->read_attributes_asynch(att_names,*cb);
+	}
+	catch (DevFailed &e)
+	{
+		delete cb;
+		push_error(comp,e);
+	}
+}
+
+void AsynCompletionQueue::write_attribute(Tango::DeviceProxy *dev,DeviceAttribute &attr,long tag)
+{
+	AsynCompletion *comp = new AsynCompletion(tag,AsynCompletion::WRITE_ATTR,dev);
+	comp->obj_names.push_back(attr.get_name());
+	AsynCompletionCb *cb = new AsynCompletionCb(this,comp);
+
+	{
+		omni_mutex_lock sync(*this);
+		pending++;
+	}
+
+	try
+	{
+		dev->write_attribute_asynch(attr,*cb);
+	}
+	catch (DevFailed &e)
+	{
+		delete cb;
+		push_error(comp,e);
+	}
+}
+
+void AsynCompletionQueue::write_attributes(Tango::DeviceProxy *dev,vector<DeviceAttribute> &attrs,long tag)
+{
+	AsynCompletion *comp = new AsynCompletion(tag,AsynCompletion::WRITE_ATTR,dev);
+	for (unsigned int i = 0;i < attrs.size();i++)
+		comp->obj_names.push_back(attrs[i].get_name());
+	AsynCompletionCb *cb = new AsynCompletionCb(this,comp);
+
+	{
+		omni_mutex_lock sync(*this);
+		pending++;
+	}
+
+	try
+	{
+		dev->write_attributes_asynch(attrs,*cb);
+	}
+	catch (DevFailed &e)
+	{
+		delete cb;
+		push_error(comp,e);
+	}
+}
+
+//-----------------------------------------------------------------------------
+//
+// AsynCompletionQueue::stage() - Remember a fired completion callback until
+//				the library has finished with its request
+//
+// AsynCompletionQueue::publish() - Called by the library once a fired request
+//				is removed from the asynchronous request table
+//				(the device is not used any more). If the
+//				callback belongs to a completion queue, push
+//				its completion and delete it. Other callbacks
+//				are left untouched.
+//				From this point, the caller of get_completion()
+//				may delete the device
+//
+//-----------------------------------------------------------------------------
+
+omni_mutex AsynCompletionQueue::staged_mutex;
+set<CallBack *> AsynCompletionQueue::staged_cb;
+
+void AsynCompletionQueue::stage(CallBack *cb)
+{
+	omni_mutex_lock sync(staged_mutex);
+	staged_cb.insert(cb);
+}
+
+void AsynCompletionQueue::publish(CallBack *cb)
+{
+	{
+		omni_mutex_lock sync(staged_mutex);
+
+		set<CallBack *>::iterator ite = staged_cb.find(cb);
+		if (ite == staged_cb.end())
+			return;
+		staged_cb.erase(ite);
+	}
+
+	AsynCompletionCb *comp_cb = static_cast<AsynCompletionCb *>(cb);
+	comp_cb->queue->push_completion(comp_cb->comp);
+	delete comp_cb;
+}
+
+//-----------------------------------------------------------------------------
+//
+// AsynCompletionQueue::push_completion() - Store a completed request and
+//				wake up the caller(s) waiting in
+//				get_completion()
+//
+//-----------------------------------------------------------------------------
+
+void AsynCompletionQueue::push_completion(AsynCompletion *comp)
+{
+	omni_mutex_lock sync(*this);
+
+	completed.push_back(comp);
+	pending--;
+	cond.broadcast();
+}
+
+void AsynCompletionQueue::push_error(AsynCompletion *comp,DevFailed &e)
+{
+	comp->err = true;
+	comp->errors = e.errors;
+	push_completion(comp);
+}
+
+//-----------------------------------------------------------------------------
+//
+// AsynCompletionQueue::get_completion() - Return the oldest completed
+//				request. The caller has to delete it.
+//
+// argin(s) :		timeout : Max time to wait for a completion (mS).
+//				  0 means wait until one arrives
+//
+// return :		The completion or NULL if the timeout expired or if
+//			there is no request waiting for its reply
+//
+//-----------------------------------------------------------------------------
+
+AsynCompletion *AsynCompletionQueue::get_completion(long timeout)
+{
+	omni_mutex_lock sync(*this);
+
+	if (completed.empty() == true)
+	{
+		if (timeout == 0)
+		{
+			while ((completed.empty() == true) && (pending != 0))
+				cond.wait();
+		}
+		else
+		{
+			unsigned long s,n;
+
+			unsigned long nb_sec,nb_nanos;
+			nb_sec = timeout / 1000;
+			nb_nanos = (timeout - (nb_sec * 1000)) * 1000000;
+
+			omni_thread::get_time(&s,&n,nb_sec,nb_nanos);
+			while ((completed.empty() == true) && (pending != 0))
+			{
+				if (cond.timedwait(s,n) == 0)
+					break;
+			}
+		}
+
+		if (completed.empty() == true)
+			return NULL;
+	}
+
+	AsynCompletion *comp = completed.front();
+	completed.pop_front();
+
+	return comp;
+}
+
+
 } // End of Tango namespace
@@ -68,7 +68,8 @@ ZmqEventConsumer *ZmqEventConsumer::_instance = NULL;
 /*		       															*/
 /************************************************************************/
 
-ZmqEventConsumer::ZmqEventConsumer(ApiUtil *ptr) : EventConsumer(ptr),omni_thread((void *)ptr),zmq_context(1)
+ZmqEventConsumer::ZmqEventConsumer(ApiUtil *ptr) : EventConsumer(ptr),omni_thread((void *)ptr),zmq_context(1),
+dispatch_cond(&dispatch_mutex),dispatch_exit(false)
 {
 	cout3 << "calling Tango::ZmqEventConsumer::ZmqEventConsumer() \n";
 
@@ -273,28 +274,33 @@ void *ZmqEventConsumer::run_undetached(TANGO_UNUSED(void *arg))
                     continue;
                 }
 
-                res = event_sub_sock->recv(&received_endian,ZMQ_DONTWAIT);
-                if (res == false)
+                if (is_event_batch(received_event_name) == true)
+                    process_event_batch();
+                else
                 {
-                    print_error_message("Second Zmq recv call on event socket returned false! De-synchronized event system?");
-                    continue;
-                }
+                    res = event_sub_sock->recv(&received_endian,ZMQ_DONTWAIT);
+                    if (res == false)
+                    {
+                        print_error_message("Second Zmq recv call on event socket returned false! De-synchronized event system?");
+                        continue;
+                    }
 
-                res = event_sub_sock->recv(&received_call,ZMQ_DONTWAIT);
-                if (res == false)
-                {
-                    print_error_message("Third Zmq recv call on event socket returned false! De-synchronized event system?");
-                    continue;
-                }
+                    res = event_sub_sock->recv(&received_call,ZMQ_DONTWAIT);
+                    if (res == false)
+                    {
+                        print_error_message("Third Zmq recv call on event socket returned false! De-synchronized event system?");
+                        continue;
+                    }
 
-                res = event_sub_sock->recv(&received_event_data,ZMQ_DONTWAIT);
-                if (res == false)
-                {
-                    print_error_message("Forth Zmq recv call on event socket returned false! De-synchronized event system?");
-                    continue;
-                }
+                    res = event_sub_sock->recv(&received_event_data,ZMQ_DONTWAIT);
+                    if (res == false)
+                    {
+                        print_error_message("Forth Zmq recv call on event socket returned false! De-synchronized event system?");
+                        continue;
+                    }
 
-                process_event(received_event_name,received_endian,received_call,received_event_data);
+                    process_event(received_event_name,received_endian,received_call,received_event_data);
+                }
             }
             catch (zmq::error_t &e)
             {
@@ -457,6 +463,78 @@ void ZmqEventConsumer::process_heartbeat(zmq::message_t &received_event_name,zmq
 
 }
 
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventConsumer::is_event_batch()
+//
+// description : 	Check if a message received by the event socket is an
+//                  event batch (event name ending with ".batch")
+//
+// args: in : - received_event_name : The full event name
+//
+//-----------------------------------------------------------------------------
+
+bool ZmqEventConsumer::is_event_batch(zmq::message_t &received_event_name)
+{
+    size_t batch_size = ::strlen(BATCH_EVENT_NAME) + 1;
+    size_t name_size = received_event_name.size();
+
+    if (name_size <= batch_size)
+        return false;
+
+    const char *name_end = (const char *)received_event_name.data() + name_size - batch_size;
+    if ((name_end[0] == '.') && (::memcmp(name_end + 1,BATCH_EVENT_NAME,batch_size - 1) == 0))
+        return true;
+    else
+        return false;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventConsumer::process_event_batch()
+//
+// description : 	Receive the remaining frames of an event batch and
+//                  process each event it contains. The frames are the
+//                  sender endianess followed by the event name, call info
+//                  and data of each event. The batch may contain events
+//                  this process has not subscribed to. They are silently
+//                  ignored
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventConsumer::process_event_batch()
+{
+    zmq::message_t received_endian;
+
+    if (event_sub_sock->recv(&received_endian,ZMQ_DONTWAIT) == false)
+    {
+        print_error_message("Zmq recv call for batch endianess returned false! De-synchronized event system?");
+        return;
+    }
+
+    int more = 1;
+    size_t more_size = sizeof(more);
+    event_sub_sock->getsockopt(ZMQ_RCVMORE,&more,&more_size);
+
+    while (more != 0)
+    {
+        zmq::message_t received_event_name,received_call,received_event_data;
+
+        if ((event_sub_sock->recv(&received_event_name,ZMQ_DONTWAIT) == false) ||
+            (event_sub_sock->recv(&received_call,ZMQ_DONTWAIT) == false) ||
+            (event_sub_sock->recv(&received_event_data,ZMQ_DONTWAIT) == false))
+        {
+            print_error_message("Zmq recv call for batched event returned false! De-synchronized event system?");
+            return;
+        }
+
+        process_event(received_event_name,received_endian,received_call,received_event_data,true);
+
+        more_size = sizeof(more);
+        event_sub_sock->getsockopt(ZMQ_RCVMORE,&more,&more_size);
+    }
+}
+
 //+----------------------------------------------------------------------------
 //
 // method : 		ZmqEventConsumer::process_event()
@@ -468,10 +546,11 @@ void ZmqEventConsumer::process_heartbeat(zmq::message_t &received_event_name,zmq
 //            - received_endian : The sender endianess
 //            - received_call : The call informations (oid - method name...)
 //            - event_data : The event data !
+//            - batched : Set to true if the event was received in a batch
 //
 //-----------------------------------------------------------------------------
 
-void ZmqEventConsumer::process_event(zmq::message_t &received_event_name,zmq::message_t &received_endian,zmq::message_t &received_call,zmq::message_t &event_data)
+void ZmqEventConsumer::process_event(zmq::message_t &received_event_name,zmq::message_t &received_endian,zmq::message_t &received_call,zmq::message_t &event_data,bool batched)
 {
 //
 // For debug and logging purposes
@@ -544,7 +623,7 @@ void ZmqEventConsumer::process_event(zmq::message_t &received_event_name,zmq::me
 // Call the event method
 //
 
-    push_zmq_event(event_name,endian,event_data,receiv_call->call_is_except,receiv_call->ctr);
+    push_zmq_event(event_name,endian,event_data,receiv_call->call_is_except,receiv_call->ctr,batched);
 
 }
 
@@ -1068,6 +1147,12 @@ void ZmqEventConsumer::cleanup_EventChannel_map()
 {
 	EvChanIte evt_it;
 
+//
+// Stop the event dispatch threads (if any) before the callback monitors are deleted
+//
+
+	stop_dispatch_threads();
+
     for (evt_it = channel_map.begin(); evt_it != channel_map.end(); ++evt_it)
     {
         EventChannelStruct &evt_ch = evt_it->second;
@@ -1289,6 +1374,7 @@ void ZmqEventConsumer::connect_event_channel(string &channel_name,TANGO_UNUSED(D
 		evt_ch.last_heartbeat = time(NULL);
 		evt_ch.heartbeat_skipped = false;
 		evt_ch.event_system_failed = false;
+		evt_ch.bulk_subscription = true;
 	}
 	else
 	{
@@ -1303,6 +1389,7 @@ void ZmqEventConsumer::connect_event_channel(string &channel_name,TANGO_UNUSED(D
 		new_event_channel_struct.channel_monitor->timeout(500);
 
 		new_event_channel_struct.event_system_failed = false;
+		new_event_channel_struct.bulk_subscription = true;
 		set_channel_type(new_event_channel_struct);
 
 		channel_map[channel_name] = new_event_channel_struct;
@@ -1411,12 +1498,35 @@ void ZmqEventConsumer::disconnect_event_channel(string &channel_name)
 //                  It will be filtered out by ZMQ
 //
 // Args in : - event_name : The event name
+//           - batch_name : The batch event name used by this event (empty
+//                          if the event is not batched)
 //
 //-----------------------------------------------------------------------------
 
-void ZmqEventConsumer::disconnect_event(string &event_name)
+void ZmqEventConsumer::disconnect_event(string &event_name,string &batch_name)
 {
 
+//
+// Unsubscribe from the batch event when this is the last event using it
+//
+
+    vector<string> unsub_names;
+    unsub_names.push_back(event_name);
+
+    if (batch_name.empty() == false)
+    {
+        map<string,int>::iterator pos = batch_event_ctr.find(batch_name);
+        if (pos != batch_event_ctr.end())
+        {
+            pos->second--;
+            if (pos->second <= 0)
+            {
+                batch_event_ctr.erase(pos);
+                unsub_names.push_back(batch_name);
+            }
+        }
+    }
+
 //
 // Create and connect the REQ socket used to send message to the
 // ZMQ main thread
@@ -1429,30 +1539,36 @@ void ZmqEventConsumer::disconnect_event(string &event_name)
         zmq::socket_t sender(zmq_context,ZMQ_REQ);
         sender.connect(CTRL_SOCK_ENDPOINT);
 
+        for (unsigned int loop = 0;loop < unsub_names.size();++loop)
+        {
+
 //
 // Build message sent to ZMQ main thread
 // In this case, this is the command code, the publisher endpoint
 // and the event name
 //
 
-        char buffer[1024];
-        int length = 0;
+            char buffer[1024];
+            int length = 0;
 
-        buffer[length] = ZMQ_DISCONNECT_EVENT;
-        length++;
+            buffer[length] = ZMQ_DISCONNECT_EVENT;
+            length++;
 
-        ::strcpy(&(buffer[length]),event_name.c_str());
-        length = length + event_name.size() + 1;
+            ::strcpy(&(buffer[length]),unsub_names[loop].c_str());
+            length = length + unsub_names[loop].size() + 1;
 
 //
 // Send command to main ZMQ thread
 //
 
-        zmq::message_t send_data(length);
-        ::memcpy(send_data.data(),buffer,length);
-        sender.send(send_data);
+            zmq::message_t send_data(length);
+            ::memcpy(send_data.data(),buffer,length);
+            sender.send(send_data);
 
-        sender.recv(&reply);
+            sender.recv(&reply);
+            if (reply.size() != 2)
+                break;
+        }
     }
     catch (zmq::error_t &e)
     {
@@ -1509,7 +1625,7 @@ void ZmqEventConsumer::disconnect_event(string &event_name)
 //-----------------------------------------------------------------------------
 
 void ZmqEventConsumer::connect_event_system(string &device_name,string &att_name,string &event_name,TANGO_UNUSED(const vector<string> &filters),
-                                            TANGO_UNUSED(EvChanIte &eve_it),TANGO_UNUSED(EventCallBackStruct &new_event_callback),
+                                            TANGO_UNUSED(EvChanIte &eve_it),EventCallBackStruct &new_event_callback,
                                             DeviceData &dd)
 {
 //
@@ -1542,6 +1658,7 @@ void ZmqEventConsumer::connect_event_system(string &device_name,string &att_name
 // ZMQ main thread
 //
 
+    string batch_name;
     zmq::message_t reply;
     try
     {
@@ -1575,63 +1692,89 @@ void ZmqEventConsumer::connect_event_system(string &device_name,string &att_name
             }
         }
 
+//
+// If the server batches events, the batch event name is returned
+// as third string (unicast only). The batch event is subscribed once
+// whatever the number of events using it. ZMQ keeps the subscriptions
+// when the socket is re-connected
+//
+
+        vector<string> sub_names;
+        sub_names.push_back(full_event_name);
+
+        if ((mcast_transport == false) && (ev_svr_data->svalue.length() > 2))
+            batch_name = ev_svr_data->svalue[2].in();
+
+        if ((batch_name.empty() == false) && (batch_name != new_event_callback.batch_event_name))
+        {
+            map<string,int>::iterator pos = batch_event_ctr.find(batch_name);
+            if ((pos == batch_event_ctr.end()) || (pos->second <= 0))
+                sub_names.push_back(batch_name);
+        }
+
+        for (unsigned int loop = 0;loop < sub_names.size();++loop)
+        {
+
 //
 // Build message sent to ZMQ main thread
 // In this case, this is the command code, the publisher endpoint,
 // the event name and the sub hwm
 //
 
-        char buffer[1024];
-        int length = 0;
+            char buffer[1024];
+            int length = 0;
 
-        if (mcast_transport == true)
-            buffer[length] = ZMQ_CONNECT_MCAST_EVENT;
-        else
-            buffer[length] = ZMQ_CONNECT_EVENT;
-        length++;
+            if (mcast_transport == true)
+                buffer[length] = ZMQ_CONNECT_MCAST_EVENT;
+            else
+                buffer[length] = ZMQ_CONNECT_EVENT;
+            length++;
 
-        if (filters.size() == 1 && filters[0] == "reconnect")
-            buffer[length] = 1;
-        else
-            buffer[length] = 0;
-        length++;
+            if (filters.size() == 1 && filters[0] == "reconnect")
+                buffer[length] = 1;
+            else
+                buffer[length] = 0;
+            length++;
 
-        ::strcpy(&(buffer[length]),endpoint.c_str());
-        length = length + endpoint.size() + 1;
+            ::strcpy(&(buffer[length]),endpoint.c_str());
+            length = length + endpoint.size() + 1;
 
-        ::strcpy(&(buffer[length]),full_event_name.c_str());
-        length = length + full_event_name.size() + 1;
+            ::strcpy(&(buffer[length]),sub_names[loop].c_str());
+            length = length + sub_names[loop].size() + 1;
 
-        DevLong user_hwm = au->get_user_sub_hwm();
-        if (user_hwm != -1)
-            ::memcpy(&(buffer[length]),&(user_hwm),sizeof(Tango::DevLong));
-        else
-            ::memcpy(&(buffer[length]),&(ev_svr_data->lvalue[2]),sizeof(Tango::DevLong));
-        length = length + sizeof(Tango::DevLong);
+            DevLong user_hwm = au->get_user_sub_hwm();
+            if (user_hwm != -1)
+                ::memcpy(&(buffer[length]),&(user_hwm),sizeof(Tango::DevLong));
+            else
+                ::memcpy(&(buffer[length]),&(ev_svr_data->lvalue[2]),sizeof(Tango::DevLong));
+            length = length + sizeof(Tango::DevLong);
 
 //
 // In case of multicasting, add rate and ivl parameters
 //
 
-        if (mcast_transport == true)
-        {
-            ::memcpy(&(buffer[length]),&(ev_svr_data->lvalue[3]),sizeof(Tango::DevLong));
-            length = length + sizeof(Tango::DevLong);
+            if (mcast_transport == true)
+            {
+                ::memcpy(&(buffer[length]),&(ev_svr_data->lvalue[3]),sizeof(Tango::DevLong));
+                length = length + sizeof(Tango::DevLong);
 
-            ::memcpy(&(buffer[length]),&(ev_svr_data->lvalue[4]),sizeof(Tango::DevLong));
-            length = length + sizeof(Tango::DevLong);
-        }
+                ::memcpy(&(buffer[length]),&(ev_svr_data->lvalue[4]),sizeof(Tango::DevLong));
+                length = length + sizeof(Tango::DevLong);
+            }
 
 //
 // Send command to main ZMQ thread
 //
 
-        zmq::message_t send_data(length);
-        ::memcpy(send_data.data(),buffer,length);
+            zmq::message_t send_data(length);
+            ::memcpy(send_data.data(),buffer,length);
 
-        sender.send(send_data);
+            sender.send(send_data);
 
-        sender.recv(&reply);
+            sender.recv(&reply);
+            if (reply.size() != 2)
+                break;
+        }
     }
     catch(zmq::error_t &e)
     {
@@ -1666,6 +1809,35 @@ void ZmqEventConsumer::connect_event_system(string &device_name,string &att_name
                         o.str(),
                         (const char *)"ZmqEventConsumer::connect_event_system");
     }
+
+//
+// Update the batch event reference counters. If the server does not use the
+// same batch event any more (re-connection), release the previous one
+//
+
+    if (batch_name != new_event_callback.batch_event_name)
+    {
+        if (batch_name.empty() == false)
+            batch_event_ctr[batch_name]++;
+
+        string old_batch(new_event_callback.batch_event_name);
+        new_event_callback.batch_event_name = batch_name;
+
+        if (old_batch.empty() == false)
+        {
+            map<string,int>::iterator pos = batch_event_ctr.find(old_batch);
+            if (pos != batch_event_ctr.end())
+            {
+                pos->second--;
+                if (pos->second <= 0)
+                {
+                    batch_event_ctr.erase(pos);
+                    string no_batch;
+                    disconnect_event(old_batch,no_batch);
+                }
+            }
+        }
+    }
 }
 
 //+----------------------------------------------------------------------------
@@ -1779,10 +1951,12 @@ void ZmqEventConsumer::push_heartbeat_event(string &ev_name)
 //                    - error : Flag set to true if the event data is an error
 //                              stack
 //                    - ctr : Event counter as received from server
+//                    - batched : Flag set to true if the event was received
+//                                in a batch (no error for unknown event)
 //
 //-----------------------------------------------------------------------------
 
-void ZmqEventConsumer::push_zmq_event(string &ev_name,unsigned char endian,zmq::message_t &event_data,bool error,const DevULong &ds_ctr)
+void ZmqEventConsumer::push_zmq_event(string &ev_name,unsigned char endian,zmq::message_t &event_data,bool error,const DevULong &ds_ctr,bool batched)
 {
 
     map_modification_lock.readerIn();
@@ -2123,6 +2297,8 @@ void ZmqEventConsumer::push_zmq_event(string &ev_name,unsigned char endian,zmq::
             AttrConfEventData *missed_conf_event_data = NULL;
             DataReadyEventData *missed_ready_event_data = NULL;
 
+            bool async_cb = ApiUtil::instance()->get_event_dispatch_threads() > 0;
+
             try
             {
                 AutoTangoMonitor _mon(evt_cb.callback_monitor);
@@ -2161,6 +2337,7 @@ void ZmqEventConsumer::push_zmq_event(string &ev_name,unsigned char endian,zmq::
 
                 unsigned int cb_nb = ipos->second.callback_list.size();
                 unsigned int cb_ctr = 0;
+                bool dev_attr_copied = false;
 
                 for (esspos = evt_cb.callback_list.begin(); esspos != evt_cb.callback_list.end(); ++esspos)
                 {
@@ -2177,18 +2354,29 @@ void ZmqEventConsumer::push_zmq_event(string &ev_name,unsigned char endian,zmq::
                             EventData *event_data;
 
 //
-// In case we have several callbacks on the same event
-// or if the event has to be stored in a queue, copy
-// the event data (Event data are in the ZMQ message)
+// For IDL 4 devices, event data are in the ZMQ message. If they have to be
+// given to several callbacks, stored in a queue or executed by a dispatch
+// thread, copy them once. All the callbacks then share this copy
+// (copy on write)
 //
 
+                            if (vers == 4 && dev_attr_copied == false && dev_attr != NULL &&
+                                (cb_ctr != cb_nb || callback == NULL || async_cb == true))
+                            {
+                                DeviceAttribute *dev_attr_copy = new DeviceAttribute();
+                                dev_attr_copy->deep_copy(*dev_attr);
+                                delete dev_attr;
+                                dev_attr = dev_attr_copy;
+                                dev_attr_copied = true;
+                            }
+
                             if (cb_ctr != cb_nb)
                             {
                                 DeviceAttribute *dev_attr_copy = NULL;
-                                if (dev_attr != NULL || (callback == NULL && vers == 4))
+                                if (dev_attr != NULL)
                                 {
                                     dev_attr_copy = new DeviceAttribute();
-                                    dev_attr_copy->deep_copy(*dev_attr);
+                                    dev_attr_copy->shared_copy(*dev_attr);
                                 }
 
                                 event_data = new EventData(event_callback_map[ev_name].device,
@@ -2198,36 +2386,24 @@ void ZmqEventConsumer::push_zmq_event(string &ev_name,unsigned char endian,zmq::
                                                                     errors);
                             }
                             else
-                            {
-                                if (callback == NULL && vers == 4)
-                                {
-                                    DeviceAttribute *dev_attr_copy = NULL;
-                                    if (dev_attr != NULL)
-                                    {
-                                        dev_attr_copy = new DeviceAttribute();
-                                        dev_attr_copy->deep_copy(*dev_attr);
-                                    }
-
-                                    event_data = new EventData(event_callback_map[ev_name].device,
-                                                                    att_name,
-                                                                    event_name,
-                                                                    dev_attr_copy,
-                                                                    errors);
-
-                                }
-                                else
-                                    event_data = new EventData (event_callback_map[ev_name].device,
-                                                                  att_name,
-                                                                  event_name,
-                                                                  dev_attr,
-                                                                  errors);
-                            }
+                                event_data = new EventData (event_callback_map[ev_name].device,
+                                                              att_name,
+                                                              event_name,
+                                                              dev_attr,
+                                                              errors);
 
 //
 // If a callback method was specified, call it!
 //
 
-                            if (callback != NULL )
+                            if (callback != NULL && async_cb == true)
+                            {
+                                if (err_missed_event == true)
+                                    dispatch_event(esspos->id,callback,evt_cb.callback_monitor,ipos->first,
+                                                   new EventData(*missed_event_data),NULL,NULL);
+                                dispatch_event(esspos->id,callback,evt_cb.callback_monitor,ipos->first,event_data,NULL,NULL);
+                            }
+                            else if (callback != NULL )
                             {
                                 try
                                 {
@@ -2254,8 +2430,6 @@ void ZmqEventConsumer::push_zmq_event(string &ev_name,unsigned char endian,zmq::
                                 if (err_missed_event == true)
                                     ev_queue->insert_event(missed_event_data);
                                 ev_queue->insert_event(event_data);
-                                if (vers == 4 && cb_ctr == cb_nb)
-                                    delete dev_attr;
                             }
                         }
                         else if (ev_attr_ready == false)
@@ -2283,7 +2457,14 @@ void ZmqEventConsumer::push_zmq_event(string &ev_name,unsigned char endian,zmq::
 
 
                             // if callback methods were specified, call them!
-                            if (callback != NULL )
+                            if (callback != NULL && async_cb == true)
+                            {
+                                if (err_missed_event == true)
+                                    dispatch_event(esspos->id,callback,evt_cb.callback_monitor,ipos->first,
+                                                   NULL,new AttrConfEventData(*missed_conf_event_data),NULL);
+                                dispatch_event(esspos->id,callback,evt_cb.callback_monitor,ipos->first,NULL,event_data,NULL);
+                            }
+                            else if (callback != NULL )
                             {
                                 try
                                 {
@@ -2315,7 +2496,14 @@ void ZmqEventConsumer::push_zmq_event(string &ev_name,unsigned char endian,zmq::
                             DataReadyEventData *event_data = new DataReadyEventData(event_callback_map[ev_name].device,
                                                                     const_cast<AttDataReady *>(att_ready),event_name,errors);
                             // if a callback method was specified, call it!
-                            if (callback != NULL )
+                            if (callback != NULL && async_cb == true)
+                            {
+                                if (err_missed_event == true)
+                                    dispatch_event(esspos->id,callback,evt_cb.callback_monitor,ipos->first,
+                                                   NULL,NULL,new DataReadyEventData(*missed_ready_event_data));
+                                dispatch_event(esspos->id,callback,evt_cb.callback_monitor,ipos->first,NULL,NULL,event_data);
+                            }
+                            else if (callback != NULL )
                             {
                                 try
                                 {
@@ -2403,15 +2591,281 @@ void ZmqEventConsumer::push_zmq_event(string &ev_name,unsigned char endian,zmq::
 
     if (loop == env_var_fqdn_prefix.size())
     {
-        string st("Event ");
-		st = st + ev_name;
-		st = st + " not found in event callback map !!!";
-		print_error_message(st.c_str());
+        if (batched == false)
+        {
+            string st("Event ");
+            st = st + ev_name;
+            st = st + " not found in event callback map !!!";
+            print_error_message(st.c_str());
+        }
 		// even if nothing was found in the map, free the lock
         map_modification_lock.readerOut();
     }
 }
 
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventConsumer::dispatch_event()
+//
+// description :    Queue an event for one of the dispatch threads. The dispatch
+//                  threads are created the first time this method is called.
+//                  The event data memory is then owned by the dispatch code.
+//
+// argument(s) : in : - id : The subscription event identifier
+//                    - cb : The user callback
+//                    - cb_mon : The event callback monitor
+//                    - ev_name : The event name
+//                    - ev_data : The event data (attribute event)
+//                    - conf_data : The event data (attribute configuration event)
+//                    - ready_data : The event data (data ready event)
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventConsumer::dispatch_event(int id,CallBack *cb,TangoMonitor *cb_mon,const string &ev_name,
+                                      EventData *ev_data,AttrConfEventData *conf_data,DataReadyEventData *ready_data)
+{
+    DispatchedEvent de;
+    de.event_id = id;
+    de.callback = cb;
+    de.cb_monitor = cb_mon;
+    de.ev_name = ev_name;
+    de.ev_data = ev_data;
+    de.conf_data = conf_data;
+    de.ready_data = ready_data;
+
+    omni_mutex_lock oml(dispatch_mutex);
+
+    if (dispatch_threads.empty() == true && dispatch_exit == false)
+    {
+        int th_nb = ApiUtil::instance()->get_event_dispatch_threads();
+        for (int i = 0;i < th_nb;i++)
+            dispatch_threads.push_back(new DispatchEventThread(this));
+    }
+
+    dispatch_queue.push_back(de);
+    dispatch_cond.broadcast();
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventConsumer::get_dispatched_event()
+//
+// description :    Wait for an event to be executed by a dispatch thread.
+//                  To keep the event order for one subscription, an event is
+//                  given to a thread only if no other thread is currently
+//                  executing an event for the same subscription. A callback
+//                  object may be used by several subscriptions. An event is
+//                  therefore also not given to a thread while another thread
+//                  is executing the same callback, so one callback object is
+//                  never executed by two threads at the same time.
+//
+// argument(s) : out : - de : The event to be executed
+//
+// return : False if the thread has to exit
+//
+//-----------------------------------------------------------------------------
+
+bool ZmqEventConsumer::get_dispatched_event(DispatchedEvent &de)
+{
+    omni_mutex_lock oml(dispatch_mutex);
+
+    while (dispatch_exit == false)
+    {
+        deque<DispatchedEvent>::iterator ite;
+        for (ite = dispatch_queue.begin();ite != dispatch_queue.end();++ite)
+        {
+            if ((dispatch_busy.find(ite->event_id) == dispatch_busy.end()) &&
+                (dispatch_busy_cb.find(ite->callback) == dispatch_busy_cb.end()))
+                break;
+        }
+
+        if (ite != dispatch_queue.end())
+        {
+            de = *ite;
+            dispatch_queue.erase(ite);
+            dispatch_busy.insert(de.event_id);
+            dispatch_busy_cb.insert(de.callback);
+            return true;
+        }
+
+        dispatch_cond.wait();
+    }
+
+    return false;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventConsumer::exec_dispatched_event()
+//
+// description :    Execute the user callback for an event taken from the
+//                  dispatch queue and delete the event data
+//
+// argument(s) : in : - de : The event to be executed
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventConsumer::exec_dispatched_event(DispatchedEvent &de)
+{
+    try
+    {
+        AutoTangoMonitor _mon(de.cb_monitor);
+
+        try
+        {
+            if (de.ev_data != NULL)
+                de.callback->push_event(de.ev_data);
+            else if (de.conf_data != NULL)
+                de.callback->push_event(de.conf_data);
+            else
+                de.callback->push_event(de.ready_data);
+        }
+        catch (...)
+        {
+            string st("Tango::ZmqEventConsumer::exec_dispatched_event() exception in callback method of ");
+            st = st + de.ev_name;
+            print_error_message(st.c_str());
+        }
+    }
+    catch (DevFailed &e)
+    {
+        string reason = e.errors[0].reason.in();
+        if (reason == "API_CommandTimedOut")
+        {
+            string st("Tango::ZmqEventConsumer::exec_dispatched_event() timeout on callback monitor of ");
+            st = st + de.ev_name;
+            print_error_message(st.c_str());
+        }
+    }
+
+    delete de.ev_data;
+    delete de.conf_data;
+    delete de.ready_data;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventConsumer::dispatched_event_done()
+//
+// description :    Inform the dispatch code that the execution of an event
+//                  is finished
+//
+// argument(s) : in : - de : The executed event
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventConsumer::dispatched_event_done(DispatchedEvent &de)
+{
+    omni_mutex_lock oml(dispatch_mutex);
+
+    dispatch_busy.erase(de.event_id);
+    dispatch_busy_cb.erase(de.callback);
+    dispatch_cond.broadcast();
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventConsumer::purge_dispatched_events()
+//
+// description :    Remove from the dispatch queue all the events for one
+//                  subscription. Used when the subscription is removed.
+//
+// argument(s) : in : - id : The subscription event identifier
+//                    - wait_end : Flag set to true if the method has to wait
+//                                 until no dispatch thread is executing an
+//                                 event for this subscription
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventConsumer::purge_dispatched_events(int id,bool wait_end)
+{
+    if (id < 0)
+        id = -id;
+
+    omni_mutex_lock oml(dispatch_mutex);
+
+    deque<DispatchedEvent>::iterator ite = dispatch_queue.begin();
+    while (ite != dispatch_queue.end())
+    {
+        if (ite->event_id == id)
+        {
+            delete ite->ev_data;
+            delete ite->conf_data;
+            delete ite->ready_data;
+            ite = dispatch_queue.erase(ite);
+        }
+        else
+            ++ite;
+    }
+
+    if (wait_end == true)
+    {
+        while (dispatch_busy.find(id) != dispatch_busy.end())
+            dispatch_cond.wait();
+    }
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventConsumer::stop_dispatch_threads()
+//
+// description :    Ask the dispatch threads to exit, wait for them and delete
+//                  the events still in the dispatch queue
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventConsumer::stop_dispatch_threads()
+{
+    vector<DispatchEventThread *> th_list;
+
+    {
+        omni_mutex_lock oml(dispatch_mutex);
+
+        dispatch_exit = true;
+        dispatch_cond.broadcast();
+        th_list.swap(dispatch_threads);
+    }
+
+    for (size_t loop = 0;loop < th_list.size();loop++)
+    {
+        void *dummy_ptr;
+        th_list[loop]->join(&dummy_ptr);
+    }
+
+    omni_mutex_lock oml(dispatch_mutex);
+
+    while (dispatch_queue.empty() == false)
+    {
+        DispatchedEvent &de = dispatch_queue.front();
+        delete de.ev_data;
+        delete de.conf_data;
+        delete de.ready_data;
+        dispatch_queue.pop_front();
+    }
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		DispatchEventThread::run_undetached()
+//
+// description :    The event dispatch thread main code. Execute the queued
+//                  event callbacks until it is asked to exit
+//
+//-----------------------------------------------------------------------------
+
+void *DispatchEventThread::run_undetached(TANGO_UNUSED(void *ptr))
+{
+    DispatchedEvent de;
+
+    while (ev_cons->get_dispatched_event(de) == true)
+    {
+        ev_cons->exec_dispatched_event(de);
+        ev_cons->dispatched_event_done(de);
+    }
+
+    return NULL;
+}
+
 //+----------------------------------------------------------------------------
 //
 // method : 		ZmqEventConsumer::print_error_message
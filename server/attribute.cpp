@@ -478,10 +478,8 @@ void Attribute::init_event_prop(vector<AttrProperty> &prop_list,const string &de
 
 		if(event_period_defined)
 		{
-			TangoSys_MemStream str;
 			int event_period = 0;
-			str << event_period_str;
-			if(str >> event_period && str.eof())
+			if(str_to_num_full(event_period_str,event_period) == true)
 			{
 				if (event_period > 0)
 					ext->event_period = event_period;
@@ -515,10 +513,8 @@ void Attribute::init_event_prop(vector<AttrProperty> &prop_list,const string &de
 
 		if(archive_period_defined)
 		{
-			TangoSys_MemStream str;
 			int archive_period = 0;
-			str << archive_period_str;
-			if(str >> archive_period && str.eof())
+			if(str_to_num_full(archive_period_str,archive_period) == true)
 			{
 				if (archive_period > 0)
 				{
@@ -654,10 +650,6 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 		add_startup_exception("format",e);
 	}
 
-
-	TangoSys_MemStream str;
-	bool empty = true;
-
 //
 // Init the min alarm property
 //
@@ -671,19 +663,17 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 				(data_type != Tango::DEV_BOOLEAN) &&
 				(data_type != Tango::DEV_STATE))
 			{
-				str << min_alarm_str;
-				empty = false;
 				switch (data_type)
 				{
 				case Tango::DEV_SHORT:
-					if (!(str >> min_alarm.sh && str.eof()))
+					if (str_to_num_full(min_alarm_str,min_alarm.sh) == false)
 						throw_err_format("min_alarm",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(max_level) && min_alarm.sh >= max_alarm.sh)
 						throw_incoherent_val_err("min_alarm","max_alarm",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_LONG:
-					if (!(str >> min_alarm.db && str.eof()))
+					if (str_to_num_full(min_alarm_str,min_alarm.db) == false)
 						throw_err_format("min_alarm",dev_name,"Attribute::init_opt_prop()");
 					min_alarm.lg = (DevLong)min_alarm.db;
 					if(alarm_conf.test(max_level) && min_alarm.lg >= max_alarm.lg)
@@ -691,7 +681,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_LONG64:
-					if (!(str >> min_alarm.db && str.eof()))
+					if (str_to_num_full(min_alarm_str,min_alarm.db) == false)
 						throw_err_format("min_alarm",dev_name,"Attribute::init_opt_prop()");
 					min_alarm.lg64 = (DevLong64)min_alarm.db;
 					if(alarm_conf.test(max_level) && min_alarm.lg64 >= max_alarm.lg64)
@@ -699,27 +689,27 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_DOUBLE:
-					if (!(str >> min_alarm.db && str.eof()))
+					if (str_to_num_full(min_alarm_str,min_alarm.db) == false)
 						throw_err_format("min_alarm",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(max_level) && min_alarm.db >= max_alarm.db)
 						throw_incoherent_val_err("min_alarm","max_alarm",dev_name,"Attribute::init_opt_prop()");
 					break;
 				case Tango::DEV_FLOAT:
-					if (!(str >> min_alarm.fl && str.eof()))
+					if (str_to_num_full(min_alarm_str,min_alarm.fl) == false)
 						throw_err_format("min_alarm",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(max_level) && min_alarm.fl >= max_alarm.fl)
 						throw_incoherent_val_err("min_alarm","max_alarm",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_USHORT:
-					if (!(str >> min_alarm.ush && str.eof()))
+					if (str_to_num_full(min_alarm_str,min_alarm.ush) == false)
 						throw_err_format("min_alarm",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(max_level) && min_alarm.ush >= max_alarm.ush)
 						throw_incoherent_val_err("min_alarm","max_alarm",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_UCHAR:
-					if (!(str >> min_alarm.sh && str.eof()))
+					if (str_to_num_full(min_alarm_str,min_alarm.sh) == false)
 						throw_err_format("min_alarm",dev_name,"Attribute::init_opt_prop()");
 					min_alarm.uch = (DevUChar)min_alarm.sh;
 					if(alarm_conf.test(max_level) && min_alarm.uch >= max_alarm.uch)
@@ -727,7 +717,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG:
-					if (!(str >> min_alarm.db && str.eof()))
+					if (str_to_num_full(min_alarm_str,min_alarm.db) == false)
 						throw_err_format("min_alarm",dev_name,"Attribute::init_opt_prop()");
 					min_alarm.ulg = (DevULong)min_alarm.db;
 					if(alarm_conf.test(max_level) && min_alarm.ulg >= max_alarm.ulg)
@@ -735,7 +725,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG64:
-					if (!(str >> min_alarm.db && str.eof()))
+					if (str_to_num_full(min_alarm_str,min_alarm.db) == false)
 						throw_err_format("min_alarm",dev_name,"Attribute::init_opt_prop()");
 					min_alarm.ulg64 = (DevULong64)min_alarm.db;
 					if(alarm_conf.test(max_level) && min_alarm.ulg64 >= max_alarm.ulg64)
@@ -743,7 +733,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ENCODED:
-					if (!(str >> min_alarm.sh && str.eof()))
+					if (str_to_num_full(min_alarm_str,min_alarm.sh) == false)
 						throw_err_format("min_alarm",dev_name,"Attribute::init_opt_prop()");
 					min_alarm.uch = (DevUChar)min_alarm.sh;
 					if(alarm_conf.test(max_level) && min_alarm.uch >= max_alarm.uch)
@@ -774,25 +764,17 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 				(data_type != Tango::DEV_BOOLEAN) &&
 				(data_type != Tango::DEV_STATE))
 			{
-				if (empty == false)
-				{
-					str.str("");
-					str.clear();
-				}
-
-				str << max_alarm_str;
-				empty = false;
 				switch (data_type)
 				{
 				case Tango::DEV_SHORT:
-					if (!(str >> max_alarm.sh && str.eof()))
+					if (str_to_num_full(max_alarm_str,max_alarm.sh) == false)
 						throw_err_format("max_alarm",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(min_level) && min_alarm.sh >= max_alarm.sh)
 						throw_incoherent_val_err("min_alarm","max_alarm",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_LONG:
-					if (!(str >> max_alarm.db && str.eof()))
+					if (str_to_num_full(max_alarm_str,max_alarm.db) == false)
 						throw_err_format("max_alarm",dev_name,"Attribute::init_opt_prop()");
 					max_alarm.lg = (DevLong)max_alarm.db;
 					if(alarm_conf.test(min_level) && min_alarm.lg >= max_alarm.lg)
@@ -800,7 +782,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_LONG64:
-					if (!(str >> max_alarm.db && str.eof()))
+					if (str_to_num_full(max_alarm_str,max_alarm.db) == false)
 						throw_err_format("max_alarm",dev_name,"Attribute::init_opt_prop()");
 					max_alarm.lg64 = (DevLong64)max_alarm.db;
 					if(alarm_conf.test(min_level) && min_alarm.lg64 >= max_alarm.lg64)
@@ -808,28 +790,28 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_DOUBLE:
-					if (!(str >> max_alarm.db && str.eof()))
+					if (str_to_num_full(max_alarm_str,max_alarm.db) == false)
 						throw_err_format("max_alarm",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(min_level) && min_alarm.db >= max_alarm.db)
 						throw_incoherent_val_err("min_alarm","max_alarm",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_FLOAT:
-					if (!(str >> max_alarm.fl && str.eof()))
+					if (str_to_num_full(max_alarm_str,max_alarm.fl) == false)
 						throw_err_format("max_alarm",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(min_level) && min_alarm.fl >= max_alarm.fl)
 						throw_incoherent_val_err("min_alarm","max_alarm",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_USHORT:
-					if (!(str >> max_alarm.ush && str.eof()))
+					if (str_to_num_full(max_alarm_str,max_alarm.ush) == false)
 						throw_err_format("max_alarm",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(min_level) && min_alarm.ush >= max_alarm.ush)
 						throw_incoherent_val_err("min_alarm","max_alarm",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_UCHAR:
-					if (!(str >> max_alarm.sh && str.eof()))
+					if (str_to_num_full(max_alarm_str,max_alarm.sh) == false)
 						throw_err_format("max_alarm",dev_name,"Attribute::init_opt_prop()");
 					max_alarm.uch = (DevUChar)max_alarm.sh;
 					if(alarm_conf.test(min_level) && min_alarm.uch >= max_alarm.uch)
@@ -837,7 +819,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG:
-					if (!(str >> max_alarm.db && str.eof()))
+					if (str_to_num_full(max_alarm_str,max_alarm.db) == false)
 						throw_err_format("max_alarm",dev_name,"Attribute::init_opt_prop()");
 					max_alarm.ulg = (DevULong)max_alarm.db;
 					if(alarm_conf.test(min_level) && min_alarm.ulg >= max_alarm.ulg)
@@ -845,7 +827,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG64:
-					if (!(str >> max_alarm.db && str.eof()))
+					if (str_to_num_full(max_alarm_str,max_alarm.db) == false)
 						throw_err_format("max_alarm",dev_name,"Attribute::init_opt_prop()");
 					max_alarm.ulg64 = (DevULong64)max_alarm.db;
 					if(alarm_conf.test(min_level) && min_alarm.ulg64 >= max_alarm.ulg64)
@@ -853,7 +835,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ENCODED:
-					if (!(str >> max_alarm.sh && str.eof()))
+					if (str_to_num_full(max_alarm_str,max_alarm.sh) == false)
 						throw_err_format("max_alarm",dev_name,"Attribute::init_opt_prop()");
 					max_alarm.uch = (DevUChar)max_alarm.sh;
 					if(alarm_conf.test(min_level) && min_alarm.uch >= max_alarm.uch)
@@ -884,25 +866,17 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 				(data_type != Tango::DEV_BOOLEAN) &&
 				(data_type != Tango::DEV_STATE))
 			{
-				if (empty == false)
-				{
-					str.str("");
-					str.clear();
-				}
-
-				str << min_value_str;
-				empty = false;
 				switch (data_type)
 				{
 				case Tango::DEV_SHORT:
-					if (!(str >> min_value.sh && str.eof()))
+					if (str_to_num_full(min_value_str,min_value.sh) == false)
 						throw_err_format("min_value",dev_name,"Attribute::init_opt_prop()");
 					if(check_max_value && min_value.sh >= max_value.sh)
 						throw_incoherent_val_err("min_value","max_value",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_LONG:
-					if (!(str >> min_value.db && str.eof()))
+					if (str_to_num_full(min_value_str,min_value.db) == false)
 						throw_err_format("min_value",dev_name,"Attribute::init_opt_prop()");
 					min_value.lg = (DevLong)min_value.db;
 					if(check_max_value && min_value.lg >= max_value.lg)
@@ -910,7 +884,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_LONG64:
-					if (!(str >> min_value.db && str.eof()))
+					if (str_to_num_full(min_value_str,min_value.db) == false)
 						throw_err_format("min_value",dev_name,"Attribute::init_opt_prop()");
 					min_value.lg64 = (DevLong64)min_value.db;
 					if(check_max_value && min_value.lg64 >= max_value.lg64)
@@ -918,28 +892,28 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_DOUBLE:
-					if (!(str >> min_value.db && str.eof()))
+					if (str_to_num_full(min_value_str,min_value.db) == false)
 						throw_err_format("min_value",dev_name,"Attribute::init_opt_prop()");
 					if(check_max_value && min_value.db >= max_value.db)
 						throw_incoherent_val_err("min_value","max_value",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_FLOAT:
-					if (!(str >> min_value.fl && str.eof()))
+					if (str_to_num_full(min_value_str,min_value.fl) == false)
 						throw_err_format("min_value",dev_name,"Attribute::init_opt_prop()");
 					if(check_max_value && min_value.fl >= max_value.fl)
 						throw_incoherent_val_err("min_value","max_value",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_USHORT:
-					if (!(str >> min_value.ush && str.eof()))
+					if (str_to_num_full(min_value_str,min_value.ush) == false)
 						throw_err_format("min_value",dev_name,"Attribute::init_opt_prop()");
 					if(check_max_value && min_value.ush >= max_value.ush)
 						throw_incoherent_val_err("min_value","max_value",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_UCHAR:
-					if (!(str >> min_value.sh && str.eof()))
+					if (str_to_num_full(min_value_str,min_value.sh) == false)
 						throw_err_format("min_value",dev_name,"Attribute::init_opt_prop()");
 					min_value.uch = (DevUChar)min_value.sh;
 					if(check_max_value && min_value.uch >= max_value.uch)
@@ -947,7 +921,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG:
-					if (!(str >> min_value.db && str.eof()))
+					if (str_to_num_full(min_value_str,min_value.db) == false)
 						throw_err_format("min_value",dev_name,"Attribute::init_opt_prop()");
 					min_value.ulg = (DevULong)min_value.db;
 					if(check_max_value && min_value.ulg >= max_value.ulg)
@@ -955,7 +929,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG64:
-					if (!(str >> min_value.db && str.eof()))
+					if (str_to_num_full(min_value_str,min_value.db) == false)
 						throw_err_format("min_value",dev_name,"Attribute::init_opt_prop()");
 					min_value.ulg64 = (DevULong64)min_value.db;
 					if(check_max_value && min_value.ulg64 >= max_value.ulg64)
@@ -963,7 +937,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ENCODED:
-					if (!(str >> min_value.sh && str.eof()))
+					if (str_to_num_full(min_value_str,min_value.sh) == false)
 						throw_err_format("min_value",dev_name,"Attribute::init_opt_prop()");
 					min_value.uch = (DevUChar)min_value.sh;
 					if(check_max_value && min_value.uch >= max_value.uch)
@@ -994,25 +968,17 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 				(data_type != Tango::DEV_BOOLEAN) &&
 				(data_type != Tango::DEV_STATE))
 			{
-				if (empty == false)
-				{
-					str.str("");
-					str.clear();
-				}
-
-				str << max_value_str;
-				empty = false;
 				switch (data_type)
 				{
 				case Tango::DEV_SHORT:
-					if (!(str >> max_value.sh && str.eof()))
+					if (str_to_num_full(max_value_str,max_value.sh) == false)
 						throw_err_format("max_value",dev_name,"Attribute::init_opt_prop()");
 					if(check_min_value && min_value.sh >= max_value.sh)
 						throw_incoherent_val_err("min_value","max_value",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_LONG:
-					if (!(str >> max_value.db && str.eof()))
+					if (str_to_num_full(max_value_str,max_value.db) == false)
 						throw_err_format("max_value",dev_name,"Attribute::init_opt_prop()");
 					max_value.lg = (DevLong)max_value.db;
 					if(check_min_value && min_value.lg >= max_value.lg)
@@ -1020,7 +986,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_LONG64:
-					if (!(str >> max_value.db && str.eof()))
+					if (str_to_num_full(max_value_str,max_value.db) == false)
 						throw_err_format("max_value",dev_name,"Attribute::init_opt_prop()");
 					max_value.lg64 = (DevLong64)max_value.db;
 					if(check_min_value && min_value.lg64 >= max_value.lg64)
@@ -1028,28 +994,28 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_DOUBLE:
-					if (!(str >> max_value.db && str.eof()))
+					if (str_to_num_full(max_value_str,max_value.db) == false)
 						throw_err_format("max_value",dev_name,"Attribute::init_opt_prop()");
 					if(check_min_value && min_value.db >= max_value.db)
 						throw_incoherent_val_err("min_value","max_value",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_FLOAT:
-					if (!(str >> max_value.fl && str.eof()))
+					if (str_to_num_full(max_value_str,max_value.fl) == false)
 						throw_err_format("max_value",dev_name,"Attribute::init_opt_prop()");
 					if(check_min_value && min_value.fl >= max_value.fl)
 						throw_incoherent_val_err("min_value","max_value",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_USHORT:
-					if (!(str >> max_value.ush && str.eof()))
+					if (str_to_num_full(max_value_str,max_value.ush) == false)
 						throw_err_format("max_value",dev_name,"Attribute::init_opt_prop()");
 					if(check_min_value && min_value.ush >= max_value.ush)
 						throw_incoherent_val_err("min_value","max_value",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_UCHAR:
-					if (!(str >> max_value.sh && str.eof()))
+					if (str_to_num_full(max_value_str,max_value.sh) == false)
 						throw_err_format("max_value",dev_name,"Attribute::init_opt_prop()");
 					max_value.uch = (DevUChar)max_value.sh;
 					if(check_min_value && min_value.uch >= max_value.uch)
@@ -1057,7 +1023,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG:
-					if (!(str >> max_value.db && str.eof()))
+					if (str_to_num_full(max_value_str,max_value.db) == false)
 						throw_err_format("max_value",dev_name,"Attribute::init_opt_prop()");
 					max_value.ulg = (DevULong)max_value.db;
 					if(check_min_value && min_value.ulg >= max_value.ulg)
@@ -1065,7 +1031,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG64:
-					if (!(str >> max_value.db && str.eof()))
+					if (str_to_num_full(max_value_str,max_value.db) == false)
 						throw_err_format("max_value",dev_name,"Attribute::init_opt_prop()");
 					max_value.ulg64 = (DevULong64)max_value.db;
 					if(check_min_value && min_value.ulg64 >= max_value.ulg64)
@@ -1073,7 +1039,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ENCODED:
-					if (!(str >> max_value.sh && str.eof()))
+					if (str_to_num_full(max_value_str,max_value.sh) == false)
 						throw_err_format("max_value",dev_name,"Attribute::init_opt_prop()");
 					max_value.uch = (DevUChar)max_value.sh;
 					if(check_min_value && min_value.uch >= max_value.uch)
@@ -1104,25 +1070,17 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 				(data_type != Tango::DEV_BOOLEAN) &&
 				(data_type != Tango::DEV_STATE))
 			{
-				if (empty == false)
-				{
-					str.str("");
-					str.clear();
-				}
-
-				str << min_warning_str;
-				empty = false;
 				switch (data_type)
 				{
 				case Tango::DEV_SHORT:
-					if (!(str >> min_warning.sh && str.eof()))
+					if (str_to_num_full(min_warning_str,min_warning.sh) == false)
 						throw_err_format("min_warning",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(max_warn) && min_warning.sh >= max_warning.sh)
 						throw_incoherent_val_err("min_warning","max_warning",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_LONG:
-					if (!(str >> min_warning.db && str.eof()))
+					if (str_to_num_full(min_warning_str,min_warning.db) == false)
 						throw_err_format("min_warning",dev_name,"Attribute::init_opt_prop()");
 					min_warning.lg = (DevLong)min_warning.db;
 					if(alarm_conf.test(max_warn) && min_warning.lg >= max_warning.lg)
@@ -1130,7 +1088,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_LONG64:
-					if (!(str >> min_warning.db && str.eof()))
+					if (str_to_num_full(min_warning_str,min_warning.db) == false)
 						throw_err_format("min_warning",dev_name,"Attribute::init_opt_prop()");
 					min_warning.lg64 = (DevLong64)min_warning.db;
 					if(alarm_conf.test(max_warn) && min_warning.lg64 >= max_warning.lg64)
@@ -1138,27 +1096,27 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_DOUBLE:
-					if (!(str >> min_warning.db && str.eof()))
+					if (str_to_num_full(min_warning_str,min_warning.db) == false)
 						throw_err_format("min_warning",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(max_warn) && min_warning.db >= max_warning.db)
 						throw_incoherent_val_err("min_warning","max_warning",dev_name,"Attribute::init_opt_prop()");
 					break;
 				case Tango::DEV_FLOAT:
-					if (!(str >> min_warning.fl && str.eof()))
+					if (str_to_num_full(min_warning_str,min_warning.fl) == false)
 						throw_err_format("min_warning",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(max_warn) && min_warning.fl >= max_warning.fl)
 						throw_incoherent_val_err("min_warning","max_warning",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_USHORT:
-					if (!(str >> min_warning.ush && str.eof()))
+					if (str_to_num_full(min_warning_str,min_warning.ush) == false)
 						throw_err_format("min_warning",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(max_warn) && min_warning.ush >= max_warning.ush)
 						throw_incoherent_val_err("min_warning","max_warning",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_UCHAR:
-					if (!(str >> min_warning.sh && str.eof()))
+					if (str_to_num_full(min_warning_str,min_warning.sh) == false)
 						throw_err_format("min_warning",dev_name,"Attribute::init_opt_prop()");
 					min_warning.uch = (DevUChar)min_warning.sh;
 					if(alarm_conf.test(max_warn) && min_warning.uch >= max_warning.uch)
@@ -1166,7 +1124,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG:
-					if (!(str >> min_warning.db && str.eof()))
+					if (str_to_num_full(min_warning_str,min_warning.db) == false)
 						throw_err_format("min_warning",dev_name,"Attribute::init_opt_prop()");
 					min_warning.ulg = (DevULong)min_warning.db;
 					if(alarm_conf.test(max_warn) && min_warning.ulg >= max_warning.ulg)
@@ -1174,7 +1132,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG64:
-					if (!(str >> min_warning.db && str.eof()))
+					if (str_to_num_full(min_warning_str,min_warning.db) == false)
 						throw_err_format("min_warning",dev_name,"Attribute::init_opt_prop()");
 					min_warning.ulg64 = (DevULong64)min_warning.db;
 					if(alarm_conf.test(max_warn) && min_warning.ulg64 >= max_warning.ulg64)
@@ -1182,7 +1140,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ENCODED:
-					if (!(str >> min_warning.sh && str.eof()))
+					if (str_to_num_full(min_warning_str,min_warning.sh) == false)
 						throw_err_format("min_warning",dev_name,"Attribute::init_opt_prop()");
 					min_warning.uch = (DevUChar)min_warning.sh;
 					if(alarm_conf.test(max_warn) && min_warning.uch >= max_warning.uch)
@@ -1213,25 +1171,17 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 				(data_type != Tango::DEV_BOOLEAN) &&
 				(data_type != Tango::DEV_STATE))
 			{
-				if (empty == false)
-				{
-					str.str("");
-					str.clear();
-				}
-
-				str << max_warning_str;
-				empty = false;
 				switch (data_type)
 				{
 				case Tango::DEV_SHORT:
-					if (!(str >> max_warning.sh && str.eof()))
+					if (str_to_num_full(max_warning_str,max_warning.sh) == false)
 						throw_err_format("max_warning",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(min_warn) && min_warning.sh >= max_warning.sh)
 						throw_incoherent_val_err("min_warning","max_warning",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_LONG:
-					if (!(str >> max_warning.db && str.eof()))
+					if (str_to_num_full(max_warning_str,max_warning.db) == false)
 						throw_err_format("max_warning",dev_name,"Attribute::init_opt_prop()");
 					max_warning.lg = (DevLong)max_warning.db;
 					if(alarm_conf.test(min_warn) && min_warning.lg >= max_warning.lg)
@@ -1239,7 +1189,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_LONG64:
-					if (!(str >> max_warning.db && str.eof()))
+					if (str_to_num_full(max_warning_str,max_warning.db) == false)
 						throw_err_format("max_warning",dev_name,"Attribute::init_opt_prop()");
 					max_warning.lg64 = (DevLong64)max_warning.db;
 					if(alarm_conf.test(min_warn) && min_warning.lg64 >= max_warning.lg64)
@@ -1247,28 +1197,28 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_DOUBLE:
-					if (!(str >> max_warning.db && str.eof()))
+					if (str_to_num_full(max_warning_str,max_warning.db) == false)
 						throw_err_format("max_warning",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(min_warn) && min_warning.db >= max_warning.db)
 						throw_incoherent_val_err("min_warning","max_warning",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_FLOAT:
-					if (!(str >> max_warning.fl && str.eof()))
+					if (str_to_num_full(max_warning_str,max_warning.fl) == false)
 						throw_err_format("max_warning",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(min_warn) && min_warning.fl >= max_warning.fl)
 						throw_incoherent_val_err("min_warning","max_warning",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_USHORT:
-					if (!(str >> max_warning.ush && str.eof()))
+					if (str_to_num_full(max_warning_str,max_warning.ush) == false)
 						throw_err_format("max_warning",dev_name,"Attribute::init_opt_prop()");
 					if(alarm_conf.test(min_warn) && min_warning.ush >= max_warning.ush)
 						throw_incoherent_val_err("min_warning","max_warning",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_UCHAR:
-					if (!(str >> max_warning.sh && str.eof()))
+					if (str_to_num_full(max_warning_str,max_warning.sh) == false)
 						throw_err_format("max_warning",dev_name,"Attribute::init_opt_prop()");
 					max_warning.uch = (DevUChar)max_warning.sh;
 					if(alarm_conf.test(min_warn) && min_warning.uch >= max_warning.uch)
@@ -1276,7 +1226,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG:
-					if (!(str >> max_warning.db && str.eof()))
+					if (str_to_num_full(max_warning_str,max_warning.db) == false)
 						throw_err_format("max_warning",dev_name,"Attribute::init_opt_prop()");
 					max_warning.ulg = (DevULong)max_warning.db;
 					if(alarm_conf.test(min_warn) && min_warning.ulg >= max_warning.ulg)
@@ -1284,7 +1234,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ULONG64:
-					if (!(str >> max_warning.db && str.eof()))
+					if (str_to_num_full(max_warning_str,max_warning.db) == false)
 						throw_err_format("max_warning",dev_name,"Attribute::init_opt_prop()");
 					max_warning.ulg64 = (DevULong64)max_warning.db;
 					if(alarm_conf.test(min_warn) && min_warning.ulg64 >= max_warning.ulg64)
@@ -1292,7 +1242,7 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 					break;
 
 				case Tango::DEV_ENCODED:
-					if (!(str >> max_warning.sh && str.eof()))
+					if (str_to_num_full(max_warning_str,max_warning.sh) == false)
 						throw_err_format("max_warning",dev_name,"Attribute::init_opt_prop()");
 					max_warning.uch = (DevUChar)max_warning.sh;
 					if(alarm_conf.test(min_warn) && min_warning.uch >= max_warning.uch)
@@ -1353,68 +1303,60 @@ void Attribute::init_opt_prop(vector<AttrProperty> &prop_list,string &dev_name)
 				(data_type != Tango::DEV_BOOLEAN) &&
 				(data_type != Tango::DEV_STATE))
 			{
-				if (empty == false)
-				{
-					str.str("");
-					str.clear();
-				}
-
-				str << delta_val_str;
-				empty = false;
 				switch (data_type)
 				{
 				case Tango::DEV_SHORT:
-					if (!(str >> delta_val.sh && str.eof()))
+					if (str_to_num_full(delta_val_str,delta_val.sh) == false)
 						throw_err_format("delta_val",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_LONG:
-					if (!(str >> delta_val.db && str.eof()))
+					if (str_to_num_full(delta_val_str,delta_val.db) == false)
 						throw_err_format("delta_val",dev_name,"Attribute::init_opt_prop()");
 					delta_val.lg = (DevLong)delta_val.db;
 					break;
 
 				case Tango::DEV_LONG64:
-					if (!(str >> delta_val.db && str.eof()))
+					if (str_to_num_full(delta_val_str,delta_val.db) == false)
 						throw_err_format("delta_val",dev_name,"Attribute::init_opt_prop()");
 					delta_val.lg64 = (DevLong64)delta_val.db;
 					break;
 
 				case Tango::DEV_DOUBLE:
-					if (!(str >> delta_val.db && str.eof()))
+					if (str_to_num_full(delta_val_str,delta_val.db) == false)
 						throw_err_format("delta_val",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_FLOAT:
-					if (!(str >> delta_val.fl && str.eof()))
+					if (str_to_num_full(delta_val_str,delta_val.fl) == false)
 						throw_err_format("delta_val",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_USHORT:
-					if (!(str >> delta_val.ush && str.eof()))
+					if (str_to_num_full(delta_val_str,delta_val.ush) == false)
 						throw_err_format("delta_val",dev_name,"Attribute::init_opt_prop()");
 					break;
 
 				case Tango::DEV_UCHAR:
-					if (!(str >> delta_val.sh && str.eof()))
+					if (str_to_num_full(delta_val_str,delta_val.sh) == false)
 						throw_err_format("delta_val",dev_name,"Attribute::init_opt_prop()");
 					delta_val.uch = (DevUChar)delta_val.sh;
 					break;
 
 				case Tango::DEV_ULONG:
-					if (!(str >> delta_val.db && str.eof()))
+					if (str_to_num_full(delta_val_str,delta_val.db) == false)
 						throw_err_format("delta_val",dev_name,"Attribute::init_opt_prop()");
 					delta_val.ulg = (DevULong)delta_val.db;
 					break;
 
 				case Tango::DEV_ULONG64:
-					if (!(str >> delta_val.db && str.eof()))
+					if (str_to_num_full(delta_val_str,delta_val.db) == false)
 						throw_err_format("delta_val",dev_name,"Attribute::init_opt_prop()");
 					delta_val.ulg64 = (DevULong64)delta_val.db;
 					break;
 
 				case Tango::DEV_ENCODED:
-					if (!(str >> delta_val.sh && str.eof()))
+					if (str_to_num_full(delta_val_str,delta_val.sh) == false)
 						throw_err_format("delta_val",dev_name,"Attribute::init_opt_prop()");
 					delta_val.uch = (DevUChar)delta_val.sh;
 					break;
@@ -4755,19 +4697,16 @@ void Attribute::upd_database(const Tango::AttributeConfig &conf,string &dev_name
 // strings are really number
 //
 
-	TangoSys_MemStream str;
-	str.precision(TANGO_FLOAT_PRECISION);
-
-	CHECK_PROP(conf.min_value,str,dev_name,db_d,db_del,
+	CHECK_PROP(conf.min_value,dev_name,db_d,db_del,
 	           prop_to_update,prop_to_delete,"min_value",def_user_prop,unused);
 
-	CHECK_PROP(conf.max_value,str,dev_name,db_d,db_del,
+	CHECK_PROP(conf.max_value,dev_name,db_d,db_del,
 	           prop_to_update,prop_to_delete,"max_value",def_user_prop,unused);
 
-	CHECK_PROP(conf.min_alarm,str,dev_name,db_d,db_del,
+	CHECK_PROP(conf.min_alarm,dev_name,db_d,db_del,
 	           prop_to_update,prop_to_delete,"min_alarm",def_user_prop,unused);
 
-	CHECK_PROP(conf.max_alarm,str,dev_name,db_d,db_del,
+	CHECK_PROP(conf.max_alarm,dev_name,db_d,db_del,
 	           prop_to_update,prop_to_delete,"max_alarm",def_user_prop,unused);
 
 //
@@ -4878,9 +4817,6 @@ void Attribute::upd_database(const Tango::AttributeConfig_3 &conf,string &dev_na
 	size_t nb_class = def_class_prop.size();
 	string usr_def_val;
 
-	TangoSys_MemStream str;
-	str.precision(TANGO_FLOAT_PRECISION);
-
 	if (state_or_status == false)
 	{
 
@@ -4906,26 +4842,26 @@ void Attribute::upd_database(const Tango::AttributeConfig_3 &conf,string &dev_na
 //
 
 
-		CHECK_PROP(conf.min_value,str,dev_name,db_d,db_del,
+		CHECK_PROP(conf.min_value,dev_name,db_d,db_del,
 				   prop_to_update,prop_to_delete,"min_value",def_user_prop,def_class_prop);
 
-		CHECK_PROP(conf.max_value,str,dev_name,db_d,db_del,
+		CHECK_PROP(conf.max_value,dev_name,db_d,db_del,
 				   prop_to_update,prop_to_delete,"max_value",def_user_prop,def_class_prop);
 
 //
 // Check for alarm related data
 //
 
-		CHECK_PROP(conf.att_alarm.min_alarm,str,dev_name,db_d,db_del,
+		CHECK_PROP(conf.att_alarm.min_alarm,dev_name,db_d,db_del,
 				   prop_to_update,prop_to_delete,"min_alarm",def_user_prop,def_class_prop);
 
-		CHECK_PROP(conf.att_alarm.max_alarm,str,dev_name,db_d,db_del,
+		CHECK_PROP(conf.att_alarm.max_alarm,dev_name,db_d,db_del,
 				   prop_to_update,prop_to_delete,"max_alarm",def_user_prop,def_class_prop);
 
-		CHECK_PROP(conf.att_alarm.min_warning,str,dev_name,db_d,db_del,
+		CHECK_PROP(conf.att_alarm.min_warning,dev_name,db_d,db_del,
 				   prop_to_update,prop_to_delete,"min_warning",def_user_prop,def_class_prop);
 
-		CHECK_PROP(conf.att_alarm.max_warning,str,dev_name,db_d,db_del,
+		CHECK_PROP(conf.att_alarm.max_warning,dev_name,db_d,db_del,
 				   prop_to_update,prop_to_delete,"max_warning",def_user_prop,def_class_prop);
 
 
@@ -5007,70 +4943,53 @@ void Attribute::upd_database(const Tango::AttributeConfig_3 &conf,string &dev_na
 				(data_type != Tango::DEV_STATE))
 			{
 				double db;
+				char num_buf[TANGO_NUM_BUF_SIZE];
+				bool num_written = true;
 
-				str.str("");
-				str.clear();
-				str << conf.att_alarm.delta_val;
-				if (!(str >> db && str.eof()))
+				if (str_to_num_full(conf.att_alarm.delta_val.in(),db) == false)
 					throw_err_format("delta_val",dev_name,"Attribute::upd_database()");
 				switch (data_type)
 				{
 				case Tango::DEV_SHORT:
-					str.str("");
-					str.clear();
-					str << (DevShort)db;
+					num_to_str(num_buf,(DevShort)db);
 					break;
 
 				case Tango::DEV_LONG:
-					str.str("");
-					str.clear();
-					str << (DevLong)db;
+					num_to_str(num_buf,(DevLong)db);
 					break;
 
 				case Tango::DEV_LONG64:
-					str.str("");
-					str.clear();
-					str << (DevLong64)db;
+					num_to_str(num_buf,(DevLong64)db);
 					break;
 
 				case Tango::DEV_DOUBLE:
-					break;
-
 				case Tango::DEV_FLOAT:
+				default:
+					num_written = false;
 					break;
 
 				case Tango::DEV_USHORT:
-					str.str("");
-					str.clear();
-					(db < 0.0) ? str << (DevUShort)(-db) : str << (DevUShort)db;
+					num_to_str(num_buf,(db < 0.0) ? (DevUShort)(-db) : (DevUShort)db);
 					break;
 
 				case Tango::DEV_UCHAR:
-					str.str("");
-					str.clear();
-					(db < 0.0) ? str << (short)((DevUChar)(-db)) : str << (short)((DevUChar)db);
+					num_to_str(num_buf,(db < 0.0) ? (short)((DevUChar)(-db)) : (short)((DevUChar)db));
 					break;
 
 				case Tango::DEV_ULONG:
-					str.str("");
-					str.clear();
-					(db < 0.0) ? str << (DevULong)(-db) : str << (DevULong)db;
+					num_to_str(num_buf,(db < 0.0) ? (DevULong)(-db) : (DevULong)db);
 					break;
 
 				case Tango::DEV_ULONG64:
-					str.str("");
-					str.clear();
-					(db < 0.0) ? str << (DevULong64)(-db) : str << (DevULong64)db;
+					num_to_str(num_buf,(db < 0.0) ? (DevULong64)(-db) : (DevULong64)db);
 					break;
 
 				case Tango::DEV_ENCODED:
-					str.str("");
-					str.clear();
-					(db < 0.0) ? str << (short)(DevUChar)(-db) : str << (short)(DevUChar)db;
+					num_to_str(num_buf,(db < 0.0) ? (short)(DevUChar)(-db) : (short)(DevUChar)db);
 					break;
 				}
-				if (data_type != Tango::DEV_FLOAT && data_type != Tango::DEV_DOUBLE)
-					delta_val_tmp_str = str.str();
+				if (num_written == true)
+					delta_val_tmp_str = num_buf;
 			}
 			else
 				throw_err_data_type("delta_val",dev_name,"Attribute::upd_database()");
@@ -5151,16 +5070,12 @@ void Attribute::upd_database(const Tango::AttributeConfig_3 &conf,string &dev_na
                 (data_type != Tango::DEV_BOOLEAN) &&
                 (data_type != Tango::DEV_STATE))
             {
-                str.str("");
-                str.clear();
-                str << conf.att_alarm.delta_t;
                 double db;
-                if (!(str >> db && str.eof()))
+                char num_buf[TANGO_NUM_BUF_SIZE];
+                if (str_to_num_full(conf.att_alarm.delta_t.in(),db) == false)
                     throw_err_format("delta_t",dev_name,"Attribute::upd_database()");
-                str.str("");
-                str.clear();
-                str << (long)db;
-                delta_t_tmp_str = str.str();
+                num_to_str(num_buf,(long)db);
+                delta_t_tmp_str = num_buf;
             }
             else
                 throw_err_data_type("delta_t",dev_name,"Attribute::upd_database()");
@@ -9095,6 +9010,7 @@ bool Attribute::check_alarm()
 	if ( quality != Tango::ATTR_VALID )
 	{
 	    log_quality();
+	    store_alarm_cache();
 		return returned;
 	}
 
@@ -9138,10 +9054,27 @@ bool Attribute::check_alarm()
 	}
 
     log_quality();
+    store_alarm_cache();
 
 	return returned;
 }
 
+//+-------------------------------------------------------------------------
+//
+// method :		Attribute::store_alarm_cache
+//
+// description :	Memorize the quality computed by the alarm check and
+//			when it has been done. The device State may use it
+//			instead of reading the attribute again
+//
+//--------------------------------------------------------------------------
+
+void Attribute::store_alarm_cache()
+{
+	ext->alarm_cache_qua = quality;
+	ext->alarm_cache_date = get_date_ms();
+}
+
 
 //+-------------------------------------------------------------------------
 //
@@ -11241,49 +11174,53 @@ void Attribute::fire_change_event(DevFailed *except)
 			bool force_change   = false;
 			bool quality_change = false;
 
-			if ((except != NULL) ||
-				(quality == Tango::ATTR_INVALID) ||
-				((except == NULL) && (ext->prev_change_event.err == true)) ||
-				((quality != Tango::ATTR_INVALID) &&
-				(ext->prev_change_event.quality == Tango::ATTR_INVALID)))
-			{
-				force_change = true;
-			}
-
 			vector<string> filterable_names;
 			vector<double> filterable_data;
 			vector<string> filterable_names_lg;
 			vector<long> filterable_data_lg;
 
-			if (except != NULL)
 			{
-				ext->prev_change_event.err    = true;
-				ext->prev_change_event.except = *except;
-			}
-			else
-			{
-				Tango::AttrQuality the_quality;
+				omni_mutex_lock oml(ext->event_mutex);
 
-				if (send_attr_4 != NULL)
+				if ((except != NULL) ||
+					(quality == Tango::ATTR_INVALID) ||
+					((except == NULL) && (ext->prev_change_event.err == true)) ||
+					((quality != Tango::ATTR_INVALID) &&
+					(ext->prev_change_event.quality == Tango::ATTR_INVALID)))
 				{
-					the_quality = send_attr_4->quality;
-					ext->prev_change_event.value_4 = send_attr_4->value;
-				}
-				else
-				{
-					the_quality = send_attr->quality;
-					ext->prev_change_event.value = send_attr->value;
+					force_change = true;
 				}
 
-				if (ext->prev_change_event.quality !=  the_quality)
+				if (except != NULL)
 				{
-					quality_change = true;
+					ext->prev_change_event.err    = true;
+					ext->prev_change_event.except = *except;
 				}
+				else
+				{
+					Tango::AttrQuality the_quality;
 
-				ext->prev_change_event.quality = the_quality;
-				ext->prev_change_event.err = false;
+					if (send_attr_4 != NULL)
+					{
+						the_quality = send_attr_4->quality;
+						ext->prev_change_event.value_4 = send_attr_4->value;
+					}
+					else
+					{
+						the_quality = send_attr->quality;
+						ext->prev_change_event.value = send_attr->value;
+					}
+
+					if (ext->prev_change_event.quality !=  the_quality)
+					{
+						quality_change = true;
+					}
+
+					ext->prev_change_event.quality = the_quality;
+					ext->prev_change_event.err = false;
+				}
+				ext->prev_change_event.inited = true;
 			}
-			ext->prev_change_event.inited = true;
 
 			filterable_names.push_back("forced_event");
 			if (force_change == true)
@@ -11627,56 +11564,59 @@ void Attribute::fire_archive_event(DevFailed *except)
 			double delta_change_rel = 0.0;
 			double delta_change_abs = 0.0;
 
-            if (event_supplier_nd != NULL)
-                event_supplier_nd->detect_change(*this, ad,true,
-							delta_change_rel,
-							delta_change_abs,
-							except,
-							force_change,
-							ext->dev);
-            else if (event_supplier_zmq != NULL)
-                event_supplier_zmq->detect_change(*this, ad,true,
-							delta_change_rel,
-							delta_change_abs,
-							except,
-							force_change,
-							ext->dev);
-
-
 			vector<string> filterable_names;
 			vector<double> filterable_data;
 			vector<string> filterable_names_lg;
 			vector<long> filterable_data_lg;
 
-			if (except != NULL)
 			{
-				ext->prev_archive_event.err    = true;
-				ext->prev_archive_event.except = *except;
-			}
-			else
-			{
-				Tango::AttrQuality the_quality;
-
-				if (send_attr_4 != NULL)
+				omni_mutex_lock oml(ext->event_mutex);
+
+				if (event_supplier_nd != NULL)
+					event_supplier_nd->detect_change(*this, ad,true,
+								delta_change_rel,
+								delta_change_abs,
+								except,
+								force_change,
+								ext->dev);
+				else if (event_supplier_zmq != NULL)
+					event_supplier_zmq->detect_change(*this, ad,true,
+								delta_change_rel,
+								delta_change_abs,
+								except,
+								force_change,
+								ext->dev);
+
+				if (except != NULL)
 				{
-					ext->prev_archive_event.value_4 = send_attr_4->value;
-					the_quality = send_attr_4->quality;
+					ext->prev_archive_event.err    = true;
+					ext->prev_archive_event.except = *except;
 				}
 				else
 				{
-					ext->prev_archive_event.value = send_attr->value;
-					the_quality = send_attr->quality;
-				}
+					Tango::AttrQuality the_quality;
 
-				if (ext->prev_archive_event.quality !=  the_quality)
-				{
-					quality_change = true;
-				}
+					if (send_attr_4 != NULL)
+					{
+						ext->prev_archive_event.value_4 = send_attr_4->value;
+						the_quality = send_attr_4->quality;
+					}
+					else
+					{
+						ext->prev_archive_event.value = send_attr->value;
+						the_quality = send_attr->quality;
+					}
 
-				ext->prev_archive_event.quality = the_quality;
-				ext->prev_archive_event.err = false;
+					if (ext->prev_archive_event.quality !=  the_quality)
+					{
+						quality_change = true;
+					}
+
+					ext->prev_archive_event.quality = the_quality;
+					ext->prev_archive_event.err = false;
+				}
+				ext->prev_archive_event.inited = true;
 			}
-			ext->prev_archive_event.inited = true;
 
 			filterable_names.push_back("forced_event");
 			if (force_change == true)
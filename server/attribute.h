@@ -2135,6 +2135,10 @@ public:
 
 	void save_alarm_quality() {ext->old_quality=quality;ext->old_alarm=alarm;}
 
+	AttrQuality get_alarm_cache_quality() {return ext->alarm_cache_qua;}
+	double get_alarm_cache_date() {return ext->alarm_cache_date;}
+	void store_alarm_cache();
+
 	bool is_startup_exception() {return ext->check_startup_exceptions;}
 	void throw_startup_exception(const char*);
 
@@ -2173,7 +2177,8 @@ protected:
                          event_periodic_client_3(false),event_change_client_3(false),event_archive_client_3(false),
                          event_user_client_3(false),user_attr_mutex(NULL),dr_event_implmented(false),
                          scalar_str_attr_release(false),notifd_event(false),zmq_event(false),
-                         check_startup_exceptions(false), startup_exceptions_clear(true) {}
+                         check_startup_exceptions(false), startup_exceptions_clear(true),
+                         alarm_cache_qua(Tango::ATTR_INVALID),alarm_cache_date(0.0) {}
 
         Tango::DispLevel 	disp_level;						// Display level
         long				poll_period;					// Polling period
@@ -2214,6 +2219,7 @@ protected:
         Tango::DevULong64	tmp_ulo64[2];
         Tango::DevState		tmp_state[2];
         omni_mutex			attr_mutex;						// Mutex to protect the attributes shared data buffer
+        omni_mutex			event_mutex;					// Mutex to protect the previous event values
         omni_mutex			*user_attr_mutex;				// Ptr for user mutex in case he manages exclusion
         AttrSerialModel		attr_serial_model;				// Flag for attribute serialization model
         bool				dr_event_implmented;			// Flag true if fire data ready event is implemented
@@ -2226,6 +2232,8 @@ protected:
         map<string,const DevFailed> startup_exceptions;		// Map containing exceptions related to attribute configuration raised during the server startup sequence
         bool 				check_startup_exceptions;		// Flag set to true if there is at least one exception in startup_exceptions map
         bool 				startup_exceptions_clear;		// Flag set to true when the cause for the device startup exceptions has been fixed
+        AttrQuality         alarm_cache_qua;                // Quality computed by the last alarm check
+        double              alarm_cache_date;               // Date (mS) of the last alarm check
     };
 
 	AttributeExt		*ext;
@@ -2422,15 +2430,14 @@ inline bool Attribute::prop_in_list(const char *prop_name,string &prop_str,size_
 //
 // Arg list :
 //		A : property as a string
-//		B : stream
-//		C : device name
-//		D : DbData for db update
-//		E : DbData for db delete
-//		F : Number of prop to update
-//		G : Number of prop to delete
-//		H : Property name
-//		I : Default user properties vector ref
-//      J : Default class properties vector ref
+//		B : device name
+//		C : DbData for db update
+//		D : DbData for db delete
+//		E : Number of prop to update
+//		F : Number of prop to delete
+//		G : Property name
+//		H : Default user properties vector ref
+//      I : Default class properties vector ref
 //
 // Too many parameters ?
 //
@@ -2456,10 +2463,10 @@ inline bool Attribute::prop_in_list(const char *prop_name,string &prop_str,size_
 // input value to the attribute data type before comparison with the user default value.
 //
 
-#define CHECK_PROP(A,B,C,D,E,F,G,H,I,J) \
+#define CHECK_PROP(A,B,C,D,E,F,G,H,I) \
 { \
-	size_t nb_user = I.size(); \
-	size_t nb_class = J.size(); \
+	size_t nb_user = H.size(); \
+	size_t nb_class = I.size(); \
 	string usr_def_val; \
 	string class_def_val; \
 	bool user_defaults = false; \
@@ -2472,30 +2479,21 @@ inline bool Attribute::prop_in_list(const char *prop_name,string &prop_str,size_
     bool equal_user_def = false; \
     bool equal_class_def = false; \
 \
-    user_defaults = prop_in_list(H,usr_def_val,nb_user,I); \
+    user_defaults = prop_in_list(G,usr_def_val,nb_user,H); \
     if (user_defaults) \
     { \
-        B.str(""); \
-        B.clear(); \
-        B << usr_def_val; \
-        B >> user_def_val_db; \
+        str_to_num(usr_def_val.c_str(),user_def_val_db); \
     } \
-    class_defaults = prop_in_list(H,class_def_val,nb_class,J); \
+    class_defaults = prop_in_list(G,class_def_val,nb_class,I); \
     if (class_defaults) \
     { \
-        B.str(""); \
-        B.clear(); \
-        B << class_def_val; \
-        B >> class_def_val_db;  \
+        str_to_num(class_def_val.c_str(),class_def_val_db); \
     } \
 \
     if(user_defaults) \
     { \
         double db; \
-        B.str(""); \
-        B.clear(); \
-        B << A; \
-        if (B >> db && B.eof()) \
+        if (str_to_num_full(A.in(),db) == true) \
         { \
             switch (data_type) \
             { \
@@ -2555,10 +2553,7 @@ inline bool Attribute::prop_in_list(const char *prop_name,string &prop_str,size_
     if(class_defaults) \
     { \
         double db; \
-        B.str(""); \
-        B.clear(); \
-        B << A; \
-        if (B >> db && B.eof()) \
+        if (str_to_num_full(A.in(),db) == true) \
         { \
             switch (data_type) \
             { \
@@ -2681,83 +2676,68 @@ inline bool Attribute::prop_in_list(const char *prop_name,string &prop_str,size_
 				(data_type != Tango::DEV_STATE)) \
 			{ \
 				double db; \
+				char num_buf[TANGO_NUM_BUF_SIZE]; \
+				bool num_written = true; \
 \
-				B.str(""); \
-				B.clear(); \
-				B << A; \
-                if (!(B >> db && B.eof())) \
+                if (str_to_num_full(A.in(),db) == false) \
                 { \
-                    throw_err_format(H,C,"Attribute::upd_database"); \
+                    throw_err_format(G,B,"Attribute::upd_database"); \
                 }\
 				switch (data_type) \
 				{ \
 				case Tango::DEV_SHORT: \
-					B.str(""); \
-					B.clear(); \
-					B << (DevShort)db; \
+					num_to_str(num_buf,(DevShort)db); \
 					break; \
 \
 				case Tango::DEV_LONG: \
-					B.str(""); \
-					B.clear(); \
-					B << (DevLong)db; \
+					num_to_str(num_buf,(DevLong)db); \
 					break;\
 \
 				case Tango::DEV_LONG64: \
-					B.str(""); \
-					B.clear(); \
-					B << (DevLong64)db; \
+					num_to_str(num_buf,(DevLong64)db); \
 					break;\
 \
 				case Tango::DEV_DOUBLE: \
-					break; \
-\
 				case Tango::DEV_FLOAT: \
+				default: \
+					num_written = false; \
 					break; \
 \
 				case Tango::DEV_USHORT: \
-					B.str(""); \
-					B.clear(); \
-					(db < 0.0) ? B << (DevUShort)(-db) : B << (DevUShort)db; \
+					num_to_str(num_buf,(db < 0.0) ? (DevUShort)(-db) : (DevUShort)db); \
 					break; \
 \
 				case Tango::DEV_UCHAR: \
-					B.str(""); \
-					B.clear(); \
-					(db < 0.0) ? B << (short)((DevUChar)(-db)) : B << (short)((DevUChar)db); \
+					num_to_str(num_buf,(db < 0.0) ? (short)((DevUChar)(-db)) : (short)((DevUChar)db)); \
 					break; \
 \
 				case Tango::DEV_ULONG: \
-					B.str(""); \
-					B.clear(); \
-					(db < 0.0) ? B << (DevULong)(-db) : B << (DevULong)db; \
+					num_to_str(num_buf,(db < 0.0) ? (DevULong)(-db) : (DevULong)db); \
 					break; \
 \
 				case Tango::DEV_ULONG64: \
-					B.str(""); \
-					B.clear(); \
-					(db < 0.0) ? B << (DevULong64)(-db) : B << (DevULong64)db; \
+					num_to_str(num_buf,(db < 0.0) ? (DevULong64)(-db) : (DevULong64)db); \
 					break; \
 				} \
-                if (data_type != Tango::DEV_FLOAT && data_type != Tango::DEV_DOUBLE) \
-                    tmp = B.str(); \
+                if (num_written == true) \
+                    tmp = num_buf; \
 			} \
 			else \
 			{ \
-				throw_err_data_type(H,C,"Attribute::upd_database"); \
+				throw_err_data_type(G,B,"Attribute::upd_database"); \
 			} \
 		} \
 \
-		DbDatum dd(H); \
+		DbDatum dd(G); \
 		dd << tmp.c_str(); \
-		D.push_back(dd); \
-		F++; \
+		C.push_back(dd); \
+		E++; \
 	} \
 	else \
 	{ \
-		DbDatum del_dd(H); \
-		E.push_back(del_dd); \
-		G++; \
+		DbDatum del_dd(G); \
+		D.push_back(del_dd); \
+		F++; \
 	} \
 } \
 
@@ -131,6 +131,7 @@ BlackBox::BlackBox():box(DefaultBlackBoxDepth)
 	insert_elt = 0;
 	nb_elt = 0;
 	max_elt = DefaultBlackBoxDepth;
+	elt_sync = new omni_mutex[max_elt];
 }
 
 BlackBox::BlackBox(long max_size):box(max_size)
@@ -138,6 +139,12 @@ BlackBox::BlackBox(long max_size):box(max_size)
 	insert_elt = 0;
 	nb_elt = 0;
 	max_elt = max_size;
+	elt_sync = new omni_mutex[max_elt];
+}
+
+BlackBox::~BlackBox()
+{
+	delete [] elt_sync;
 }
 
 //+-------------------------------------------------------------------------
@@ -156,53 +163,33 @@ void BlackBox::insert_corba_attr(BlackBoxElt_AttrType attr)
 {
 
 //
-// Take mutex
+// Reserve a slot in the box (returned locked)
 //
 
-	sync.lock();
+	long slot = reserve_slot();
 
 //
 // Insert elt in the box
 //
 
-	box[insert_elt].req_type = Req_Attribute;
-	box[insert_elt].attr_type = attr;
-	box[insert_elt].op_type = Op_Unknown;
-	box[insert_elt].client_ident = false;
+	box[slot].req_type = Req_Attribute;
+	box[slot].attr_type = attr;
+	box[slot].op_type = Op_Unknown;
+	box[slot].client_ident = false;
 
-#ifdef _TG_WINDOWS_
-//
-// Note that the exact conversion between milli-sec and u-sec will be done
-// only when data is send back to user. This save some times in unnecessary
-// computation
-//
-	struct _timeb t;
-	_ftime(&t);
-
-	box[insert_elt].when.tv_usec = (long)t.millitm;
-	box[insert_elt].when.tv_sec = (unsigned long)t.time;
-#else
-	struct timezone tz;
-	gettimeofday(&box[insert_elt].when,&tz);
-#endif
+	set_date(box[slot].when);
 
 //
 // get client address
 //
 
-	get_client_host();
-
-//
-// manage insert and read indexes
-//
-
-	inc_indexes();
+	get_client_host(slot);
 
 //
-// Release mutex
+// Release the slot
 //
 
-	sync.unlock();
+	elt_sync[slot].unlock();
 }
 
 //+-------------------------------------------------------------------------
@@ -221,58 +208,38 @@ void BlackBox::insert_corba_attr(BlackBoxElt_AttrType attr)
 
 void BlackBox::insert_cmd(const char *cmd,long vers,DevSource sour)
 {
-	sync.lock();
+	long slot = reserve_slot();
 
-	insert_cmd_nl(cmd,vers,sour);
+	insert_cmd_nl(cmd,vers,sour,slot);
 
-	sync.unlock();
+	elt_sync[slot].unlock();
 }
 
-void BlackBox::insert_cmd_nl(const char *cmd,long vers,DevSource sour)
+void BlackBox::insert_cmd_nl(const char *cmd,long vers,DevSource sour,long slot)
 {
 
 //
 // Insert elt in the box
 //
 
-	box[insert_elt].req_type = Req_Operation;
-	box[insert_elt].attr_type = Attr_Unknown;
+	box[slot].req_type = Req_Operation;
+	box[slot].attr_type = Attr_Unknown;
 	if (vers == 1)
-		box[insert_elt].op_type = Op_Command_inout;
+		box[slot].op_type = Op_Command_inout;
 	else if (vers <= 3)
-		box[insert_elt].op_type = Op_Command_inout_2;
+		box[slot].op_type = Op_Command_inout_2;
 	else
-		box[insert_elt].op_type = Op_Command_inout_4;
-	box[insert_elt].cmd_name = cmd;
-	box[insert_elt].source = sour;
-	box[insert_elt].client_ident = false;
-#ifdef _TG_WINDOWS_
-//
-// Note that the exact conversion between milli-sec and u-sec will be done
-// only when data is send back to user. This save some times in unnecessary
-// computation
-//
-	struct _timeb t;
-	_ftime(&t);
-
-	box[insert_elt].when.tv_usec = (long)t.millitm;
-	box[insert_elt].when.tv_sec = (unsigned long)t.time;
-#else
-	struct timezone tz;
-	gettimeofday(&box[insert_elt].when,&tz);
-#endif
+		box[slot].op_type = Op_Command_inout_4;
+	box[slot].cmd_name = cmd;
+	box[slot].source = sour;
+	box[slot].client_ident = false;
+	set_date(box[slot].when);
 
 //
 // get client address
 //
 
-	get_client_host();
-
-//
-// manage insert and read indexes
-//
-
-	inc_indexes();
+	get_client_host(slot);
 }
 
 //+-------------------------------------------------------------------------
@@ -291,13 +258,13 @@ void BlackBox::insert_cmd_nl(const char *cmd,long vers,DevSource sour)
 
 void BlackBox::insert_cmd_cl_ident(const char *cmd,const ClntIdent &cl_id,long vers,DevSource sour)
 {
-	sync.lock();
+	long slot = reserve_slot();
 
 //
 // Add basic info in the box
 //
 
-	insert_cmd_nl(cmd,vers,sour);
+	insert_cmd_nl(cmd,vers,sour,slot);
 
 //
 // Check if the command is executed due to polling
@@ -307,7 +274,7 @@ void BlackBox::insert_cmd_cl_ident(const char *cmd,const ClntIdent &cl_id,long v
 	omni_thread::value_t *ip = omni_thread::self()->get_value(key);
 	if (ip == NULL)
 	{
-		sync.unlock();
+		elt_sync[slot].unlock();
 		return;
 	}
 
@@ -317,9 +284,9 @@ void BlackBox::insert_cmd_cl_ident(const char *cmd,const ClntIdent &cl_id,long v
 //
 
 	add_cl_ident(cl_id,static_cast<client_addr *>(ip));
-	update_client_host(static_cast<client_addr *>(ip));
+	update_client_host(static_cast<client_addr *>(ip),slot);
 
-	sync.unlock();
+	elt_sync[slot].unlock();
 }
 
 //+-------------------------------------------------------------------------
@@ -370,18 +337,12 @@ void BlackBox::add_cl_ident(const ClntIdent &cl_ident,client_addr *cl_addr)
 //
 //--------------------------------------------------------------------------
 
-void BlackBox::update_client_host(client_addr *ip)
+void BlackBox::update_client_host(client_addr *ip,long slot)
 {
-	long local_insert_elt = insert_elt;
-	if (local_insert_elt == 0)
-		local_insert_elt = max_elt - 1;
-	else
-		local_insert_elt--;
-
-	box[local_insert_elt].client_ident = true;
-	box[local_insert_elt].client_lang = ip->client_lang;
-	box[local_insert_elt].client_pid = ip->client_pid;
-	box[local_insert_elt].java_main_class = ip->java_main_class;
+	box[slot].client_ident = true;
+	box[slot].client_lang = ip->client_lang;
+	box[slot].client_pid = ip->client_pid;
+	box[slot].java_main_class = ip->java_main_class;
 }
 
 
@@ -399,18 +360,18 @@ void BlackBox::update_client_host(client_addr *ip)
 
 void BlackBox::insert_op(BlackBoxElt_OpType op)
 {
-	sync.lock();
+	long slot = reserve_slot();
 
-	insert_op_nl(op);
+	insert_op_nl(op,slot);
 
-	sync.unlock();
+	elt_sync[slot].unlock();
 }
 
 void BlackBox::insert_op(BlackBoxElt_OpType op,const ClntIdent &cl_id)
 {
-	sync.lock();
+	long slot = reserve_slot();
 
-	insert_op_nl(op);
+	insert_op_nl(op,slot);
 
 //
 // Check if the command is executed due to polling
@@ -420,7 +381,7 @@ void BlackBox::insert_op(BlackBoxElt_OpType op,const ClntIdent &cl_id)
 	omni_thread::value_t *ip = omni_thread::self()->get_value(key);
 	if (ip == NULL)
 	{
-		sync.unlock();
+		elt_sync[slot].unlock();
 		return;
 	}
 
@@ -430,48 +391,28 @@ void BlackBox::insert_op(BlackBoxElt_OpType op,const ClntIdent &cl_id)
 //
 
 	add_cl_ident(cl_id,static_cast<client_addr *>(ip));
-	update_client_host(static_cast<client_addr *>(ip));
+	update_client_host(static_cast<client_addr *>(ip),slot);
 
-	sync.unlock();
+	elt_sync[slot].unlock();
 }
 
-void BlackBox::insert_op_nl(BlackBoxElt_OpType op)
+void BlackBox::insert_op_nl(BlackBoxElt_OpType op,long slot)
 {
 //
 // Insert elt in the box
 //
 
-	box[insert_elt].req_type = Req_Operation;
-	box[insert_elt].attr_type = Attr_Unknown;
-	box[insert_elt].op_type = op;
-	box[insert_elt].client_ident = false;
-#ifdef _TG_WINDOWS_
-//
-// Note that the exact conversion between milli-sec and u-sec will be done
-// only when data is send back to user. This save some times in unnecessary
-// computation
-//
-	struct _timeb t;
-	_ftime(&t);
-
-	box[insert_elt].when.tv_usec = (long)t.millitm;
-	box[insert_elt].when.tv_sec = (unsigned long)t.time;
-#else
-	struct timezone tz;
-	gettimeofday(&box[insert_elt].when,&tz);
-#endif
+	box[slot].req_type = Req_Operation;
+	box[slot].attr_type = Attr_Unknown;
+	box[slot].op_type = op;
+	box[slot].client_ident = false;
+	set_date(box[slot].when);
 
 //
 // get client address
 //
 
-	get_client_host();
-
-//
-// manage insert and read indexes
-//
-
-	inc_indexes();
+	get_client_host(slot);
 }
 
 //+-------------------------------------------------------------------------
@@ -493,137 +434,91 @@ void BlackBox::insert_attr(const Tango::DevVarStringArray &names,long vers,DevSo
 {
 
 //
-// Take mutex
+// Reserve a slot in the box (returned locked)
 //
 
-	sync.lock();
+	long slot = reserve_slot();
 
 //
 // Insert elt in the box
 //
 
-	box[insert_elt].req_type = Req_Operation;
-	box[insert_elt].attr_type = Attr_Unknown;
+	box[slot].req_type = Req_Operation;
+	box[slot].attr_type = Attr_Unknown;
 	switch (vers)
 	{
 	case 1 :
-		box[insert_elt].op_type = Op_Read_Attr;
+		box[slot].op_type = Op_Read_Attr;
 		break;
 
 	case 2 :
-		box[insert_elt].op_type = Op_Read_Attr_2;
+		box[slot].op_type = Op_Read_Attr_2;
 		break;
 
 	case 3 :
-		box[insert_elt].op_type = Op_Read_Attr_3;
+		box[slot].op_type = Op_Read_Attr_3;
 		break;
 
 	case 4 :
-		box[insert_elt].op_type = Op_Read_Attr_4;
+		box[slot].op_type = Op_Read_Attr_4;
 		break;
 	}
-	box[insert_elt].source = sour;
-	box[insert_elt].client_ident = false;
+	box[slot].source = sour;
+	box[slot].client_ident = false;
 
 
-	box[insert_elt].attr_names.clear();
+	box[slot].attr_names.resize(names.length());
 	for (unsigned long i = 0;i < names.length();i++)
-	{
-		string tmp_str(names[i]);
-		box[insert_elt].attr_names.push_back(tmp_str);
-	}
+		box[slot].attr_names[i] = names[i].in();
 
-#ifdef _TG_WINDOWS_
-//
-// Note that the exact conversion between milli-sec and u-sec will be done
-// only when data is send back to user. This save some times in unnecessary
-// computation
-//
-	struct _timeb t;
-	_ftime(&t);
-
-	box[insert_elt].when.tv_usec = (long)t.millitm;
-	box[insert_elt].when.tv_sec = (unsigned long)t.time;
-#else
-	struct timezone tz;
-	gettimeofday(&box[insert_elt].when,&tz);
-#endif
+	set_date(box[slot].when);
 
 //
 // get client address
 //
 
-	get_client_host();
+	get_client_host(slot);
 
 //
-// manage insert and read indexes
+// Release the slot
 //
 
-	inc_indexes();
-
-//
-// Release mutex
-//
-
-	sync.unlock();
+	elt_sync[slot].unlock();
 }
 
 void BlackBox::insert_attr(const Tango::DevVarStringArray &names,const ClntIdent &cl_id,TANGO_UNUSED(long vers),DevSource sour)
 {
 
 //
-// Take mutex
+// Reserve a slot in the box (returned locked)
 //
 
-	sync.lock();
+	long slot = reserve_slot();
 
 //
 // Insert elt in the box
 //
 
-	box[insert_elt].req_type = Req_Operation;
-	box[insert_elt].attr_type = Attr_Unknown;
+	box[slot].req_type = Req_Operation;
+	box[slot].attr_type = Attr_Unknown;
 
-	box[insert_elt].op_type = Op_Read_Attr_4;
+	box[slot].op_type = Op_Read_Attr_4;
 
-	box[insert_elt].source = sour;
-	box[insert_elt].client_ident = false;
+	box[slot].source = sour;
+	box[slot].client_ident = false;
 
 
-	box[insert_elt].attr_names.clear();
+	box[slot].attr_names.resize(names.length());
 	for (unsigned long i = 0;i < names.length();i++)
-	{
-		string tmp_str(names[i]);
-		box[insert_elt].attr_names.push_back(tmp_str);
-	}
+		box[slot].attr_names[i] = names[i].in();
 
-#ifdef _TG_WINDOWS_
-//
-// Note that the exact conversion between milli-sec and u-sec will be done
-// only when data is send back to user. This save some times in unnecessary
-// computation
-//
-	struct _timeb t;
-	_ftime(&t);
-
-	box[insert_elt].when.tv_usec = (long)t.millitm;
-	box[insert_elt].when.tv_sec = (unsigned long)t.time;
-#else
-	struct timezone tz;
-	gettimeofday(&box[insert_elt].when,&tz);
-#endif
+	set_date(box[slot].when);
 
 //
 // get client address
 //
 
-	get_client_host();
-
-//
-// manage insert and read indexes
-//
-
-	inc_indexes();
+	get_client_host(slot);
 
 //
 // Check if the command is executed due to polling
@@ -633,7 +528,7 @@ void BlackBox::insert_attr(const Tango::DevVarStringArray &names,const ClntIdent
 	omni_thread::value_t *ip = omni_thread::self()->get_value(key);
 	if (ip == NULL)
 	{
-		sync.unlock();
+		elt_sync[slot].unlock();
 		return;
 	}
 
@@ -643,29 +538,29 @@ void BlackBox::insert_attr(const Tango::DevVarStringArray &names,const ClntIdent
 //
 
 	add_cl_ident(cl_id,static_cast<client_addr *>(ip));
-	update_client_host(static_cast<client_addr *>(ip));
+	update_client_host(static_cast<client_addr *>(ip),slot);
 
 //
-// Release mutex
+// Release the slot
 //
 
-	sync.unlock();
+	elt_sync[slot].unlock();
 }
 
 void BlackBox::insert_attr(const Tango::AttributeValueList &att_list, long vers)
 {
-	sync.lock();
+	long slot = reserve_slot();
 
-	insert_attr_nl(att_list,vers);
+	insert_attr_nl(att_list,vers,slot);
 
-	sync.unlock();
+	elt_sync[slot].unlock();
 }
 
 void BlackBox::insert_attr(const Tango::AttributeValueList_4 &att_list, const ClntIdent &cl_id,TANGO_UNUSED(long vers))
 {
-	sync.lock();
+	long slot = reserve_slot();
 
-	insert_attr_nl_4(att_list);
+	insert_attr_nl_4(att_list,slot);
 
 //
 // Check if the command is executed due to polling
@@ -675,7 +570,7 @@ void BlackBox::insert_attr(const Tango::AttributeValueList_4 &att_list, const Cl
 	omni_thread::value_t *ip = omni_thread::self()->get_value(key);
 	if (ip == NULL)
 	{
-		sync.unlock();
+		elt_sync[slot].unlock();
 		return;
 	}
 
@@ -685,107 +580,61 @@ void BlackBox::insert_attr(const Tango::AttributeValueList_4 &att_list, const Cl
 //
 
 	add_cl_ident(cl_id,static_cast<client_addr *>(ip));
-	update_client_host(static_cast<client_addr *>(ip));
+	update_client_host(static_cast<client_addr *>(ip),slot);
 
-	sync.unlock();
+	elt_sync[slot].unlock();
 }
 
-void BlackBox::insert_attr_nl(const Tango::AttributeValueList &att_list, long vers)
+void BlackBox::insert_attr_nl(const Tango::AttributeValueList &att_list, long vers,long slot)
 {
 //
 // Insert elt in the box
 //
 
-	box[insert_elt].req_type = Req_Operation;
-	box[insert_elt].attr_type = Attr_Unknown;
+	box[slot].req_type = Req_Operation;
+	box[slot].attr_type = Attr_Unknown;
 	if (vers == 1)
-		box[insert_elt].op_type = Op_Write_Attr;
+		box[slot].op_type = Op_Write_Attr;
 	else if (vers < 4)
-		box[insert_elt].op_type = Op_Write_Attr_3;
+		box[slot].op_type = Op_Write_Attr_3;
 	else
-		box[insert_elt].op_type = Op_Write_Attr_4;
+		box[slot].op_type = Op_Write_Attr_4;
 
-	box[insert_elt].attr_names.clear();
+	box[slot].attr_names.resize(att_list.length());
 	for (unsigned long i = 0;i < att_list.length();i++)
-	{
-		string tmp_str(att_list[i].name);
-		box[insert_elt].attr_names.push_back(tmp_str);
-	}
-	box[insert_elt].client_ident = false;
-
-#ifdef _TG_WINDOWS_
-//
-// Note that the exact conversion between milli-sec and u-sec will be done
-// only when data is send back to user. This save some times in unnecessary
-// computation
-//
-	struct _timeb t;
-	_ftime(&t);
+		box[slot].attr_names[i] = att_list[i].name.in();
+	box[slot].client_ident = false;
 
-	box[insert_elt].when.tv_usec = (long)t.millitm;
-	box[insert_elt].when.tv_sec = (unsigned long)t.time;
-#else
-	struct timezone tz;
-	gettimeofday(&box[insert_elt].when,&tz);
-#endif
+	set_date(box[slot].when);
 
 //
 // get client address
 //
 
-	get_client_host();
-
-//
-// manage insert and read indexes
-//
-
-	inc_indexes();
+	get_client_host(slot);
 }
 
-void BlackBox::insert_attr_nl_4(const Tango::AttributeValueList_4 &att_list)
+void BlackBox::insert_attr_nl_4(const Tango::AttributeValueList_4 &att_list,long slot)
 {
 //
 // Insert elt in the box
 //
 
-	box[insert_elt].req_type = Req_Operation;
-	box[insert_elt].attr_type = Attr_Unknown;
-	box[insert_elt].op_type = Op_Write_Attr_4;
+	box[slot].req_type = Req_Operation;
+	box[slot].attr_type = Attr_Unknown;
+	box[slot].op_type = Op_Write_Attr_4;
 
-	box[insert_elt].attr_names.clear();
+	box[slot].attr_names.resize(att_list.length());
 	for (unsigned long i = 0;i < att_list.length();i++)
-	{
-		string tmp_str(att_list[i].name);
-		box[insert_elt].attr_names.push_back(tmp_str);
-	}
+		box[slot].attr_names[i] = att_list[i].name.in();
 
-#ifdef _TG_WINDOWS_
-//
-// Note that the exact conversion between milli-sec and u-sec will be done
-// only when data is send back to user. This save some times in unnecessary
-// computation
-//
-	struct _timeb t;
-	_ftime(&t);
-
-	box[insert_elt].when.tv_usec = (long)t.millitm;
-	box[insert_elt].when.tv_sec = (unsigned long)t.time;
-#else
-	struct timezone tz;
-	gettimeofday(&box[insert_elt].when,&tz);
-#endif
+	set_date(box[slot].when);
 
 //
 // get client address
 //
 
-	get_client_host();
-
-//
-// manage insert and read indexes
-//
-
-	inc_indexes();
+	get_client_host(slot);
 }
 
 //+-------------------------------------------------------------------------
@@ -802,14 +651,14 @@ void BlackBox::insert_attr_nl_4(const Tango::AttributeValueList_4 &att_list)
 
 void BlackBox::insert_wr_attr(const Tango::AttributeValueList_4 &att_list, const ClntIdent &cl_id,long vers)
 {
-	sync.lock();
+	long slot = reserve_slot();
 
-	insert_attr_wr_nl(att_list,vers);
+	insert_attr_wr_nl(att_list,vers,slot);
 
 	omni_thread::value_t *ip = omni_thread::self()->get_value(key);
 	if (ip == NULL)
 	{
-		sync.unlock();
+		elt_sync[slot].unlock();
 		return;
 	}
 
@@ -819,56 +668,33 @@ void BlackBox::insert_wr_attr(const Tango::AttributeValueList_4 &att_list, const
 //
 
 	add_cl_ident(cl_id,static_cast<client_addr *>(ip));
-	update_client_host(static_cast<client_addr *>(ip));
+	update_client_host(static_cast<client_addr *>(ip),slot);
 
-	sync.unlock();
+	elt_sync[slot].unlock();
 }
 
-void BlackBox::insert_attr_wr_nl(const Tango::AttributeValueList_4 &att_list, long vers)
+void BlackBox::insert_attr_wr_nl(const Tango::AttributeValueList_4 &att_list, long vers,long slot)
 {
 //
 // Insert elt in the box
 //
 
-	box[insert_elt].req_type = Req_Operation;
-	box[insert_elt].attr_type = Attr_Unknown;
+	box[slot].req_type = Req_Operation;
+	box[slot].attr_type = Attr_Unknown;
 	if (vers >= 4)
-		box[insert_elt].op_type = Op_Write_Read_Attributes_4;
+		box[slot].op_type = Op_Write_Read_Attributes_4;
 
-	box[insert_elt].attr_names.clear();
+	box[slot].attr_names.resize(att_list.length());
 	for (unsigned long i = 0;i < att_list.length();i++)
-	{
-		string tmp_str(att_list[i].name);
-		box[insert_elt].attr_names.push_back(tmp_str);
-	}
+		box[slot].attr_names[i] = att_list[i].name.in();
 
-#ifdef _TG_WINDOWS_
-//
-// Note that the exact conversion between milli-sec and u-sec will be done
-// only when data is send back to user. This save some times in unnecessary
-// computation
-//
-	struct _timeb t;
-	_ftime(&t);
-
-	box[insert_elt].when.tv_usec = (long)t.millitm;
-	box[insert_elt].when.tv_sec = (unsigned long)t.time;
-#else
-	struct timezone tz;
-	gettimeofday(&box[insert_elt].when,&tz);
-#endif
+	set_date(box[slot].when);
 
 //
 // get client address
 //
 
-	get_client_host();
-
-//
-// manage insert and read indexes
-//
-
-	inc_indexes();
+	get_client_host(slot);
 }
 
 //+-------------------------------------------------------------------------
@@ -892,6 +718,77 @@ void BlackBox::inc_indexes()
 		nb_elt++;
 }
 
+//+-------------------------------------------------------------------------
+//
+// method : 		BlackBox::reserve_slot
+//
+// description : 	Reserve the next element in the box for an insertion.
+//			The box mutex is held only for the indexes update. The
+//			element is then filled under its own mutex which is
+//			returned locked to the caller (who must unlock it).
+//			Threads inserting at the same time therefore only
+//			serialize on the indexes update
+//
+// This method returns the reserved element index
+//
+//--------------------------------------------------------------------------
+
+long BlackBox::reserve_slot()
+{
+	sync.lock();
+
+	long slot = insert_elt;
+	inc_indexes();
+
+//
+// Take the element mutex before releasing the box one so that a reader
+// cannot see the element before it is filled
+//
+
+	elt_sync[slot].lock();
+	sync.unlock();
+
+	return slot;
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		BlackBox::set_date
+//
+// description : 	Store the request date. A coarse clock is used when
+//			available: The black box date is displayed with a 1/100 s
+//			resolution and reading the coarse clock does not need
+//			any hardware counter access
+//
+// argument : out : - when : The date
+//
+//--------------------------------------------------------------------------
+
+void BlackBox::set_date(struct timeval &when)
+{
+#ifdef _TG_WINDOWS_
+//
+// Note that the exact conversion between milli-sec and u-sec will be done
+// only when data is send back to user. This save some times in unnecessary
+// computation
+//
+	struct _timeb t;
+	_ftime(&t);
+
+	when.tv_usec = (long)t.millitm;
+	when.tv_sec = (unsigned long)t.time;
+#elif defined CLOCK_REALTIME_COARSE
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME_COARSE,&ts);
+
+	when.tv_sec = ts.tv_sec;
+	when.tv_usec = ts.tv_nsec / 1000;
+#else
+	struct timezone tz;
+	gettimeofday(&when,&tz);
+#endif
+}
+
 //+-------------------------------------------------------------------------
 //
 // method : 		get_client_host
@@ -902,7 +799,7 @@ void BlackBox::inc_indexes()
 //
 //--------------------------------------------------------------------------
 
-void BlackBox::get_client_host()
+void BlackBox::get_client_host(long slot)
 {
 	omni_thread *th_id = omni_thread::self();
 	if (th_id == NULL)
@@ -913,12 +810,12 @@ void BlackBox::get_client_host()
     {
         Tango::Util *tg = Tango::Util::instance();
         if (tg->is_svr_starting() == true)
-            strcpy(box[insert_elt].host_ip_str,"init");
+            strcpy(box[slot].host_ip_str,"init");
         else
-            strcpy(box[insert_elt].host_ip_str,"polling");
+            strcpy(box[slot].host_ip_str,"polling");
     }
 	else
-		strcpy(box[insert_elt].host_ip_str,(static_cast<client_addr *>(ip))->client_ip);
+		strcpy(box[slot].host_ip_str,(static_cast<client_addr *>(ip))->client_ip);
 }
 
 //+-------------------------------------------------------------------------
@@ -928,18 +825,19 @@ void BlackBox::get_client_host()
 // description : 	Translate all the info stored in a black box element
 //			into a readable string.
 //
-// argument : in : 	- index : The black box element index
+// argument : in : 	- elt : The black box element (a copy of)
+//		 out :	- elt_str : The element as a string
 //
 //--------------------------------------------------------------------------
 
-void BlackBox::build_info_as_str(long index)
+void BlackBox::build_info_as_str(BlackBoxElt &elt,string &elt_str)
 {
 	char date_str[25];
 //
 // Convert time to a string
 //
 
-	date_ux_to_str(box[index].when,date_str);
+	date_ux_to_str(elt.when,date_str);
 	elt_str = date_str;
 
 //
@@ -948,17 +846,17 @@ void BlackBox::build_info_as_str(long index)
 
 	elt_str = elt_str + " : ";
 
-	if (box[index].req_type == Req_Operation)
+	if (elt.req_type == Req_Operation)
 	{
 		elt_str = elt_str + "Operation ";
 		unsigned long i;
 		unsigned long nb_in_vect;
 
-		switch (box[index].op_type)
+		switch (elt.op_type)
 		{
 		case Op_Command_inout :
-			elt_str = elt_str + "command_inout (cmd = " + box[index].cmd_name + ") from ";
-			add_source(index);
+			elt_str = elt_str + "command_inout (cmd = " + elt.cmd_name + ") from ";
+			add_source(elt,elt_str);
 			break;
 
 		case Op_Ping :
@@ -991,23 +889,23 @@ void BlackBox::build_info_as_str(long index)
 
 		case Op_Read_Attr :
 			elt_str = elt_str + "read_attributes (";
-			nb_in_vect = box[index].attr_names.size();
+			nb_in_vect = elt.attr_names.size();
 			for (i = 0;i < nb_in_vect;i++)
 			{
-				elt_str = elt_str + box[index].attr_names[i];
+				elt_str = elt_str + elt.attr_names[i];
 				if (i != nb_in_vect - 1)
 					elt_str = elt_str + ", ";
 			}
 			elt_str = elt_str + ") from ";
-			add_source(index);
+			add_source(elt,elt_str);
 			break;
 
 		case Op_Write_Attr :
 			elt_str = elt_str + "write_attributes (";
-			nb_in_vect = box[index].attr_names.size();
+			nb_in_vect = elt.attr_names.size();
 			for (i = 0;i < nb_in_vect;i++)
 			{
-				elt_str = elt_str + box[index].attr_names[i];
+				elt_str = elt_str + elt.attr_names[i];
 				if (i != nb_in_vect - 1)
 					elt_str = elt_str + ", ";
 			}
@@ -1016,10 +914,10 @@ void BlackBox::build_info_as_str(long index)
 
 		case Op_Write_Attr_3 :
 			elt_str = elt_str + "write_attributes_3 (";
-			nb_in_vect = box[index].attr_names.size();
+			nb_in_vect = elt.attr_names.size();
 			for (i = 0;i < nb_in_vect;i++)
 			{
-				elt_str = elt_str + box[index].attr_names[i];
+				elt_str = elt_str + elt.attr_names[i];
 				if (i != nb_in_vect - 1)
 					elt_str = elt_str + ", ";
 			}
@@ -1027,8 +925,8 @@ void BlackBox::build_info_as_str(long index)
 			break;
 
 		case Op_Command_inout_2 :
-			elt_str = elt_str + "command_inout_2 (cmd = " + box[index].cmd_name + ") from ";
-			add_source(index);
+			elt_str = elt_str + "command_inout_2 (cmd = " + elt.cmd_name + ") from ";
+			add_source(elt,elt_str);
 			break;
 
 		case Op_Command_list_2 :
@@ -1045,28 +943,28 @@ void BlackBox::build_info_as_str(long index)
 
 		case Op_Read_Attr_2 :
 			elt_str = elt_str + "read_attributes_2 (";
-			nb_in_vect = box[index].attr_names.size();
+			nb_in_vect = elt.attr_names.size();
 			for (i = 0;i < nb_in_vect;i++)
 			{
-				elt_str = elt_str + box[index].attr_names[i];
+				elt_str = elt_str + elt.attr_names[i];
 				if (i != nb_in_vect - 1)
 					elt_str = elt_str + ", ";
 			}
 			elt_str = elt_str + ") from ";
-			add_source(index);
+			add_source(elt,elt_str);
 			break;
 
 		case Op_Read_Attr_3 :
 			elt_str = elt_str + "read_attributes_3 (";
-			nb_in_vect = box[index].attr_names.size();
+			nb_in_vect = elt.attr_names.size();
 			for (i = 0;i < nb_in_vect;i++)
 			{
-				elt_str = elt_str + box[index].attr_names[i];
+				elt_str = elt_str + elt.attr_names[i];
 				if (i != nb_in_vect - 1)
 					elt_str = elt_str + ", ";
 			}
 			elt_str = elt_str + ") from ";
-			add_source(index);
+			add_source(elt,elt_str);
 			break;
 
 		case Op_Command_inout_history_2 :
@@ -1102,29 +1000,29 @@ void BlackBox::build_info_as_str(long index)
 			break;
 
 		case Op_Command_inout_4 :
-			elt_str = elt_str + "command_inout_4 (cmd = " + box[index].cmd_name + ") from ";
-			add_source(index);
+			elt_str = elt_str + "command_inout_4 (cmd = " + elt.cmd_name + ") from ";
+			add_source(elt,elt_str);
 			break;
 
 		case Op_Read_Attr_4 :
 			elt_str = elt_str + "read_attributes_4 (";
-			nb_in_vect = box[index].attr_names.size();
+			nb_in_vect = elt.attr_names.size();
 			for (i = 0;i < nb_in_vect;i++)
 			{
-				elt_str = elt_str + box[index].attr_names[i];
+				elt_str = elt_str + elt.attr_names[i];
 				if (i != nb_in_vect - 1)
 					elt_str = elt_str + ", ";
 			}
 			elt_str = elt_str + ") from ";
-			add_source(index);
+			add_source(elt,elt_str);
 			break;
 
 		case Op_Write_Attr_4 :
 			elt_str = elt_str + "write_attributes_4 (";
-			nb_in_vect = box[index].attr_names.size();
+			nb_in_vect = elt.attr_names.size();
 			for (i = 0;i < nb_in_vect;i++)
 			{
-				elt_str = elt_str + box[index].attr_names[i];
+				elt_str = elt_str + elt.attr_names[i];
 				if (i != nb_in_vect - 1)
 					elt_str = elt_str + ", ";
 			}
@@ -1137,10 +1035,10 @@ void BlackBox::build_info_as_str(long index)
 
 		case Op_Write_Read_Attributes_4 :
 			elt_str = elt_str + "write_read_attributes_4 (";
-			nb_in_vect = box[index].attr_names.size();
+			nb_in_vect = elt.attr_names.size();
 			for (i = 0;i < nb_in_vect;i++)
 			{
-				elt_str = elt_str + box[index].attr_names[i];
+				elt_str = elt_str + elt.attr_names[i];
 				if (i != nb_in_vect - 1)
 					elt_str = elt_str + ", ";
 			}
@@ -1152,10 +1050,10 @@ void BlackBox::build_info_as_str(long index)
 			return;
 		}
 	}
-	else if (box[index].req_type == Req_Attribute)
+	else if (elt.req_type == Req_Attribute)
 	{
 		elt_str = elt_str + "Attribute ";
-		switch (box[index].attr_type)
+		switch (elt.attr_type)
 		{
 		case Attr_Name :
 			elt_str = elt_str + "name ";
@@ -1195,12 +1093,12 @@ void BlackBox::build_info_as_str(long index)
 //
 
 	bool ipv6=false;
-	if ((box[index].host_ip_str[0] != '\0') &&
-	    (box[index].host_ip_str[0] != 'p') &&
-		(box[index].host_ip_str[5] != 'u') &&
-        (box[index].host_ip_str[0] != 'i'))
+	if ((elt.host_ip_str[0] != '\0') &&
+	    (elt.host_ip_str[0] != 'p') &&
+		(elt.host_ip_str[5] != 'u') &&
+        (elt.host_ip_str[0] != 'i'))
 	{
-		string omni_addr = box[index].host_ip_str;
+		string omni_addr = elt.host_ip_str;
 		string::size_type pos;
 		if ((pos = omni_addr.find(':')) == string::npos)
 			return;
@@ -1290,23 +1188,23 @@ void BlackBox::build_info_as_str(long index)
 // Add client identification if available
 //
 
-		if (box[index].client_ident == true)
+		if (elt.client_ident == true)
 		{
-			if (box[index].client_lang == Tango::CPP)
+			if (elt.client_lang == Tango::CPP)
 			{
 				elt_str = elt_str + " (CPP/Python client with PID ";
 				TangoSys_MemStream o;
-				o << box[index].client_pid;
+				o << elt.client_pid;
 				elt_str = elt_str + o.str() + ")";
 			}
 			else
 			{
 				elt_str = elt_str + " (Java client with main class ";
-				elt_str = elt_str + box[index].java_main_class + ")";
+				elt_str = elt_str + elt.java_main_class + ")";
 			}
 		}
 	}
-	else if (box[index].host_ip_str[5] == 'u')
+	else if (elt.host_ip_str[5] == 'u')
 	{
 		Tango::Util *tg = Tango::Util::instance();
 		elt_str = elt_str + "requested from " + tg->get_host_name();
@@ -1315,27 +1213,27 @@ void BlackBox::build_info_as_str(long index)
 // Add client identification if available
 //
 
-		if (box[index].client_ident == true)
+		if (elt.client_ident == true)
 		{
-			if (box[index].client_lang == Tango::CPP)
+			if (elt.client_lang == Tango::CPP)
 			{
 				elt_str = elt_str + " (CPP/Python client with PID ";
 				TangoSys_MemStream o;
-				o << box[index].client_pid;
+				o << elt.client_pid;
 				elt_str = elt_str + o.str() + ")";
 			}
 			else
 			{
 				elt_str = elt_str + " (Java client with main class ";
-				elt_str = elt_str + box[index].java_main_class + ")";
+				elt_str = elt_str + elt.java_main_class + ")";
 			}
 		}
 	}
-	else if (box[index].host_ip_str[0] == 'p')
+	else if (elt.host_ip_str[0] == 'p')
 	{
         elt_str = elt_str + "requested from polling";
 	}
-	else if (box[index].host_ip_str[0] == 'i')
+	else if (elt.host_ip_str[0] == 'i')
 	{
         elt_str = elt_str + "requested during device server process init sequence";
 	}
@@ -1347,16 +1245,16 @@ void BlackBox::build_info_as_str(long index)
 //
 // method : 		BlackBox::add_source
 //
-// description : 	Read black box element as strings. The newest element
-//			is return in the first position
+// description : 	Add the request source to the element string
 //
-// argument : in : 	- index : The number of element to read
+// argument : in : 	- elt : The black box element
+//		 out :	- elt_str : The element string
 //
 //--------------------------------------------------------------------------
 
-void BlackBox::add_source(long index)
+void BlackBox::add_source(BlackBoxElt &elt,string &elt_str)
 {
-	switch (box[index].source)
+	switch (elt.source)
 	{
 	case DEV :
 		elt_str = elt_str + "device ";
@@ -1430,46 +1328,54 @@ Tango::DevVarStringArray *BlackBox::read(long wanted_elt)
 		wanted_elt = nb_elt;
 
 //
-// Read black box elements
+// Get the newest element index and release the box mutex. Elements are copied
+// one at a time under their own mutex. Formatting them (which may need a
+// DNS request) is done without any lock held, so it does not delay the
+// request threads inserting in the box
 //
 
+	long read_index;
+	if (insert_elt == 0)
+		read_index = max_elt - 1;
+	else
+		read_index = insert_elt - 1;
+
+	sync.unlock();
+
 	Tango::DevVarStringArray *ret = NULL;
 	try
 	{
-
-		ret = new Tango::DevVarStringArray(wanted_elt);
-                ret->length(wanted_elt);
-
-		long read_index;
-		if (insert_elt == 0)
-			read_index = max_elt - 1;
-		else
-			read_index = insert_elt - 1;
+		vector<BlackBoxElt> elts(wanted_elt);
 		for (long i = 0;i < wanted_elt;i++)
 		{
-			build_info_as_str(read_index);
-			(*ret)[i] = elt_str.c_str();
+			elt_sync[read_index].lock();
+			elts[i] = box[read_index];
+			elt_sync[read_index].unlock();
 
 			read_index--;
 			if (read_index < 0)
 				read_index = max_elt - 1;
 		}
+
+		ret = new Tango::DevVarStringArray(wanted_elt);
+		ret->length(wanted_elt);
+
+		string elt_str;
+		for (long i = 0;i < wanted_elt;i++)
+		{
+			build_info_as_str(elts[i],elt_str);
+			(*ret)[i] = elt_str.c_str();
+		}
 	}
 	catch (bad_alloc)
 	{
-		sync.unlock();
+		delete ret;
 
 		Except::throw_exception((const char *)"API_MemoryAllocation",
 				      (const char *)"Can't allocate memory in server",
 				      (const char *)"BlackBox::read");
 	}
 
-//
-// Release mutex
-//
-
-	sync.unlock();
-
 	return(ret);
 }
 
@@ -183,6 +183,7 @@ class BlackBox
 public:
 	BlackBox();
 	BlackBox(long);
+	~BlackBox();
 
 	void insert_corba_attr(BlackBoxElt_AttrType);
 	void insert_cmd(const char *,long vers=1,DevSource=Tango::DEV);
@@ -194,33 +195,34 @@ public:
 	void insert_op(BlackBoxElt_OpType);
 	void insert_op(BlackBoxElt_OpType,const ClntIdent &);
 
-	void insert_cmd_nl(const char *,long,DevSource);
+	void insert_cmd_nl(const char *,long,DevSource,long);
 	void insert_cmd_cl_ident(const char *,const ClntIdent &,long vers=1,DevSource=Tango::DEV);
 	void add_cl_ident(const ClntIdent &,client_addr *);
-	void update_client_host(client_addr *);
+	void update_client_host(client_addr *,long);
 
 	Tango::DevVarStringArray *read(long);
 
 private:
 
 	void inc_indexes();
-	void get_client_host();
-	void build_info_as_str(long);
+	long reserve_slot();
+	void set_date(struct timeval &);
+	void get_client_host(long);
+	void build_info_as_str(BlackBoxElt &,string &);
 	void date_ux_to_str(struct timeval &,char *);
-	void add_source(long);
-	void insert_op_nl(BlackBoxElt_OpType);
-	void insert_attr_nl(const Tango::AttributeValueList &,long);
-	void insert_attr_nl_4(const Tango::AttributeValueList_4 &);
-	void insert_attr_wr_nl(const Tango::AttributeValueList_4 &,long);
+	void add_source(BlackBoxElt &,string &);
+	void insert_op_nl(BlackBoxElt_OpType,long);
+	void insert_attr_nl(const Tango::AttributeValueList &,long,long);
+	void insert_attr_nl_4(const Tango::AttributeValueList_4 &,long);
+	void insert_attr_wr_nl(const Tango::AttributeValueList_4 &,long,long);
 
 	vector<BlackBoxElt>	box;
 	long				insert_elt;
 	long				nb_elt;
 	long				max_elt;
 
-	omni_mutex			sync;
-
-	string				elt_str;
+	omni_mutex			sync;				// Protect the indexes
+	omni_mutex			*elt_sync;			// One mutex per box element
 };
 
 } // End of Tango namespace
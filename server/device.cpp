@@ -123,6 +123,8 @@ DeviceImpl::DeviceImpl(DeviceClass *cl_ptr,string &d_name,string &description)
 
 void DeviceImpl::real_ctor()
 {
+	ext->ctor_date = get_date_ms();
+
     version = DevVersion;
 	blackbox_depth = 0;
 
@@ -266,10 +268,12 @@ void DeviceImpl::stop_polling(bool with_db_upd)
 		mon.signal();
 
 //
-// Wait for thread to execute command
+// Wait for thread to execute command. Except if we are a polling thread
+// executing a work stolen from this thread: it waits for our work to be
+// finished before executing the command
 //
 
-		while (shared_cmd.cmd_pending == true)
+		while ((shared_cmd.cmd_pending == true) && (PollThread::is_stealing_from(th_info->poll_th) == false))
 		{
 			int interupted = mon.wait(DEFAULT_TIMEOUT);
 
@@ -503,6 +507,7 @@ void DeviceImpl::get_dev_system_resource()
 		db_data.push_back(DbDatum("min_poll_period"));
 		db_data.push_back(DbDatum("cmd_min_poll_period"));
 		db_data.push_back(DbDatum("attr_min_poll_period"));
+		db_data.push_back(DbDatum("alarm_state_cache_age"));
 
 		try
 		{
@@ -630,6 +635,9 @@ void DeviceImpl::get_dev_system_resource()
 					  ::tolower);
 		}
 
+		if (db_data[13].is_empty() == false)
+			db_data[13] >> ext->alarm_cache_max_age;
+
 //
 // Since Tango V5 (IDL V3), State and Status are now polled as attributes
 // Change properties if necessary
@@ -1092,6 +1100,41 @@ Tango::DevState DeviceImpl::dev_state()
                 nb_wanted_attr = attr_list.size();
             }
 
+//
+// If configured, do not read alarmed attribute(s) for which the alarm has been
+// checked recently (by a client read, by the polling thread or when an event
+// has been pushed). Their last alarm check result is used instead
+//
+
+            vector<long> attr_cached_list;
+            bool cached_alrm = false;
+
+            if ((vers >= 3) && (ext->alarm_cache_max_age > 0) && (nb_wanted_attr != 0))
+            {
+                double now_ms = get_date_ms();
+
+                vector<long> &wanted_list = (ext->state_from_read == true) ? attr_list_2 : attr_list;
+                vector<long> to_read_list;
+                to_read_list.reserve(wanted_list.size());
+
+                for (unsigned long i = 0;i < wanted_list.size();i++)
+                {
+                    Attribute &att = dev_attr->get_attr_by_ind(wanted_list[i]);
+                    if ((now_ms - att.get_alarm_cache_date()) <= (double)ext->alarm_cache_max_age)
+                    {
+                        attr_cached_list.push_back(wanted_list[i]);
+                        Tango::AttrQuality qua = att.get_alarm_cache_quality();
+                        if ((qua == Tango::ATTR_ALARM) || (qua == Tango::ATTR_WARNING))
+                            cached_alrm = true;
+                    }
+                    else
+                        to_read_list.push_back(wanted_list[i]);
+                }
+
+                wanted_list.swap(to_read_list);
+                nb_wanted_attr = wanted_list.size();
+            }
+
             cout4 << "State: Number of attribute(s) to read: " << nb_wanted_attr << endl;
 
             if (nb_wanted_attr != 0)
@@ -1191,7 +1234,7 @@ Tango::DevState DeviceImpl::dev_state()
 // Check alarm level
 //
 
-                if (dev_attr->check_alarm() == true)
+                if (dev_attr->check_alarm_not_cached(attr_cached_list) == true)
                 {
                     set_alrm = true;
                     device_state = Tango::ALARM;
@@ -1220,6 +1263,21 @@ Tango::DevState DeviceImpl::dev_state()
                 }
             }
 
+//
+// Check the alarmed attributes which have not been read
+//
+
+            if (attr_cached_list.empty() == false)
+            {
+                if (cached_alrm == true)
+                {
+                    set_alrm = true;
+                    device_state = Tango::ALARM;
+                }
+                else if (nb_wanted_attr == 0)
+                    device_state = Tango::ON;
+            }
+
 //
 // Check if one of the remaining attributes has its quality factor
 // set to ALARM or WARNING. It is not necessary to do this if we have already detected
@@ -3454,6 +3454,13 @@ public:
 	void init_attr_poll_ext_trig (string cmd_name);
 
     void set_run_att_conf_loop(bool val) {ext->run_att_conf_loop=val;}
+
+	long get_alarm_cache_max_age() {return ext->alarm_cache_max_age;}
+	void set_alarm_cache_max_age(long val) {ext->alarm_cache_max_age = val;}
+
+	double get_ctor_date() {return ext->ctor_date;}
+	double get_ctor_time() {return ext->ctor_time;}
+	void set_ctor_time(double val) {ext->ctor_time = val;}
     vector<string> &get_att_wrong_db_conf() {return ext->att_wrong_db_conf;}
 
 #ifdef TANGO_HAS_LOG4TANGO
@@ -3484,14 +3491,16 @@ private:
         att_conf_mon("att_config"),state_from_read(false),
         py_device(false),
         device_locked(false),locker_client(NULL),old_locker_client(NULL),
-        lock_ctr(0),min_poll_period(0),run_att_conf_loop(true),force_alarm_state(false) {};
+        lock_ctr(0),min_poll_period(0),run_att_conf_loop(true),force_alarm_state(false),alarm_cache_max_age(0),
+        ctor_date(0.0),ctor_time(-1.0) {};
 #else
         DeviceImplExt(const char *d_name):exported(false),polled(false),poll_ring_depth(0)
                 only_one(d_name),store_in_bb(true),poll_mon("cache"),
                 att_conf_mon("att_config"),state_from_read(false),
                 py_device(false),device_locked(false),locker_client(NULL),
                 old_locker_client(NULL),lock_ctr(0),min_poll_period(0),
-                run_att_conf_loop(true),force_alarm_state(false) {};
+                run_att_conf_loop(true),force_alarm_state(false),alarm_cache_max_age(0),
+                ctor_date(0.0),ctor_time(-1.0) {};
 #endif
         ~DeviceImplExt();
 
@@ -3543,6 +3552,9 @@ private:
         bool                run_att_conf_loop;
         bool                force_alarm_state;
         vector<string>      att_wrong_db_conf;
+        long                alarm_cache_max_age;    // Max age (mS) of alarm check result used by State (0 = not used)
+        double              ctor_date;              // Device construction start date (mS)
+        double              ctor_time;              // Device construction time (mS). -1 if unknown
     };
 
 
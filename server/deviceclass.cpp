@@ -748,6 +748,13 @@ void DeviceClass::delete_dev(long idx,Tango::Util *tg,PortableServer::POA_ptr r_
 {
 	cout4 << "Entering DeviceClas::delete_dev method for device with index " << idx << endl;
 
+//
+// Remove the device from the map used to find device from name before it is
+// deleted
+//
+
+	tg->unregister_device_name(device_list[idx]);
+
 //
 // If the polling thread is alive and if device is polled,
 // ask polling thread to stop polling
@@ -902,6 +909,9 @@ void DeviceClass::export_device(DeviceImpl *dev,const char *corba_obj_name)
 {
 	cout4 << "DeviceClass::export_device() arrived" << endl;
 
+	if ((get_device_factory_done() == false) && (ext->first_export_date == 0.0))
+		ext->first_export_date = get_date_ms();
+
 	Device_var d;
 
 	if ((Tango::Util::_UseDb == true) && (Tango::Util::_FileDb == false))
@@ -1056,40 +1066,56 @@ CORBA::Any *DeviceClass::command_handler(DeviceImpl *device,string &command,cons
 
 	transform(command_lower.begin(),command_lower.end(),command_lower.begin(),::tolower);
 
-	for (i_cmd = command_list.begin();i_cmd < command_list.end();++i_cmd)
+//
+// Search the command in the command map. If it is not there (command added
+// after the map was built), search it in the command list
+//
+
+	Command *cmd_ptr = NULL;
+	map<string,Command *>::iterator ite = ext->cmd_map.find(command_lower);
+	if (ite != ext->cmd_map.end())
+		cmd_ptr = ite->second;
+	else
 	{
-		if ((*i_cmd)->get_lower_name() == command_lower)
+		for (i_cmd = command_list.begin();i_cmd < command_list.end();++i_cmd)
 		{
+			if ((*i_cmd)->get_lower_name() == command_lower)
+			{
+				cmd_ptr = *i_cmd;
+				break;
+			}
+		}
+	}
+
+	if (cmd_ptr != NULL)
+	{
 
 //
 // Call the always executed method
 //
 
-			device->always_executed_hook();
+		device->always_executed_hook();
 
 //
 // Check if command is allowed
 //
 
-			if ((*i_cmd)->is_allowed(device,in_any) == false)
-			{
-				TangoSys_OMemStream o;
-				o << "Command " << command << " not allowed when the device is in " << Tango::DevStateName[device->get_state()] << " state"  << ends;
-				Except::throw_exception((const char *)"API_CommandNotAllowed",
-						      o.str(),
-						      (const char *)"DeviceClass::command_handler");
-			}
+		if (cmd_ptr->is_allowed(device,in_any) == false)
+		{
+			TangoSys_OMemStream o;
+			o << "Command " << command << " not allowed when the device is in " << Tango::DevStateName[device->get_state()] << " state"  << ends;
+			Except::throw_exception((const char *)"API_CommandNotAllowed",
+					      o.str(),
+					      (const char *)"DeviceClass::command_handler");
+		}
 
 //
 // Execute command
 //
 
-			ret = (*i_cmd)->execute(device,in_any);
-			break;
-		}
+		ret = cmd_ptr->execute(device,in_any);
 	}
-
-	if (i_cmd == command_list.end())
+	else
 	{
 
 		cout3 << "DeviceClass::command_handler(): command " << command << " not found" << endl;
@@ -1152,6 +1178,22 @@ CORBA::Any *DeviceClass::command_handler(DeviceImpl *device,string &command,cons
 	return ret;
 }
 
+//+----------------------------------------------------------------------------
+//
+// method :		DeviceClass::build_command_map()
+//
+// description :	Build the map used by the command_handler() method to
+//			find a command from its lower case name
+//
+//-----------------------------------------------------------------------------
+
+void DeviceClass::build_command_map()
+{
+	ext->cmd_map.clear();
+	for (unsigned int i = 0;i < command_list.size();i++)
+		ext->cmd_map[command_list[i]->get_lower_name()] = command_list[i];
+}
+
 
 //+----------------------------------------------------------------------------
 //
@@ -430,6 +430,10 @@ public:
 
 	bool get_device_factory_done() {return ext->device_factory_done;}
 	void set_device_factory_done(bool val) {ext->device_factory_done = val;}
+	double get_first_export_date() {return ext->first_export_date;}
+	void reset_first_export_date() {ext->first_export_date = 0.0;}
+
+	void build_command_map();
 
 protected:
 	Command *get_default_command() {return ext->default_cmd;}
@@ -438,7 +442,7 @@ private:
     class DeviceClassExt
     {
     public:
-        DeviceClassExt():only_one("class"),default_cmd(NULL),py_class(false),device_factory_done(false) {};
+        DeviceClassExt():only_one("class"),default_cmd(NULL),py_class(false),device_factory_done(false),first_export_date(0.0) {};
 
         vector<string>		nodb_name_list;
         TangoMonitor		only_one;
@@ -449,6 +453,8 @@ private:
         string              svn_tag;
         string              svn_location;
         bool                device_factory_done;
+        map<string,Command *> cmd_map;              // Lower case command name -> command
+        double              first_export_date;      // Date of the first device export in the device factory (mS)
     };
 
 	void get_class_system_resource();
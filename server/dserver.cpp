@@ -189,6 +189,16 @@ void DServer::init_device()
 
 			get_event_misc_prop(tg);
 
+//
+// Should the device factories be executed in parallel ?
+// Not for Python device server (single interpreter lock)
+//
+
+			unsigned long startup_th_nb = tg->get_device_startup_threads();
+			bool par_factory = (tg->_UseDb == true) && (tg->is_py_ds() == false) &&
+							   (startup_th_nb > 1) && (class_list.size() > 1);
+			vector<DevFactoryJob> factory_jobs;
+
 //
 // A loop for each class
 //
@@ -207,6 +217,7 @@ void DServer::init_device()
 //
 
 				sort(class_list[i]->get_command_list().begin(),class_list[i]->get_command_list().end(),less_than);
+				class_list[i]->build_command_map();
 
 //
 // Build class attributes
@@ -251,15 +262,22 @@ void DServer::init_device()
 					cout4 << dev_list.length() << " device(s) defined" << endl;
 
 //
-// Create all device(s)
+// Create all device(s). In parallel startup mode, only memorize what has to
+// be done. The factories are executed once all the classes are initialised
 //
 
-                    class_list[i]->set_device_factory_done(false);
+					if (par_factory == true)
 					{
-						AutoTangoMonitor sync(class_list[i]);
-						class_list[i]->device_factory(&dev_list);
+						DevFactoryJob job;
+						job.dev_class = class_list[i];
+						job.dev_list = dev_list;
+						job.mem_failed = false;
+						job.named_failed = false;
+						factory_jobs.push_back(job);
+						continue;
 					}
-                    class_list[i]->set_device_factory_done(true);
+
+					run_device_factory(class_list[i],&dev_list);
 
 //
 // Set value for each device with memorized writable attr
@@ -324,14 +342,40 @@ void DServer::init_device()
 // Create all device(s)
 //
 
-                    class_list[i]->set_device_factory_done(false);
+					run_device_factory(class_list[i],dev_list_nodb);
+
+					delete dev_list_nodb;
+				}
+			}
+
+//
+// Parallel startup: Execute the device factories then, class after class,
+// check the result, apply memorized values and get mcast event parameters
+// as it is done in sequential mode
+//
+
+			if (factory_jobs.empty() == false)
+			{
+				parallel_device_factory(factory_jobs,startup_th_nb);
+
+				for (unsigned long j = 0;j < factory_jobs.size();j++)
+				{
+					i = find(class_list.begin(),class_list.end(),factory_jobs[j].dev_class) - class_list.begin();
+
+					if (factory_jobs[j].mem_failed == true)
+						throw bad_alloc();
+					if (factory_jobs[j].named_failed == true)
 					{
-						AutoTangoMonitor sync(class_list[i]);
-						class_list[i]->device_factory(dev_list_nodb);
+						Tango::NamedDevFailedList e;
+						e.errors = factory_jobs[j].errors;
+						e.err_list = factory_jobs[j].err_list;
+						throw e;
 					}
-                    class_list[i]->set_device_factory_done(true);
+					if (factory_jobs[j].errors.length() != 0)
+						throw Tango::DevFailed(factory_jobs[j].errors);
 
-					delete dev_list_nodb;
+					class_list[i]->set_memorized_values(true);
+					class_list[i]->get_mcast_event(this);
 				}
 			}
 		}
@@ -793,9 +837,11 @@ void DServer::restart(string &d_name)
 	tg->get_sub_dev_diag().set_associated_device(dev_to_del->get_name());
 
 //
-// Remove ourself from device list
+// Remove ourself from device list and from the map used to find device
+// from name
 //
 
+	tg->unregister_device_name(dev_to_del);
 	class_list[i]->get_device_list().erase(ite);
 
 //
@@ -884,6 +930,10 @@ void DServer::restart(string &d_name)
             dev_cl->device_factory(&name);
         }
         dev_cl->set_device_factory_done(true);
+
+        vector<DeviceImpl *> &new_devs = dev_cl->get_device_list();
+        if (new_devs.empty() == false)
+            tg->register_device_name(new_devs.back()->get_name_lower(),new_devs.back());
         tg->delete_restarting_device(d_name);
     }
     catch (...)
@@ -1291,6 +1341,86 @@ void *KillThread::run_undetached(TANGO_UNUSED(void *ptr))
 	return NULL;
 }
 
+//+----------------------------------------------------------------------------
+//
+// method : 		DevFactoryThread::run_undetached
+//
+// description : 	Execute device factory jobs until there is no more
+//					job to be done. Any error is stored in the job to be
+//					re-thrown by the thread which started the pool
+//
+//-----------------------------------------------------------------------------
+
+void *DevFactoryThread::run_undetached(void *ptr)
+{
+	omni_thread::self()->set_value(key_py_data,new PyData());
+
+	DServer *dev = (DServer *)ptr;
+
+	while (true)
+	{
+		unsigned long job_ind;
+		{
+			omni_mutex_lock oml(job_mutex);
+			if (next_job >= job_list.size())
+				break;
+			job_ind = next_job++;
+		}
+
+		DevFactoryJob &job = job_list[job_ind];
+		try
+		{
+			dev->run_device_factory(job.dev_class,&job.dev_list);
+		}
+		catch (bad_alloc &)
+		{
+			job.mem_failed = true;
+		}
+		catch (Tango::NamedDevFailedList &e)
+		{
+			job.named_failed = true;
+			job.errors = e.errors;
+			job.err_list = e.err_list;
+		}
+		catch (Tango::DevFailed &e)
+		{
+			job.errors = e.errors;
+		}
+		catch (CORBA::SystemException &e)
+		{
+			job.errors.length(1);
+			job.errors[0].severity = Tango::ERR;
+			job.errors[0].origin = CORBA::string_dup("DevFactoryThread::run_undetached");
+			job.errors[0].reason = CORBA::string_dup("API_CorbaSysException");
+			job.errors[0].desc = Except::print_CORBA_SystemException(&e);
+		}
+		catch (CORBA::Exception &)
+		{
+			TangoSys_OMemStream o;
+			o << "CORBA exception while creating devices for class " << job.dev_class->get_name() << ends;
+
+			job.errors.length(1);
+			job.errors[0].severity = Tango::ERR;
+			job.errors[0].origin = CORBA::string_dup("DevFactoryThread::run_undetached");
+			job.errors[0].reason = CORBA::string_dup("API_CorbaException");
+			job.errors[0].desc = CORBA::string_dup(o.str().c_str());
+		}
+		catch (...)
+		{
+			TangoSys_OMemStream o;
+			o << "Unknown exception while creating devices for class " << job.dev_class->get_name() << ends;
+
+			job.errors.length(1);
+			job.errors[0].severity = Tango::ERR;
+			job.errors[0].origin = CORBA::string_dup("DevFactoryThread::run_undetached");
+			job.errors[0].reason = CORBA::string_dup("API_UnknownException");
+			job.errors[0].desc = CORBA::string_dup(o.str().c_str());
+		}
+	}
+
+	return NULL;
+}
+
 
 //+----------------------------------------------------------------------------
 //
@@ -1413,6 +1543,8 @@ void DServer::get_dev_prop(Tango::Util *tg)
 
 		db_data.push_back(DbDatum("polling_threads_pool_size"));
 		db_data.push_back(DbDatum("polling_threads_pool_conf"));
+		db_data.push_back(DbDatum("polling_threads_work_stealing"));
+		db_data.push_back(DbDatum("device_startup_threads"));
 
 		try
 		{
@@ -1478,6 +1610,123 @@ void DServer::get_dev_prop(Tango::Util *tg)
 		}
 		else
             polling_th_pool_conf.clear();
+
+//
+// The polling threads pool work stealing mode. As for the pool size, if the
+// prop is not defined in db, keep the user definition done in the Util class
+//
+
+		if (db_data[2].is_empty() == false)
+		{
+			bool steal;
+			db_data[2] >> steal;
+			tg->set_polling_threads_work_stealing(steal);
+		}
+
+//
+// The number of threads used to create devices at startup. Same rule
+//
+
+		if (db_data[3].is_empty() == false)
+		{
+			DevLong th_nb;
+			db_data[3] >> th_nb;
+			if (th_nb < 0)
+				th_nb = 0;
+			tg->set_device_startup_threads((unsigned long)th_nb);
+		}
+	}
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		DServer::run_device_factory()
+//
+// description : 	Create the devices of one class and compute how long
+//					each device construction took.
+//					A device construction time is the time between the
+//					start of its constructor and the start of the next
+//					device constructor (or the first device export for
+//					the last one)
+//
+// argin: cl : The device class
+//		  dev_list : The device name list
+//
+//-----------------------------------------------------------------------------
+
+void DServer::run_device_factory(DeviceClass *cl,DevVarStringArray *dev_list)
+{
+	vector<DeviceImpl *> &dev_vect = cl->get_device_list();
+	unsigned long first_dev = dev_vect.size();
+
+	cl->reset_first_export_date();
+	cl->set_device_factory_done(false);
+	{
+		AutoTangoMonitor sync(cl);
+		cl->device_factory(dev_list);
+	}
+	cl->set_device_factory_done(true);
+
+	double end_date = cl->get_first_export_date();
+	if (end_date == 0.0)
+		end_date = get_date_ms();
+
+//
+// Register the new devices in the map used to find device from name. This is
+// done once they are in the class device list
+//
+
+	Tango::Util *tg = Tango::Util::instance();
+
+	for (unsigned long loop = first_dev;loop < dev_vect.size();loop++)
+	{
+		tg->register_device_name(dev_vect[loop]->get_name_lower(),dev_vect[loop]);
+
+		double next_date = end_date;
+		if (loop + 1 < dev_vect.size())
+			next_date = dev_vect[loop + 1]->get_ctor_date();
+
+		dev_vect[loop]->set_ctor_time(next_date - dev_vect[loop]->get_ctor_date());
+
+		cout2 << "Device " << dev_vect[loop]->get_name() << " created in " << dev_vect[loop]->get_ctor_time() << " mS" << endl;
+	}
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		DServer::parallel_device_factory()
+//
+// description : 	Execute the device factory of several classes using a
+//					pool of threads. Errors are stored in the job list.
+//					This method returns when all the factories are done
+//
+// argin: jobs : The device factory job list (one per class)
+//		  th_nb : The pool maximum size
+//
+//-----------------------------------------------------------------------------
+
+void DServer::parallel_device_factory(vector<DevFactoryJob> &jobs,unsigned long th_nb)
+{
+	omni_mutex job_mutex;
+	unsigned long next_job = 0;
+
+	if (th_nb > jobs.size())
+		th_nb = jobs.size();
+
+	cout3 << "DServer: Creating devices of " << jobs.size() << " classes with " << th_nb << " threads" << endl;
+
+	vector<DevFactoryThread *> threads;
+	for (unsigned long loop = 0;loop < th_nb;loop++)
+	{
+		DevFactoryThread *th = new DevFactoryThread(this,jobs,job_mutex,next_job);
+		th->start();
+		threads.push_back(th);
+	}
+
+	for (unsigned long loop = 0;loop < threads.size();loop++)
+	{
+		void *dummy_ptr;
+		threads[loop]->join(&dummy_ptr);
 	}
 }
 
@@ -1539,6 +1788,9 @@ void DServer::check_lock_owner(DeviceImpl *dev,const char *cmd_name,const char *
 void DServer::get_event_misc_prop(Tango::Util *tg)
 {
 
+	zmq_event_batch_window = 0;
+	zmq_event_batch_max = EVENT_BATCH_MAX;
+
 	if (tg->_UseDb == true)
 	{
 
@@ -1555,6 +1807,8 @@ void DServer::get_event_misc_prop(Tango::Util *tg)
 		db_data.push_back(DbDatum("DSEventBufferHwm"));
 		db_data.push_back(DbDatum("EventBufferHwm"));
 		db_data.push_back(DbDatum("WAttrNaNAllowed"));
+		db_data.push_back(DbDatum("EventBatchWindow"));
+		db_data.push_back(DbDatum("EventBatchMax"));
 
 		try
 		{
@@ -1704,6 +1958,15 @@ void DServer::get_event_misc_prop(Tango::Util *tg)
                 tg->set_wattr_nan_allowed(new_val);
             }
 
+//
+// Event batching (window in uS and max event number in one batch)
+//
+
+            if (db_data[7].is_empty() == false)
+                db_data[7] >> zmq_event_batch_window;
+            if (db_data[8].is_empty() == false)
+                db_data[8] >> zmq_event_batch_max;
+
 		}
 		catch (Tango::DevFailed &)
 		{
@@ -1773,5 +2036,238 @@ void DServer::mcast_event_for_att(string &dev_name,string &att_name,vector<strin
 	}
 }
 
+//+----------------------------------------------------------------------------
+//
+// method : 		DServer::read_attr_multi_dev()
+//
+// description : 	command to read the same attribute(s) from several
+//			devices of this process in one call. Clients reading
+//			many devices of the same server (Group) then need one
+//			network round trip instead of one per device.
+//			The devices are read in parallel (one thread per device,
+//			at most MULTI_DEV_READ_MAX_DEV devices per call) and
+//			without the admin device monitor, so the call lasts
+//			about as long as the slowest device and does not block
+//			the other admin device commands. With the BY_PROCESS
+//			serialization model and for Python servers, the devices
+//			are read one after the other.
+//
+// in :			in_data : Lg[0] = Data source (DevSource)
+//				  Lg[1] = Number of attribute names (n)
+//				  Str[0..n-1] = Attribute names
+//				  Str[n...] = Device names
+//
+// out :		A DevEncoded with format MULTI_DEV_READ_FORMAT. Its data
+//			is a CDR encapsulation of an AttributeValueList_4 with
+//			n values per device, in device order. An error for one
+//			device is returned in the err_list of each of its values.
+//
+//-----------------------------------------------------------------------------
+
+Tango::DevEncoded *DServer::read_attr_multi_dev(const Tango::DevVarLongStringArray *in_data)
+{
+	cout4 << "In read_attr_multi_dev command" << endl;
+
+	if ((in_data->lvalue.length() != 2) || (in_data->lvalue[1] <= 0) ||
+		(in_data->svalue.length() <= (unsigned long)in_data->lvalue[1]))
+	{
+		Except::throw_exception((const char *)"API_WrongNumberOfArgs",
+					(const char *)"Incorrect number of inout arguments",
+					(const char *)"DServer::read_attr_multi_dev");
+	}
+
+	Tango::DevSource source = (Tango::DevSource)in_data->lvalue[0];
+	unsigned long nb_attr = in_data->lvalue[1];
+	unsigned long nb_dev = in_data->svalue.length() - nb_attr;
+
+	if (nb_dev > MULTI_DEV_READ_MAX_DEV)
+	{
+		TangoSys_OMemStream o;
+		o << "Too many devices (" << nb_dev << ") in one call. The maximum is " << MULTI_DEV_READ_MAX_DEV << ends;
+		Except::throw_exception((const char *)"API_WrongNumberOfArgs",o.str(),
+					(const char *)"DServer::read_attr_multi_dev");
+	}
+
+	Tango::DevVarStringArray names(nb_attr);
+	names.length(nb_attr);
+	for (unsigned long i = 0;i < nb_attr;i++)
+	{
+		if (::strcmp(in_data->svalue[i],AllAttr) == 0)
+		{
+			Except::throw_exception((const char *)"API_NotSupportedFeature",
+						(const char *)"The \"All attributes\" shortcut is not supported by this command",
+						(const char *)"DServer::read_attr_multi_dev");
+		}
+		names[i] = in_data->svalue[i];
+	}
+
+	vector<MultiDevReadJob> jobs(nb_dev);
+	for (unsigned long d = 0;d < nb_dev;d++)
+	{
+		jobs[d].dev_name = in_data->svalue[nb_attr + d].in();
+		jobs[d].values = NULL;
+	}
+
+//
+// Release the admin device monitor while the devices are read (as done in
+// Util::trigger_attr_polling()). Each device read takes its own device monitor
+//
+
+	Tango::Util *tg = Tango::Util::instance();
+	TangoMonitor &adm_mon = get_dev_monitor();
+	omni_thread *th = omni_thread::self();
+	long lock_ctr = 0;
+
+	if ((tg->get_serial_model() == BY_DEVICE) && (th->id() == adm_mon.get_locking_thread_id()))
+	{
+		lock_ctr = adm_mon.get_locking_ctr();
+		for (long loop = 0;loop < lock_ctr;loop++)
+			adm_mon.rel_monitor();
+	}
+
+//
+// Read the devices. The first one is read by this thread
+//
+
+	bool parallel = (tg->get_serial_model() != BY_PROCESS) && (tg->is_py_ds() == false);
+	vector<MultiDevReadThread *> threads;
+
+	if (parallel == true)
+	{
+		for (unsigned long d = 1;d < nb_dev;d++)
+		{
+			try
+			{
+				MultiDevReadThread *r_th = new MultiDevReadThread(jobs[d],names,source);
+				r_th->start();
+				threads.push_back(r_th);
+			}
+			catch (...)
+			{
+				break;
+			}
+		}
+	}
+
+	MultiDevReadThread::read_device(jobs[0],names,source);
+	for (unsigned long d = threads.size() + 1;d < nb_dev;d++)
+		MultiDevReadThread::read_device(jobs[d],names,source);
+
+	for (unsigned long loop = 0;loop < threads.size();loop++)
+	{
+		void *dummy_ptr;
+		threads[loop]->join(&dummy_ptr);
+	}
+
+	for (long loop = 0;loop < lock_ctr;loop++)
+		adm_mon.get_monitor();
+
+//
+// Marshall the values device after device, with the layout of a sequence.
+// Each device reply is freed as soon as it is marshalled
+//
+
+	cdrEncapsulationStream cdr;
+	CORBA::ULong nb_val = nb_dev * nb_attr;
+	nb_val >>= cdr;
+
+	for (unsigned long d = 0;d < nb_dev;d++)
+	{
+		for (unsigned long i = 0;i < nb_attr;i++)
+		{
+			if (jobs[d].values != NULL)
+				(*jobs[d].values)[i] >>= cdr;
+			else
+			{
+				Tango::AttributeValue_4 err_val;
+				err_val.value.union_no_data(true);
+				err_val.quality = Tango::ATTR_INVALID;
+				err_val.data_format = Tango::FMT_UNKNOWN;
+				err_val.time.tv_sec = 0;
+				err_val.time.tv_usec = 0;
+				err_val.time.tv_nsec = 0;
+				err_val.r_dim.dim_x = 0;
+				err_val.r_dim.dim_y = 0;
+				err_val.w_dim.dim_x = 0;
+				err_val.w_dim.dim_y = 0;
+				err_val.name = CORBA::string_dup(names[i]);
+				err_val.err_list = jobs[d].errors;
+
+				err_val >>= cdr;
+			}
+		}
+
+		delete jobs[d].values;
+		jobs[d].values = NULL;
+	}
+
+	Tango::DevEncoded *ret = new Tango::DevEncoded();
+	ret->encoded_format = CORBA::string_dup(MULTI_DEV_READ_FORMAT);
+	ret->encoded_data.length(cdr.bufSize());
+	::memcpy(ret->encoded_data.get_buffer(),cdr.bufPtr(),cdr.bufSize());
+
+	return ret;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		MultiDevReadThread::run_undetached
+//
+// description : 	Read one device for the ReadAttrMultiDev command
+//
+//-----------------------------------------------------------------------------
+
+void *MultiDevReadThread::run_undetached(TANGO_UNUSED(void *ptr))
+{
+	read_device(job,names,source);
+	return NULL;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		MultiDevReadThread::read_device
+//
+// description : 	Read the attributes of one device. The values or the
+//					error are stored in the job
+//
+// argin: job : The device to read
+//		  names : The attribute names
+//		  source : The data source
+//
+//-----------------------------------------------------------------------------
+
+void MultiDevReadThread::read_device(MultiDevReadJob &job,const DevVarStringArray &names,DevSource source)
+{
+	Tango::ClntIdent dummy_cl_id;
+	Tango::CppClntIdent cci = 0;
+	dummy_cl_id.cpp_clnt(cci);
+
+	try
+	{
+		DeviceImpl *dev = Tango::Util::instance()->get_device_by_name(job.dev_name);
+		if (dev->get_dev_idl_version() < 4)
+		{
+			TangoSys_OMemStream o;
+			o << "Device " << dev->get_name() << " is too old (IDL < 4) to be read by this command" << ends;
+			Except::throw_exception((const char *)"API_NotSupportedFeature",o.str(),
+						(const char *)"DServer::read_attr_multi_dev");
+		}
+
+		job.values = (static_cast<Device_4Impl *>(dev))->read_attributes_4(names,source,dummy_cl_id);
+	}
+	catch (Tango::DevFailed &e)
+	{
+		job.errors = e.errors;
+	}
+	catch (...)
+	{
+		job.errors.length(1);
+		job.errors[0].severity = Tango::ERR;
+		job.errors[0].origin = CORBA::string_dup("DServer::read_attr_multi_dev");
+		job.errors[0].reason = CORBA::string_dup("API_UnknownException");
+		job.errors[0].desc = CORBA::string_dup("Unknown exception while reading the device");
+	}
+}
+
 } // End of Tango namespace
 
@@ -55,6 +55,31 @@ namespace Tango
 typedef Tango::DeviceClass *(*Cpp_creator_ptr)(const char *);
 typedef void (*ClassFactoryFuncPtr)(DServer *);
 
+//
+// One class device factory executed by the device startup threads pool
+//
+
+struct DevFactoryJob
+{
+	DeviceClass			*dev_class;
+	DevVarStringArray	dev_list;
+	bool				mem_failed;
+	bool				named_failed;		// errors (and err_list) come from a NamedDevFailedList
+	DevErrorList		errors;
+	vector<NamedDevFailed>	err_list;
+};
+
+//
+// One device read by the ReadAttrMultiDev command
+//
+
+struct MultiDevReadJob
+{
+	string					dev_name;
+	AttributeValueList_4	*values;
+	DevErrorList			errors;
+};
+
 class DServer: public Device_4Impl
 {
 public :
@@ -72,6 +97,7 @@ public :
 
 	Tango::DevVarStringArray *polled_device();
 	Tango::DevVarStringArray *dev_poll_status(string &);
+	Tango::DevVarDoubleStringArray *dev_poll_status_bin(string &);
 	void add_obj_polling(const Tango::DevVarLongStringArray *,bool with_db_upd = true,int delta_ms = 0);
 	void upd_obj_polling_period(const Tango::DevVarLongStringArray *,bool with_db_upd = true);
 	void rem_obj_polling(const Tango::DevVarStringArray *,bool with_db_upd = true);
@@ -88,6 +114,9 @@ public :
 
 	Tango::DevLong event_subscription_change(const Tango::DevVarStringArray *);
 	Tango::DevVarLongStringArray *zmq_event_subscription_change(const Tango::DevVarStringArray *);
+	Tango::DevVarLongStringArray *zmq_event_subscription_change_bulk(const Tango::DevVarStringArray *);
+
+	Tango::DevEncoded *read_attr_multi_dev(const Tango::DevVarLongStringArray *);
 
 	void delete_devices();
 
@@ -128,6 +157,7 @@ public :
 
 	friend class NotifdEventSupplier;
 	friend class ZmqEventSupplier;
+	friend class DevFactoryThread;
 
 protected :
 	string							process_name;
@@ -156,7 +186,10 @@ private:
 	void add_class(DeviceClass *);
 	void create_cpp_class(const char *,const char *);
 	void get_dev_prop(Tango::Util *);
+	void run_device_factory(DeviceClass *,DevVarStringArray *);
+	void parallel_device_factory(vector<DevFactoryJob> &,unsigned long);
     void event_subscription(string &,string &,string &,string &,string &,ChannelType,string &,int &,int &,DeviceImpl *);
+    void zmq_event_subscription(string &,string &,string &,string &,bool,DevLong &,int &,int &,string &);
 	void get_event_misc_prop(Tango::Util *);
 	bool is_event_name(string &);
 	bool is_ip_address(string &);
@@ -169,6 +202,8 @@ private:
 	DevLong         mcast_ivl;
 	DevLong         zmq_pub_event_hwm;
 	DevLong         zmq_sub_event_hwm;
+	DevLong         zmq_event_batch_window;
+	DevLong         zmq_event_batch_max;
 };
 
 class KillThread: public omni_thread
@@ -187,6 +222,38 @@ public:
 	void run(void *);
 };
 
+class MultiDevReadThread: public omni_thread
+{
+public:
+	MultiDevReadThread(MultiDevReadJob &j,const DevVarStringArray &na,DevSource so)
+	:job(j),names(na),source(so) {}
+
+	void *run_undetached(void *);
+	void start() {start_undetached();}
+
+	static void read_device(MultiDevReadJob &,const DevVarStringArray &,DevSource);
+
+private:
+	MultiDevReadJob			&job;
+	const DevVarStringArray	&names;
+	DevSource				source;
+};
+
+class DevFactoryThread: public omni_thread
+{
+public:
+	DevFactoryThread(DServer *dev,vector<DevFactoryJob> &jobs,omni_mutex &mut,unsigned long &next)
+	:omni_thread(dev),job_list(jobs),job_mutex(mut),next_job(next) {}
+
+	void *run_undetached(void *);
+	void start() {start_undetached();}
+
+private:
+	vector<DevFactoryJob>	&job_list;
+	omni_mutex				&job_mutex;
+	unsigned long			&next_job;
+};
+
 struct Pol
 {
 	PollObjType 	type;
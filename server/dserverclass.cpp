@@ -1379,6 +1379,163 @@ CORBA::Any *ZmqEventSubscriptionChangeCmd::execute(Tango::DeviceImpl *device,con
 	return(out_any);
 }
 
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSubscriptionChangeBulkCmd::ZmqEventSubscriptionChangeBulkCmd()
+//
+// description : 	constructor for the command of the .
+//
+// In : - name : The command name
+//		- in : The input parameter type
+//		- out : The output parameter type
+//		- in_desc : The input parameter description
+//		- out_desc : The output parameter description
+//
+//-----------------------------------------------------------------------------
+ZmqEventSubscriptionChangeBulkCmd::ZmqEventSubscriptionChangeBulkCmd(const char *name,
+								Tango::CmdArgType in,
+								Tango::CmdArgType out,
+								const char *in_desc,
+								const char *out_desc)
+:Command(name,in,out,in_desc,out_desc)
+{
+}
+
+//
+//	Constructor without in/out parameters description
+//
+
+ZmqEventSubscriptionChangeBulkCmd::ZmqEventSubscriptionChangeBulkCmd(const char *name,Tango::CmdArgType in,Tango::CmdArgType out)
+:Command(name,in,out)
+{
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSubscriptionChangeBulkCmd::is_allowed()
+//
+// description : 	method to test whether command is allowed or not in this
+//			state. In this case, the command is allowed only if
+//			the device is in ON state
+//
+// in : - device : The device on which the command must be excuted
+//		- in_any : The command input data
+//
+// returns :	boolean - true == is allowed , false == not allowed
+//
+//-----------------------------------------------------------------------------
+bool ZmqEventSubscriptionChangeBulkCmd::is_allowed(TANGO_UNUSED(Tango::DeviceImpl *device), TANGO_UNUSED(const CORBA::Any &in_any))
+{
+		//	End of Generated Code
+
+		//	Re-Start of Generated Code
+		return true;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSubscriptionChangeBulkCmd::execute()
+//
+// description : 	method to trigger the execution of the command.
+//
+// in : - device : The device on which the command must be excuted
+//		- in_any : The command input data
+//
+// returns : The command output data (packed in the Any object)
+//
+//-----------------------------------------------------------------------------
+CORBA::Any *ZmqEventSubscriptionChangeBulkCmd::execute(Tango::DeviceImpl *device,const CORBA::Any &in_any)
+{
+    cout4 << "ZmqEventSubscriptionChangeBulkCmd::execute(): arrived" << endl;
+
+//
+// Extract the input string array
+//
+
+	const Tango::DevVarStringArray *in_data;
+	extract(in_any,in_data);
+
+//
+// call DServer method which implements this command
+//
+
+	Tango::DevVarLongStringArray *ret = (static_cast<DServer *>(device))->zmq_event_subscription_change_bulk(in_data);
+
+//
+// return to the caller
+//
+
+	CORBA::Any *out_any = NULL;
+	try
+	{
+		out_any = new CORBA::Any();
+	}
+	catch (bad_alloc)
+	{
+		cout3 << "Bad allocation while in ZmqEventSubscriptionChangeBulkCmd::execute()" << endl;
+		Except::throw_exception((const char *)"API_MemoryAllocation",
+				      (const char *)"Can't allocate memory in server",
+				      (const char *)"ZmqEventSubscriptionChangeBulkCmd::execute");
+	}
+	(*out_any) <<= ret;
+
+	cout4 << "Leaving ZmqEventSubscriptionChangeBulkCmd::execute()" << endl;
+	return(out_any);
+}
+
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ReadAttrMultiDevCmd::ReadAttrMultiDevCmd
+//
+// description : 	constructor for the ReadAttrMultiDev command of the DServer.
+//
+//-----------------------------------------------------------------------------
+
+
+ReadAttrMultiDevCmd::ReadAttrMultiDevCmd(const char *name,
+			     	     	   Tango::CmdArgType in,
+			     	     	   Tango::CmdArgType out,
+					   		   const char *in_desc,
+					   		   const char *out_desc):Command(name,in,out)
+{
+	set_in_type_desc(in_desc);
+	set_out_type_desc(out_desc);
+}
+
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ReadAttrMultiDevCmd::execute()
+//
+// description : 	method to trigger the execution of the "ReadAttrMultiDev" command
+//
+//-----------------------------------------------------------------------------
+
+CORBA::Any *ReadAttrMultiDevCmd::execute(DeviceImpl *device,const CORBA::Any &in_any)
+{
+
+	cout4 << "ReadAttrMultiDevCmd::execute(): arrived" << endl;
+
+//
+// Extract the input data
+//
+
+	const Tango::DevVarLongStringArray *in_data;
+	extract(in_any,in_data);
+
+//
+// call DServer method which implements this command
+//
+
+	Tango::DevEncoded *ret = (static_cast<DServer *>(device))->read_attr_multi_dev(in_data);
+
+//
+// return to the caller
+//
+
+	return insert(ret);
+}
 
 
 DServerClass *DServerClass::_instance = NULL;
@@ -1421,6 +1578,7 @@ DServerClass::DServerClass(string &s):DeviceClass(s)
 //
 
 		sort(get_command_list().begin(),get_command_list().end(),less_than_dserver);
+		build_command_map();
 
 //
 // Create device name from device server name
@@ -1452,7 +1610,10 @@ DServerClass::DServerClass(string &s):DeviceClass(s)
 		if (device_list.empty() == false)
 		{
 			for (unsigned long i = 0;i < device_list.size();i++)
+			{
+				Tango::Util::instance()->unregister_device_name(device_list[i]);
 				delete device_list[i];
+			}
 			device_list.clear();
 		}
 		cerr << "Can't allocate memory while building the DServerClass object" << endl;
@@ -1546,6 +1707,18 @@ void DServerClass::command_factory()
 						   Tango::DEVVAR_STRINGARRAY,
 						   "Device name",
 						   "Device polling status"));
+
+	string bin_msg("Str[i]=Object name. For each object, ");
+	bin_msg = bin_msg + ("Dbl[i*10]=Object type (0=command, 1=attribute). Dbl[i*10+1]=Polling period (mS, 0=externally triggered)");
+	bin_msg = bin_msg + (". Dbl[i*10+2]=Ring depth. Dbl[i*10+3]=Last reading time (mS, -1=no data)");
+	bin_msg = bin_msg + (". Dbl[i*10+4]=Not updated since (mS). Dbl[i*10+5..8]=Delta between last records (mS)");
+	bin_msg = bin_msg + (". Dbl[i*10+9]=Last reading failed flag");
+
+	command_list.push_back(new DevPollStatusBinCmd("DevPollStatusBin",
+						   Tango::DEV_STRING,
+						   Tango::DEVVAR_DOUBLESTRINGARRAY,
+						   "Device name",
+						   bin_msg));
 	string msg("Lg[0]=Upd period.");
 	msg = msg + (" Str[0]=Device name");
 	msg = msg + (". Str[1]=Object type");
@@ -1641,6 +1814,16 @@ void DServerClass::command_factory()
 							"Events consumer wants to subscribe to",
 							"Str[0] = Heartbeat pub endpoint - Str[1] = Event pub endpoint - Lg[0] = Tango lib release - Lg[1] = Device IDL release"));
 
+	command_list.push_back(new ZmqEventSubscriptionChangeBulkCmd("ZmqEventSubscriptionChangeBulk",
+							Tango::DEVVAR_STRINGARRAY, Tango::DEVVAR_LONGSTRINGARRAY,
+							"Str[0] = Client option - Then 4 strings per event (device, attribute, action, event)",
+							"Str[0] = Heartbeat pub endpoint - Str[1] = Batch event name - Lg[0] = Tango lib release - Lg[1] = ZMQ sub HWM - Then 4 longs and 2 strings per event"));
+
+	command_list.push_back(new ReadAttrMultiDevCmd("ReadAttrMultiDev",
+							Tango::DEVVAR_LONGSTRINGARRAY, Tango::DEV_ENCODED,
+							"Lg[0] = Data source - Lg[1] = Attribute number (n) - Str[0..n-1] = Attribute names - Str[n...] = Device names",
+							"CDR encoded AttributeValueList_4 (n values per device)"));
+
 	command_list.push_back(new QueryWizardClassPropertyCmd("QueryWizardClassProperty",
 							Tango::DEV_STRING,
 							Tango::DEVVAR_STRINGARRAY,
@@ -1718,6 +1901,7 @@ void DServerClass::device_factory(const Tango::DevVarStringArray *devlist_ptr)
 						  "A device server device !!",
 						  Tango::ON,
 						  "The device is ON"));
+		tg->register_device_name(device_list.back()->get_name_lower(),device_list.back());
 
 
 //
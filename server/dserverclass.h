@@ -512,6 +512,50 @@ public:
 	virtual CORBA::Any *execute (Tango::DeviceImpl *, const CORBA::Any &);
 };
 
+//=============================================================================
+//
+//			The ZmqEventSubscriptionChangeBulkCmd class
+//
+// description :	Class to implement the ZmqEventSubscriptionChangeBulk
+//			command. This command takes a list of events for
+//			which the user subscribe to
+//
+//=============================================================================
+
+class ZmqEventSubscriptionChangeBulkCmd : public Tango::Command
+{
+public:
+	ZmqEventSubscriptionChangeBulkCmd(const char *,Tango::CmdArgType, Tango::CmdArgType,const char *,const char *);
+	ZmqEventSubscriptionChangeBulkCmd(const char *,Tango::CmdArgType, Tango::CmdArgType);
+	~ZmqEventSubscriptionChangeBulkCmd() {};
+
+	virtual bool is_allowed (Tango::DeviceImpl *, const CORBA::Any &);
+	virtual CORBA::Any *execute (Tango::DeviceImpl *, const CORBA::Any &);
+};
+
+//=============================================================================
+//
+//			The ReadAttrMultiDevCmd class
+//
+// description :	Class to implement the ReadAttrMultiDev command.
+//			This command reads the same attribute(s) from several
+//			devices of the process in one call
+//
+//=============================================================================
+
+class ReadAttrMultiDevCmd : public Command
+{
+public:
+
+	ReadAttrMultiDevCmd(const char *cmd_name,
+			  Tango::CmdArgType in,Tango::CmdArgType out,
+			  const char *in_desc,const char *out_desc);
+
+	~ReadAttrMultiDevCmd() {};
+
+	virtual CORBA::Any *execute(DeviceImpl *device, const CORBA::Any &in_any);
+};
+
 //=============================================================================
 //
 //			The DServerClass class
@@ -207,6 +207,25 @@ Tango::DevVarStringArray *DServer::dev_poll_status(string &dev_name)
 	long attr_ind = nb_cmd;
 	string returned_info;
 
+//
+// Get the polling thread work stealing statistics (if this mode is used)
+//
+
+	bool steal_mode = false;
+	long nb_stolen = 0;
+	long nb_out_of_sync = 0;
+
+	int th_id = tg->get_polling_thread_id_by_name(dev_name.c_str());
+	if (th_id != 0)
+	{
+		PollingThreadInfo *th_info = tg->get_polling_thread_info_by_id(th_id);
+		if ((th_info->poll_th != NULL) && (th_info->poll_th->is_work_stealing() == true))
+		{
+			steal_mode = true;
+			th_info->poll_th->get_steal_stats(nb_stolen,nb_out_of_sync);
+		}
+	}
+
 	for(i = 0;i < nb_poll_obj;i++)
 	{
 		bool duplicate = false;
@@ -496,6 +515,176 @@ Tango::DevVarStringArray *DServer::dev_poll_status(string &dev_name)
 		}
 	}
 
+//
+// Add the polling thread work stealing statistics. They are not related to one
+// polled object, so return them once, in their own string after the polled
+// objects strings
+//
+
+	if ((steal_mode == true) && (ret->length() != 0))
+	{
+		stringstream s;
+		s << "Polling thread work stealing: " << nb_stolen << " work(s) executed by other pool threads, ";
+		s << nb_out_of_sync << " work(s) discarded (out of sync)";
+
+		unsigned long nb_str = ret->length();
+		ret->length(nb_str + 1);
+		(*ret)[nb_str] = CORBA::string_dup(s.str().c_str());
+	}
+
+	return(ret);
+
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		DServer::dev_poll_status_bin()
+//
+// description : 	command to read device polling status as numbers.
+//			For each polled object, the object name is returned
+//			in the string array and POLL_STATUS_BIN_FIELDS doubles
+//			in the double array:
+//				- Object type (0 for command, 1 for attribute)
+//				- Polling period in mS (0 if externally triggered)
+//				- Polling ring buffer depth
+//				- Time needed for last reading in mS (-1 if no
+//				  data recorded yet, 0 if the buffer is
+//				  externally filled)
+//				- Data not updated since (mS, -1 if not known)
+//				- Delta between last records (mS, -1 if not known)
+//				- Last reading failed flag (1 if failed)
+//			State and Status are returned only once, as attributes.
+//
+// out :		The device polling status
+//
+//-----------------------------------------------------------------------------
+
+Tango::DevVarDoubleStringArray *DServer::dev_poll_status_bin(string &dev_name)
+{
+	NoSyncModelTangoMonitor mon(this);
+
+	cout4 << "In dev_poll_status_bin method" << endl;
+
+//
+// Find the device
+//
+
+	Tango::Util *tg = Tango::Util::instance();
+	DeviceImpl *dev;
+
+	dev = tg->get_device_by_name(dev_name);
+
+	vector<PollObj *> &poll_list = dev->get_poll_obj_list();
+	long nb_poll_obj = poll_list.size();
+
+	Tango::DevVarDoubleStringArray *ret = new Tango::DevVarDoubleStringArray();
+	ret->svalue.length(nb_poll_obj);
+	ret->dvalue.length(nb_poll_obj * POLL_STATUS_BIN_FIELDS);
+
+	long dev_vers = dev->get_dev_idl_version();
+	vector<Command *> &cmd_list = dev->get_device_class()->get_command_list();
+
+	for (long i = 0;i < nb_poll_obj;i++)
+	{
+		CORBA::Double *fields = &(ret->dvalue[i * POLL_STATUS_BIN_FIELDS]);
+		for (long f = 3;f < POLL_STATUS_BIN_FIELDS - 1;f++)
+			fields[f] = -1.0;
+		fields[POLL_STATUS_BIN_FIELDS - 1] = 0.0;
+
+//
+// Object type and name (with its original case)
+//
+
+		Tango::PollObjType type = poll_list[i]->get_type();
+		string &obj_name = poll_list[i]->get_name();
+		fields[0] = (CORBA::Double)type;
+
+		if (type == Tango::POLL_CMD)
+		{
+			ret->svalue[i] = CORBA::string_dup(obj_name.c_str());
+			for (unsigned long k = 0;k < cmd_list.size();k++)
+			{
+				if (cmd_list[k]->get_lower_name() == obj_name)
+				{
+					ret->svalue[i] = CORBA::string_dup(cmd_list[k]->get_name().c_str());
+					break;
+				}
+			}
+		}
+		else
+		{
+			if (obj_name == "state")
+				ret->svalue[i] = CORBA::string_dup("State");
+			else if (obj_name == "status")
+				ret->svalue[i] = CORBA::string_dup("Status");
+			else
+			{
+				Attribute &att = dev->get_device_attr()->get_attr_by_name(obj_name.c_str());
+				ret->svalue[i] = CORBA::string_dup(att.get_name().c_str());
+			}
+		}
+
+//
+// Update period and ring depth
+//
+
+		long po = poll_list[i]->get_upd();
+		fields[1] = (CORBA::Double)po;
+		if (type == Tango::POLL_CMD)
+			fields[2] = (CORBA::Double)dev->get_cmd_poll_ring_depth(obj_name);
+		else
+			fields[2] = (CORBA::Double)dev->get_attr_poll_ring_depth(obj_name);
+
+		if (poll_list[i]->is_ring_empty() == true)
+			continue;
+
+//
+// Take polled object ownership in order to have coherent info (see
+// dev_poll_status)
+//
+
+		omni_mutex_lock sync(*(poll_list[i]));
+
+		double needed = poll_list[i]->get_needed_time_i();
+		fields[3] = needed;
+
+		if ((needed != 0.0) && (po != 0))
+		{
+			struct timeval now;
+#ifdef _TG_WINDOWS_
+			struct _timeb now_win;
+			_ftime(&now_win);
+			now.tv_sec = (unsigned long)now_win.time;
+			now.tv_usec = (long)now_win.millitm * 1000;
+#else
+			gettimeofday(&now,NULL);
+#endif
+			now.tv_sec = now.tv_sec - DELTA_T;
+			double now_d = (double)now.tv_sec + ((double)now.tv_usec / 1000000);
+			double diff_t = now_d - poll_list[i]->get_last_insert_date_i() - (needed / 1000);
+			fields[4] = (CORBA::Double)((long)(diff_t * 1000));
+		}
+
+		try
+		{
+			vector<double> delta;
+			poll_list[i]->get_delta_t_i(delta,POLL_STATUS_BIN_DELTA);
+			for (unsigned long j = 0;j < delta.size() && j < POLL_STATUS_BIN_DELTA;j++)
+				fields[5 + j] = (CORBA::Double)((long)(delta[j] * 1000));
+		}
+		catch (Tango::DevFailed &)
+		{
+		}
+
+		bool last_err;
+		if (dev_vers < 3)
+			last_err = poll_list[i]->is_last_an_error_i();
+		else
+			last_err = poll_list[i]->is_last_an_error_i_3();
+		if (last_err == true)
+			fields[POLL_STATUS_BIN_FIELDS - 1] = 1.0;
+	}
+
 	return(ret);
 
 }
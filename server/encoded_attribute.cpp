@@ -42,7 +42,7 @@ using namespace Tango;
 
 // ----------------------------------------------------------------------------
 
-EncodedAttribute::EncodedAttribute():manage_exclusion(false),ext(Tango_NullPtr) {
+EncodedAttribute::EncodedAttribute():manage_exclusion(false),ext(new EncodedAttributeExt) {
 
   buffer_array = (unsigned char **)calloc(1,sizeof(unsigned char *));
   buffer_array[0] = NULL;
@@ -54,7 +54,7 @@ EncodedAttribute::EncodedAttribute():manage_exclusion(false),ext(Tango_NullPtr)
   buf_elt_nb = 1;
 }
 
-EncodedAttribute::EncodedAttribute(int si,bool excl):manage_exclusion(excl),ext(Tango_NullPtr) {
+EncodedAttribute::EncodedAttribute(int si,bool excl):manage_exclusion(excl),ext(new EncodedAttributeExt) {
 
   buffer_array = (unsigned char **)calloc(si,sizeof(unsigned char *));
   buffSize_array = (int *)calloc(si,sizeof(int));
@@ -82,6 +82,10 @@ EncodedAttribute::~EncodedAttribute() {
 
   if (mutex_array != NULL)
     delete [] mutex_array;
+
+#ifndef HAS_UNIQUE_PTR
+  delete ext;
+#endif
 }
 
 // ----------------------------------------------------------------------------
@@ -94,7 +98,7 @@ void EncodedAttribute::encode_jpeg_gray8(unsigned char *gray8,int width,int heig
   SAFE_FREE(buffer_array[index]);
   buffSize_array[index] = 0;
   format = (char *)JPEG_GRAY8;
-  jpeg_encode_gray8(width,height,gray8,quality,&(buffSize_array[index]),&(buffer_array[index]));
+  jpeg_encode_gray8(width,height,gray8,quality,&(buffSize_array[index]),&(buffer_array[index]),ext->jpeg_threads);
   INC_INDEX()
 }
 
@@ -108,7 +112,7 @@ void EncodedAttribute::encode_jpeg_rgb32(unsigned char *rgb32,int width,int heig
   SAFE_FREE(buffer_array[index]);
   buffSize_array[index] = 0;
   format = (char *)JPEG_RGB;
-  jpeg_encode_rgb32(width,height,rgb32,quality,&(buffSize_array[index]),&(buffer_array[index]));
+  jpeg_encode_rgb32(width,height,rgb32,quality,&(buffSize_array[index]),&(buffer_array[index]),ext->jpeg_threads);
   INC_INDEX()
 }
 
@@ -122,7 +126,7 @@ void EncodedAttribute::encode_jpeg_rgb24(unsigned char *rgb24,int width,int heig
   SAFE_FREE(buffer_array[index]);
   buffSize_array[index] = 0;
   format = (char *)JPEG_RGB;
-  jpeg_encode_rgb24(width,height,rgb24,quality,&(buffSize_array[index]),&(buffer_array[index]));
+  jpeg_encode_rgb24(width,height,rgb24,quality,&(buffSize_array[index]),&(buffer_array[index]),ext->jpeg_threads);
   INC_INDEX()
 }
 
@@ -123,6 +123,18 @@ public:
  */
  void encode_jpeg_rgb24(unsigned char *rgb24,int width,int height,double quality);
 
+/**
+ * Set the number of threads used to encode JPEG images
+ *
+ * When greater than 1, the image is split in horizontal bands which are
+ * encoded in parallel and separated by JPEG restart markers. The number of
+ * threads is limited to the number of MCU rows of the image. Default is 1.
+ *
+ * @param nb    The number of encoding threads
+ *
+ */
+ void set_jpeg_encoding_threads(int nb) {ext->jpeg_threads = (nb < 1) ? 1 : nb;}
+
 /**
  * Encode a 8 bit grayscale image (no compression)
  *
@@ -216,6 +228,10 @@ public:
 private:
     class EncodedAttributeExt
     {
+    public:
+        EncodedAttributeExt():jpeg_threads(1) {}
+
+        int                 jpeg_threads;       // Nb of threads used for JPEG encoding
     };
 
     unsigned char 		    **buffer_array;
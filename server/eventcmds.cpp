@@ -542,6 +542,14 @@ DevVarLongStringArray *DServer::zmq_event_subscription_change(const Tango::DevVa
             tmp_str = tmp_str + ev->get_event_endpoint();
             ret_data->svalue[1] = CORBA::string_dup(tmp_str.c_str());
 
+            if (ev->get_ipc_event_endpoint().empty() == false)
+            {
+                ret_data->svalue.length(3);
+                tmp_str = "Local event: ";
+                tmp_str = tmp_str + ev->get_ipc_event_endpoint();
+                ret_data->svalue[2] = CORBA::string_dup(tmp_str.c_str());
+            }
+
         }
         else
         {
@@ -550,42 +558,224 @@ DevVarLongStringArray *DServer::zmq_event_subscription_change(const Tango::DevVa
     }
     else
     {
-        string dev_name, attr_name, action, event, attr_name_lower;
+        string dev_name, attr_name, action, event;
         dev_name = (*argin)[0];
         attr_name = (*argin)[1];
         action = (*argin)[2];
         event = (*argin)[3];
 
-        attr_name_lower = attr_name;
-        transform(attr_name_lower.begin(),attr_name_lower.end(),attr_name_lower.begin(),::tolower);
+//
+// Does the client support event batching (fifth argument)?
+//
+
+        bool batch_client = false;
+        if ((argin->length() > 4) && (::strcmp((*argin)[4],BATCH_EVENT_CLIENT) == 0))
+            batch_client = true;
+
+        DevLong idl;
+        int rate,ivl;
+        string endpoint;
+
+        zmq_event_subscription(dev_name,attr_name,action,event,batch_client,idl,rate,ivl,endpoint);
+
+//
+// Init data returned by command
+//
+
+        ZmqEventSupplier *ev = tg->get_zmq_event_supplier();
+
+        ret_data->lvalue.length(5);
+        ret_data->svalue.length(2);
+
+        ret_data->lvalue[0] = (Tango::DevLong)tg->get_tango_lib_release();
+        ret_data->lvalue[1] = idl;
+        ret_data->lvalue[2] = zmq_sub_event_hwm;
+        ret_data->lvalue[3] = rate;
+        ret_data->lvalue[4] = ivl;
+
+        string &heartbeat_endpoint = ev->get_heartbeat_endpoint();
+        ret_data->svalue[0] = CORBA::string_dup(heartbeat_endpoint.c_str());
+        ret_data->svalue[1] = CORBA::string_dup(endpoint.c_str());
 
-        cout4 << "ZmqEventSubscriptionChangeCmd: subscription for device " << dev_name << " attribute " << attr_name << " action " << action << " event " << event << endl;
+//
+// In event batching mode, also return the batch event name to client supporting it
+//
+
+        if ((batch_client == true) && (ev->is_event_batching() == true))
+        {
+            ret_data->svalue.length(3);
+            ret_data->svalue[2] = CORBA::string_dup(ev->get_batch_event_name(get_client_ident()).c_str());
+        }
+    }
+
+	return ret_data;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		DServer::zmq_event_subscription_change_bulk()
+//
+// description : 	method to execute the command ZmqEventSubscriptionChangeBulk
+//			command. This is the ZmqEventSubscriptionChange command for
+//			several events in one call. A failing subscription does not
+//			stop the others, its error is returned in place of its data
+//
+// in : - argin : The command input argument. Str[0] is the client option
+//		  (BATCH_EVENT_CLIENT or empty string) followed by 4 strings per event
+//		  (device name, attribute name, action, event name)
+//
+// returns : The command output data.
+//		Lg[0] = Tango lib release, Lg[1] = ZMQ subscriber HWM
+//		Str[0] = Heartbeat endpoint, Str[1] = Batch event name (or empty string)
+//		Then, for each event, 4 longs (error flag, device IDL release, rate,
+//		ivl) and 2 strings (event endpoint and empty string or error reason
+//		and error description)
+//
+//-----------------------------------------------------------------------------
+DevVarLongStringArray *DServer::zmq_event_subscription_change_bulk(const Tango::DevVarStringArray *argin)
+{
+	unsigned long nb_in = argin->length();
+	if ((nb_in < 5) || (((nb_in - 1) % 4) != 0))
+	{
+		TangoSys_OMemStream o;
+		o << "Wrong number of input arguments, needs one client option followed by 4 strings per event";
+		o << " i.e. device name, attribute name, action, event name" << ends;
+
+		Except::throw_exception((const char *)"DServer_Events",
+								o.str(),
+								(const char *)"DServer::zmq_event_subscription_change_bulk");
+	}
+
+	bool batch_client = false;
+	if (::strcmp((*argin)[0],BATCH_EVENT_CLIENT) == 0)
+		batch_client = true;
+
+	unsigned long nb_event = (nb_in - 1) / 4;
+	cout4 << "ZmqEventSubscriptionChangeBulkCmd: subscription for " << nb_event << " events" << endl;
+
+	Tango::DevVarLongStringArray *ret_data = new Tango::DevVarLongStringArray();
+	ret_data->lvalue.length(2 + (nb_event * 4));
+	ret_data->svalue.length(2 + (nb_event * 2));
+
+	for (unsigned long loop = 0;loop < nb_event;loop++)
+	{
+		string dev_name((*argin)[1 + (loop * 4)]);
+		string attr_name((*argin)[2 + (loop * 4)]);
+		string action((*argin)[3 + (loop * 4)]);
+		string event((*argin)[4 + (loop * 4)]);
+
+		DevLong idl = 0;
+		int rate = 0;
+		int ivl = 0;
+		string endpoint;
+
+		unsigned long l_ind = 2 + (loop * 4);
+		unsigned long s_ind = 2 + (loop * 2);
+
+		try
+		{
+			zmq_event_subscription(dev_name,attr_name,action,event,batch_client,idl,rate,ivl,endpoint);
+
+			ret_data->lvalue[l_ind] = 0;
+			ret_data->svalue[s_ind] = CORBA::string_dup(endpoint.c_str());
+			ret_data->svalue[s_ind + 1] = CORBA::string_dup("");
+		}
+		catch (Tango::DevFailed &e)
+		{
+			ret_data->lvalue[l_ind] = 1;
+			ret_data->svalue[s_ind] = CORBA::string_dup(e.errors[0].reason.in());
+			ret_data->svalue[s_ind + 1] = CORBA::string_dup(e.errors[0].desc.in());
+		}
+
+		ret_data->lvalue[l_ind + 1] = idl;
+		ret_data->lvalue[l_ind + 2] = rate;
+		ret_data->lvalue[l_ind + 3] = ivl;
+	}
+
+//
+// Data common to all events. The event supplier does not exist if all
+// subscriptions failed before its creation
+//
+
+	Tango::Util *tg = Tango::Util::instance();
+	ZmqEventSupplier *ev = tg->get_zmq_event_supplier();
+
+	ret_data->lvalue[0] = (Tango::DevLong)tg->get_tango_lib_release();
+	ret_data->lvalue[1] = zmq_sub_event_hwm;
+
+	if (ev != NULL)
+	{
+		ret_data->svalue[0] = CORBA::string_dup(ev->get_heartbeat_endpoint().c_str());
+		if ((batch_client == true) && (ev->is_event_batching() == true))
+			ret_data->svalue[1] = CORBA::string_dup(ev->get_batch_event_name(get_client_ident()).c_str());
+		else
+			ret_data->svalue[1] = CORBA::string_dup("");
+	}
+	else
+	{
+		ret_data->svalue[0] = CORBA::string_dup("");
+		ret_data->svalue[1] = CORBA::string_dup("");
+	}
+
+	return ret_data;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		DServer::zmq_event_subscription()
+//
+// description : 	method to subscribe to one ZMQ event. Used by the
+//			ZmqEventSubscriptionChange and ZmqEventSubscriptionChangeBulk
+//			commands
+//
+// in : - dev_name : The device name
+//      - attr_name : The attribute name
+//      - action : What the user want to do
+//      - event : The event type
+//      - batch_client : Flag set to true if the client supports event batching
+//
+// out : - idl : The device IDL release
+//       - rate : PGM rate parameter
+//       - ivl : PGM ivl parameter
+//       - endpoint : The endpoint the client has to connect to for this event
+//
+//-----------------------------------------------------------------------------
+
+void DServer::zmq_event_subscription(string &dev_name,string &attr_name,string &action,string &event,bool batch_client,
+									 DevLong &idl,int &rate,int &ivl,string &endpoint)
+{
+    Tango::Util *tg = Tango::Util::instance();
+
+    string attr_name_lower(attr_name);
+    transform(attr_name_lower.begin(),attr_name_lower.end(),attr_name_lower.begin(),::tolower);
+
+    cout4 << "ZmqEventSubscriptionChangeCmd: subscription for device " << dev_name << " attribute " << attr_name << " action " << action << " event " << event << endl;
 
 //
 // If we receive this command while the DS is in its
 // shuting down sequence, do nothing
 //
 
-        if (tg->get_heartbeat_thread_object() == NULL)
-        {
-            TangoSys_OMemStream o;
-            o << "The device server is shutting down! You can no longer subscribe for events" << ends;
+    if (tg->get_heartbeat_thread_object() == NULL)
+    {
+        TangoSys_OMemStream o;
+        o << "The device server is shutting down! You can no longer subscribe for events" << ends;
 
-            Except::throw_exception((const char *)"DServer_Events",
-                                            o.str(),
-                                           (const char *)"DServer::zmq_event_subscription_change");
-        }
+        Except::throw_exception((const char *)"DServer_Events",
+                                        o.str(),
+                                       (const char *)"DServer::zmq_event_subscription_change");
+    }
 
 //
 // If the EventSupplier object is not created, create it right now
 //
 
-        ZmqEventSupplier *ev;
-        if ((ev = tg->get_zmq_event_supplier()) == NULL)
-        {
-            tg->create_zmq_event_supplier();
-            ev = tg->get_zmq_event_supplier();
-        }
+    ZmqEventSupplier *ev;
+    if ((ev = tg->get_zmq_event_supplier()) == NULL)
+    {
+        tg->create_zmq_event_supplier();
+        ev = tg->get_zmq_event_supplier();
+    }
 
 //
 // Get device pointer and check which IDL release it implements
@@ -593,140 +783,123 @@ DevVarLongStringArray *DServer::zmq_event_subscription_change(const Tango::DevVa
 // simulate a Tango 7 DS (throw command not exist exception)
 //
 
-        DeviceImpl *dev = NULL;
+    DeviceImpl *dev = NULL;
 
-        try
-        {
-            dev = tg->get_device_by_name(dev_name);
-        }
-        catch (Tango::DevFailed &e)
-        {
-            TangoSys_OMemStream o;
-            o << "Device " << dev_name << " not found" << ends;
-            Except::re_throw_exception(e,(const char *)"API_DeviceNotFound",o.str(),
-                                       (const char *)"DServer::event_subscription");
-        }
+    try
+    {
+        dev = tg->get_device_by_name(dev_name);
+    }
+    catch (Tango::DevFailed &e)
+    {
+        TangoSys_OMemStream o;
+        o << "Device " << dev_name << " not found" << ends;
+        Except::re_throw_exception(e,(const char *)"API_DeviceNotFound",o.str(),
+                                   (const char *)"DServer::event_subscription");
+    }
 
-        if (dev->get_dev_idl_version() < 4)
-        {
-            TangoSys_OMemStream o;
+    idl = dev->get_dev_idl_version();
+    if (idl < 4)
+    {
+        TangoSys_OMemStream o;
 
-            o << "Device " << dev_name << " too old to use ZMQ event (it does not implement IDL 4)";
-            o << "\nSimulate a CommandNotFound exception to move to notifd event system" << ends;
-            Except::throw_exception((const char *)"API_CommandNotFound",
-				      o.str(),
-				      (const char *)"DServer::zmq_event_subscription_change");
-        }
+        o << "Device " << dev_name << " too old to use ZMQ event (it does not implement IDL 4)";
+        o << "\nSimulate a CommandNotFound exception to move to notifd event system" << ends;
+        Except::throw_exception((const char *)"API_CommandNotFound",
+			      o.str(),
+			      (const char *)"DServer::zmq_event_subscription_change");
+    }
 
 //
 // Call common method (common between old and new command)
 //
 
-        string mcast;
-        int rate,ivl;
+    string mcast;
 
-        event_subscription(dev_name,attr_name,action,event,attr_name_lower,ZMQ,mcast,rate,ivl,dev);
+    event_subscription(dev_name,attr_name,action,event,attr_name_lower,ZMQ,mcast,rate,ivl,dev);
 
 //
 // Check if the client is a new one
 //
 
-        bool new_client = ev->update_connected_client(get_client_ident());
-        if (new_client == true)
-            ev->set_double_send();
+    bool new_client = ev->update_connected_client(get_client_ident());
+    if (new_client == true)
+        ev->set_double_send();
 
 //
 // Create the event publisher socket (if not already done)
 // Take care for case where the device is running with db in a file
 //
 
-        string ev_name = ev->get_fqdn_prefix();
-        if (Util::_FileDb == true)
-        {
-            int size = ev_name.size();
-            if (ev_name[size - 1] == '#')
-                ev_name.erase(size - 1);
-        }
+    string ev_name = ev->get_fqdn_prefix();
+    if (Util::_FileDb == true)
+    {
+        int size = ev_name.size();
+        if (ev_name[size - 1] == '#')
+            ev_name.erase(size - 1);
+    }
 
-        ev_name = ev_name + dev->get_name_lower() + '/' + attr_name_lower;
-        if (Util::_FileDb == true && ev != NULL)
-            ev_name = ev_name + MODIFIER_DBASE_NO;
-        ev_name = ev_name + '.' +  event;
+    ev_name = ev_name + dev->get_name_lower() + '/' + attr_name_lower;
+    if (Util::_FileDb == true && ev != NULL)
+        ev_name = ev_name + MODIFIER_DBASE_NO;
+    ev_name = ev_name + '.' +  event;
 
 //
-// If the event is defined as using mcast transport, get caller host
+// Get caller host. Same host clients do not use multicast and may use IPC
+// No client identification for a call from within the process (event between
+// two devices of the same process)
 //
 
-        bool local_call = false;
-        if (mcast.empty() == false)
-        {
-            client_addr *c_addr = get_client_ident();
-            if ((c_addr->client_ip[5] == 'u') ||
-                ((c_addr->client_ip[9] == '1') && (c_addr->client_ip[10] == '2') && (c_addr->client_ip[11] == '7')))
-            {
-               local_call = true;
-            }
+    bool local_client = false;
+    client_addr *c_addr = get_client_ident();
+    if (c_addr != NULL)
+        local_client = ev->is_local_client(c_addr);
 
-        }
+    bool local_call = false;
+    if (mcast.empty() == false)
+        local_call = local_client;
 
 //
 // Create ZMQ event socket
 //
 
-        if (mcast.empty() == false)
-            ev->create_mcast_event_socket(mcast,ev_name,rate,local_call);
-        else
-            ev->create_event_socket();
+    if (mcast.empty() == false)
+        ev->create_mcast_event_socket(mcast,ev_name,rate,local_call);
+    else
+        ev->create_event_socket();
 
 //
 // Init event counter in Event Supplier
 //
 
-        ev->init_event_cptr(ev_name);
+    ev->init_event_cptr(ev_name);
 
 //
-// Init one subscription command flag in Eventsupplier
+// Multicast events are never batched
 //
 
-        if (ev->get_one_subscription_cmd() == false)
-            ev->set_one_subscription_cmd(true);
+    ev->set_event_batch_client(ev_name,batch_client && mcast.empty(),c_addr);
 
 //
-// Init data returned by command
+// Init one subscription command flag in Eventsupplier
 //
 
-        ret_data->lvalue.length(5);
-        ret_data->svalue.length(2);
+    if (ev->get_one_subscription_cmd() == false)
+        ev->set_one_subscription_cmd(true);
 
-        ret_data->lvalue[0] = (Tango::DevLong)tg->get_tango_lib_release();
-        ret_data->lvalue[1] = dev->get_dev_idl_version();
-        ret_data->lvalue[2] = zmq_sub_event_hwm;
-        ret_data->lvalue[3] = rate;
-        ret_data->lvalue[4] = ivl;
+//
+// Clients running on the same host get the IPC endpoint (when available)
+//
 
-        string &heartbeat_endpoint = ev->get_heartbeat_endpoint();
-        ret_data->svalue[0] = CORBA::string_dup(heartbeat_endpoint.c_str());
-        if (mcast.empty() == true)
-        {
-            string &event_endpoint = ev->get_event_endpoint();
-            ret_data->svalue[1] = CORBA::string_dup(event_endpoint.c_str());
-        }
+    if ((mcast.empty() == true) || (local_call == true))
+    {
+        string &ipc_endpoint = ev->get_ipc_event_endpoint();
+        if ((local_client == true) && (ipc_endpoint.empty() == false))
+            endpoint = ipc_endpoint;
         else
-        {
-            if (local_call == true)
-            {
-                string &event_endpoint = ev->get_event_endpoint();
-                ret_data->svalue[1] = CORBA::string_dup(event_endpoint.c_str());
-            }
-            else
-            {
-                string &event_endpoint = ev->get_mcast_event_endpoint(ev_name);
-                ret_data->svalue[1] = CORBA::string_dup(event_endpoint.c_str());
-            }
-        }
+            endpoint = ev->get_event_endpoint();
     }
-
-	return ret_data;
+    else
+        endpoint = ev->get_mcast_event_endpoint(ev_name);
 }
 
 }	// namespace
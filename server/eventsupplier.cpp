@@ -42,11 +42,20 @@ static const char *RcsId = "$Id$";
 #include <tango.h>
 #include <eventsupplier.h>
 
+//
+// SSE2 change detection kernels are used whenever the compiler targets SSE2.
+// Define TG_NO_SSE2 to disable them
+//
+
+#if !defined(TG_NO_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define TG_EVENT_USE_SSE2
+#include <emmintrin.h>
+#include <math.h>
+#endif
+
 namespace Tango {
 
-omni_mutex	EventSupplier::event_mutex;
 omni_mutex	EventSupplier::push_mutex;
-omni_mutex	EventSupplier::detect_mutex;
 string      EventSupplier::fqdn_prefix;
 
 //+----------------------------------------------------------------------------
@@ -191,10 +200,10 @@ bool EventSupplier::detect_and_push_change_event(DeviceImpl *device_impl,struct
         the_quality = attr_value.attr_val->quality;
 
 //
-// get the mutex to synchronize the sending of events
+// get the attribute mutex to synchronize the sending of events
 //
 
-    omni_mutex_lock l(event_mutex);
+    omni_mutex_lock l(attr.ext->event_mutex);
 
 //
 // if no attribute of this name is registered with change then
@@ -388,10 +397,10 @@ bool EventSupplier::detect_and_push_archive_event(DeviceImpl *device_impl,Attrib
 	}
 
 //
-// get the mutex to synchronize the sending of events
+// get the attribute mutex to synchronize the sending of events
 //
 
-	omni_mutex_lock l(event_mutex);
+	omni_mutex_lock l(attr.ext->event_mutex);
 
 //
 // Do not get time now. This method is executed after the attribute has been read.
@@ -651,10 +660,10 @@ bool EventSupplier::detect_and_push_periodic_event(DeviceImpl *device_impl,struc
 		now_ms = (double)now.tv_sec * 1000. + (double)now.tv_usec / 1000.;
 
 //
-// get the mutex to synchronize the sending of events
+// get the attribute mutex to synchronize the sending of events
 //
 
-	omni_mutex_lock l(event_mutex);
+	omni_mutex_lock l(attr.ext->event_mutex);
 
 //
 // get the event period
@@ -753,6 +762,357 @@ bool EventSupplier::detect_and_push_periodic_event(DeviceImpl *device_impl,struc
 }
 
 
+//+----------------------------------------------------------------------------
+//
+// function : 		abs_change_in_block()
+//
+// description : 	Pre-check a block of a numeric data sequence against the
+//			        absolute change criterions. It returns false only if no
+//			        element of the block fulfills them, so the caller can
+//			        skip the block. The generic version always returns true
+//			        and the block is analysed element by element.
+//			        SSE2 versions exist for the types used in images
+//			        (DevUChar, DevShort, DevUShort) and for DevFloat and
+//			        DevDouble. They compute the deltas exactly like the
+//			        scalar code (integer deltas or rounding correction for
+//			        floating point data)
+//
+// argument : in :	curr : The current data
+//			        prev : The previous data
+//			        nb : The block data number
+//			        abs_change : The absolute change criterions
+//
+//-----------------------------------------------------------------------------
+
+template <typename T>
+static inline bool abs_change_in_block(const T *,const T *,unsigned int,double *)
+{
+	return true;
+}
+
+#ifdef TG_EVENT_USE_SSE2
+
+//
+// Integer data: the deltas are integer, delta <= abs_change[0] is therefore
+// delta < floor(abs_change[0]) + 1 and delta >= abs_change[1] is
+// delta > ceil(abs_change[1]) - 1. The limits are clamped to a range a
+// little larger than the delta range
+//
+
+static inline void int_change_limits(double *abs_change,double max_delta,int &low,int &high)
+{
+	double lo = ::floor(abs_change[0]);
+	double hi = ::ceil(abs_change[1]);
+	double clamp = max_delta + 10.0;
+
+	if (lo < -clamp) lo = -clamp;
+	if (lo > clamp) lo = clamp;
+	if (hi < -clamp) hi = -clamp;
+	if (hi > clamp) hi = clamp;
+
+	low = (int)lo + 1;
+	high = (int)hi - 1;
+}
+
+static inline bool int_change_in_tail(int delta,int low,int high)
+{
+	return (delta < low) || (delta > high);
+}
+
+static inline bool abs_change_in_block(const DevUChar *curr,const DevUChar *prev,unsigned int nb,double *abs_change)
+{
+	int low,high;
+	int_change_limits(abs_change,255.0,low,high);
+
+	const __m128i v_low = _mm_set1_epi16((short)low);
+	const __m128i v_high = _mm_set1_epi16((short)high);
+	const __m128i zero = _mm_setzero_si128();
+	__m128i found = zero;
+
+	unsigned int i = 0;
+	for (;i + 16 <= nb;i = i + 16)
+	{
+		__m128i c = _mm_loadu_si128((const __m128i *)&curr[i]);
+		__m128i p = _mm_loadu_si128((const __m128i *)&prev[i]);
+		__m128i d_lo = _mm_sub_epi16(_mm_unpacklo_epi8(c,zero),_mm_unpacklo_epi8(p,zero));
+		__m128i d_hi = _mm_sub_epi16(_mm_unpackhi_epi8(c,zero),_mm_unpackhi_epi8(p,zero));
+		found = _mm_or_si128(found,_mm_or_si128(_mm_cmpgt_epi16(v_low,d_lo),_mm_cmpgt_epi16(d_lo,v_high)));
+		found = _mm_or_si128(found,_mm_or_si128(_mm_cmpgt_epi16(v_low,d_hi),_mm_cmpgt_epi16(d_hi,v_high)));
+	}
+
+	if (_mm_movemask_epi8(found) != 0)
+		return true;
+
+	for (;i < nb;i++)
+	{
+		if (int_change_in_tail(curr[i] - prev[i],low,high) == true)
+			return true;
+	}
+	return false;
+}
+
+static inline bool abs_change_in_block(const DevShort *curr,const DevShort *prev,unsigned int nb,double *abs_change)
+{
+	int low,high;
+	int_change_limits(abs_change,65535.0,low,high);
+
+	const __m128i v_low = _mm_set1_epi32(low);
+	const __m128i v_high = _mm_set1_epi32(high);
+	__m128i found = _mm_setzero_si128();
+
+	unsigned int i = 0;
+	for (;i + 8 <= nb;i = i + 8)
+	{
+		__m128i c = _mm_loadu_si128((const __m128i *)&curr[i]);
+		__m128i p = _mm_loadu_si128((const __m128i *)&prev[i]);
+		__m128i d_lo = _mm_sub_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(c,c),16),_mm_srai_epi32(_mm_unpacklo_epi16(p,p),16));
+		__m128i d_hi = _mm_sub_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(c,c),16),_mm_srai_epi32(_mm_unpackhi_epi16(p,p),16));
+		found = _mm_or_si128(found,_mm_or_si128(_mm_cmpgt_epi32(v_low,d_lo),_mm_cmpgt_epi32(d_lo,v_high)));
+		found = _mm_or_si128(found,_mm_or_si128(_mm_cmpgt_epi32(v_low,d_hi),_mm_cmpgt_epi32(d_hi,v_high)));
+	}
+
+	if (_mm_movemask_epi8(found) != 0)
+		return true;
+
+	for (;i < nb;i++)
+	{
+		if (int_change_in_tail(curr[i] - prev[i],low,high) == true)
+			return true;
+	}
+	return false;
+}
+
+static inline bool abs_change_in_block(const DevUShort *curr,const DevUShort *prev,unsigned int nb,double *abs_change)
+{
+	int low,high;
+	int_change_limits(abs_change,65535.0,low,high);
+
+	const __m128i v_low = _mm_set1_epi32(low);
+	const __m128i v_high = _mm_set1_epi32(high);
+	const __m128i zero = _mm_setzero_si128();
+	__m128i found = zero;
+
+	unsigned int i = 0;
+	for (;i + 8 <= nb;i = i + 8)
+	{
+		__m128i c = _mm_loadu_si128((const __m128i *)&curr[i]);
+		__m128i p = _mm_loadu_si128((const __m128i *)&prev[i]);
+		__m128i d_lo = _mm_sub_epi32(_mm_unpacklo_epi16(c,zero),_mm_unpacklo_epi16(p,zero));
+		__m128i d_hi = _mm_sub_epi32(_mm_unpackhi_epi16(c,zero),_mm_unpackhi_epi16(p,zero));
+		found = _mm_or_si128(found,_mm_or_si128(_mm_cmpgt_epi32(v_low,d_lo),_mm_cmpgt_epi32(d_lo,v_high)));
+		found = _mm_or_si128(found,_mm_or_si128(_mm_cmpgt_epi32(v_low,d_hi),_mm_cmpgt_epi32(d_hi,v_high)));
+	}
+
+	if (_mm_movemask_epi8(found) != 0)
+		return true;
+
+	for (;i < nb;i++)
+	{
+		if (int_change_in_tail(curr[i] - prev[i],low,high) == true)
+			return true;
+	}
+	return false;
+}
+
+//
+// Floating point data: same computation as the scalar code, i.e. the delta
+// (computed in the data type) plus the rounding correction compared in double
+//
+
+static inline bool fp_change_in_tail(double delta,double *abs_change)
+{
+	double max_change = delta + (abs_change[1] * 1e-10);
+	double min_change = delta + (abs_change[0] * 1e-10);
+	return (min_change <= abs_change[0]) || (max_change >= abs_change[1]);
+}
+
+static inline __m128d fp_change_mask(__m128d delta,__m128d v_low,__m128d v_high,__m128d corr_low,__m128d corr_high)
+{
+	return _mm_or_pd(_mm_cmple_pd(_mm_add_pd(delta,corr_low),v_low),_mm_cmpge_pd(_mm_add_pd(delta,corr_high),v_high));
+}
+
+static inline bool abs_change_in_block(const DevDouble *curr,const DevDouble *prev,unsigned int nb,double *abs_change)
+{
+	const __m128d v_low = _mm_set1_pd(abs_change[0]);
+	const __m128d v_high = _mm_set1_pd(abs_change[1]);
+	const __m128d corr_low = _mm_set1_pd(abs_change[0] * 1e-10);
+	const __m128d corr_high = _mm_set1_pd(abs_change[1] * 1e-10);
+	__m128d found = _mm_setzero_pd();
+
+	unsigned int i = 0;
+	for (;i + 2 <= nb;i = i + 2)
+	{
+		__m128d delta = _mm_sub_pd(_mm_loadu_pd(&curr[i]),_mm_loadu_pd(&prev[i]));
+		found = _mm_or_pd(found,fp_change_mask(delta,v_low,v_high,corr_low,corr_high));
+	}
+
+	if (_mm_movemask_pd(found) != 0)
+		return true;
+
+	for (;i < nb;i++)
+	{
+		if (fp_change_in_tail(curr[i] - prev[i],abs_change) == true)
+			return true;
+	}
+	return false;
+}
+
+static inline bool abs_change_in_block(const DevFloat *curr,const DevFloat *prev,unsigned int nb,double *abs_change)
+{
+	const __m128d v_low = _mm_set1_pd(abs_change[0]);
+	const __m128d v_high = _mm_set1_pd(abs_change[1]);
+	const __m128d corr_low = _mm_set1_pd(abs_change[0] * 1e-10);
+	const __m128d corr_high = _mm_set1_pd(abs_change[1] * 1e-10);
+	__m128d found = _mm_setzero_pd();
+
+	unsigned int i = 0;
+	for (;i + 4 <= nb;i = i + 4)
+	{
+		__m128 delta = _mm_sub_ps(_mm_loadu_ps(&curr[i]),_mm_loadu_ps(&prev[i]));
+		found = _mm_or_pd(found,fp_change_mask(_mm_cvtps_pd(delta),v_low,v_high,corr_low,corr_high));
+		found = _mm_or_pd(found,fp_change_mask(_mm_cvtps_pd(_mm_movehl_ps(delta,delta)),v_low,v_high,corr_low,corr_high));
+	}
+
+	if (_mm_movemask_pd(found) != 0)
+		return true;
+
+	for (;i < nb;i++)
+	{
+		DevFloat delta = curr[i] - prev[i];
+		if (fp_change_in_tail((double)delta,abs_change) == true)
+			return true;
+	}
+	return false;
+}
+
+#endif /* TG_EVENT_USE_SSE2 */
+
+//+----------------------------------------------------------------------------
+//
+// method : 		EventSupplier::detect_seq_change()
+//
+// description : 	Check a numeric attribute data sequence against the
+//			        relative and absolute change criterions. Returns true
+//			        on the first element fulfilling one of them.
+//			        When a null delta cannot fire an event, the two
+//			        sequences are compared by blocks with memcmp (which is
+//			        vectorized by the C library). With only an absolute
+//			        criterion, the blocks with different data are then
+//			        checked with abs_change_in_block(). Only the blocks
+//			        which may fire an event are analysed element by element.
+//
+// argument : in :	curr : The current data
+//			        prev : The previous data
+//			        nb : The data number (same for both sequences)
+//			        rel_change : The relative change criterions
+//			        abs_change : The absolute change criterions
+//			        fp : Flag set to true for floating point data
+//			   out :	delta_change_rel : The last computed relative delta
+//			        delta_change_abs : The last computed absolute delta
+//
+//-----------------------------------------------------------------------------
+
+template <typename T>
+bool EventSupplier::detect_seq_change(const T *curr,const T *prev,unsigned int nb,double *rel_change,double *abs_change,
+									  double &delta_change_rel,double &delta_change_abs,bool fp)
+{
+	bool rel_check = rel_change[0] != INT_MAX;
+	bool abs_check = abs_change[0] != INT_MAX;
+
+	if ((rel_check == false) && (abs_check == false))
+		return false;
+
+//
+// Equal elements can be skipped only if a null delta does not fulfill the criterions
+//
+
+	bool skip_equal = true;
+	if ((rel_check == true) && ((rel_change[0] >= 0) || (rel_change[1] <= 0)))
+		skip_equal = false;
+	if ((abs_check == true) && ((abs_change[0] >= 0) || (abs_change[1] <= 0)))
+		skip_equal = false;
+
+	unsigned int blk_nb = EVENT_CMP_BLOCK_SIZE / sizeof(T);
+	if (blk_nb == 0)
+		blk_nb = 1;
+	bool last_skipped = false;
+
+	for (unsigned int i = 0;i < nb;i = i + blk_nb)
+	{
+		unsigned int blk_end = i + blk_nb;
+		if (blk_end > nb)
+			blk_end = nb;
+
+		if ((skip_equal == true) && (::memcmp(&curr[i],&prev[i],(blk_end - i) * sizeof(T)) == 0))
+		{
+			last_skipped = true;
+			continue;
+		}
+		last_skipped = false;
+
+//
+// If the block cannot fire an event, only its last element is analysed to
+// compute the returned deltas
+//
+
+		unsigned int blk_start = i;
+		if ((rel_check == false) && (abs_change_in_block(&curr[i],&prev[i],blk_end - i,abs_change) == false))
+			blk_start = blk_end - 1;
+
+		for (unsigned int j = blk_start;j < blk_end;j++)
+		{
+			if (rel_check == true)
+			{
+				if (prev[j] != 0)
+				{
+					delta_change_rel = (double)((curr[j] - prev[j])*100/prev[j]);
+				}
+				else
+				{
+					delta_change_rel = 100;
+					if (curr[j] == prev[j]) delta_change_rel = 0;
+				}
+
+				if (delta_change_rel <= rel_change[0] || delta_change_rel >= rel_change[1])
+					return true;
+			}
+			if (abs_check == true)
+			{
+				delta_change_abs = (double)(curr[j] - prev[j]);
+				if (fp == true)
+				{
+
+// Correct for rounding errors !
+
+					double max_change = delta_change_abs + (abs_change[1] * 1e-10);
+					double min_change = delta_change_abs + (abs_change[0] * 1e-10);
+					if (min_change <= abs_change[0] || max_change >= abs_change[1])
+						return true;
+				}
+				else
+				{
+					if (delta_change_abs <= abs_change[0] || delta_change_abs >= abs_change[1])
+						return true;
+				}
+			}
+		}
+	}
+
+//
+// If the last block has been skipped, the last element deltas are null
+//
+
+	if (last_skipped == true)
+	{
+		if (rel_check == true)
+			delta_change_rel = 0;
+		if (abs_check == true)
+			delta_change_abs = 0;
+	}
+
+	return false;
+}
+
 //+----------------------------------------------------------------------------
 //
 // method : 		EventSupplier::detect_change()
@@ -774,6 +1134,8 @@ bool EventSupplier::detect_and_push_periodic_event(DeviceImpl *device_impl,struc
 //					        classic...)
 //			        dev : Pointer to the device
 //
+// The caller must hold the attribute event mutex
+//
 //-----------------------------------------------------------------------------
 
 bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_value,bool archive,
@@ -800,12 +1162,6 @@ bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_val
         the_new_any = &(attr_value.attr_val->value);
     }
 
-//
-// get the mutex to synchronize the sending of events
-//
-
-    omni_mutex_lock l(detect_mutex);
-
 //
 // Send event, if the read_attribute failed or if it is the first time
 // that the read_attribute succeed after a failure.
@@ -1032,39 +1388,9 @@ bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_val
                     return(is_change);
                 }
 
-                if ((rel_change[0] != INT_MAX) || (rel_change[1] != INT_MAX) || (abs_change[0] != INT_MAX) || (abs_change[1] != INT_MAX))
-                {
-                    for (i=0; i< curr_seq_nb; i++)
-                    {
-                        if (rel_change[0] != INT_MAX)
-                        {
-                            if ((*prev_data_ptr)[i] != 0)
-                            {
-                                delta_change_rel = ((*curr_data_ptr)[i] - (*prev_data_ptr)[i])*100/(*prev_data_ptr)[i];
-                            }
-                            else
-                            {
-                                delta_change_rel = 100;
-                                if ((*curr_data_ptr)[i] == (*prev_data_ptr)[i])
-                                    delta_change_rel = 0;
-                            }
-                            if (delta_change_rel <= rel_change[0] || delta_change_rel >= rel_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                        if (abs_change[0] != INT_MAX)
-                        {
-                            delta_change_abs = (*curr_data_ptr)[i] - (*prev_data_ptr)[i];
-                            if (delta_change_abs <= abs_change[0] || delta_change_abs >= abs_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                    }
-                }
+                is_change = detect_seq_change(curr_data_ptr->get_buffer(),prev_data_ptr->get_buffer(),curr_seq_nb,
+                                              rel_change,abs_change,delta_change_rel,delta_change_abs,false);
+                return(is_change);
             }
 
 //
@@ -1147,37 +1473,9 @@ bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_val
                         force_change = true;
                         return true;
                     }
-                    for (i=0; i<curr_seq_lo->length(); i++)
-                    {
-                        if (rel_change[0] != INT_MAX)
-                        {
-                            if ((*prev_seq_lo)[i] != 0)
-                            {
-                                delta_change_rel = ((*curr_seq_lo)[i] - (*prev_seq_lo)[i])*100/(*prev_seq_lo)[i];
-                            }
-                            else
-                            {
-                                delta_change_rel = 100;
-                                if ((*curr_seq_lo)[i] == (*prev_seq_lo)[i]) delta_change_rel = 0;
-                            }
-
-                            if (delta_change_rel <= rel_change[0] || delta_change_rel >= rel_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                        if (abs_change[0] != INT_MAX)
-                        {
-                            delta_change_abs = (*curr_seq_lo)[i] - (*prev_seq_lo)[i];
-                            if (delta_change_abs <= abs_change[0] || delta_change_abs >= abs_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                    }
-                    return false;
+                    is_change = detect_seq_change(curr_seq_lo->get_buffer(),prev_seq_lo->get_buffer(),curr_seq_nb,
+                                                  rel_change,abs_change,delta_change_rel,delta_change_abs,false);
+                    return(is_change);
                 }
 
 //
@@ -1214,36 +1512,9 @@ bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_val
                         force_change = true;
                         return true;
                     }
-                    for (i=0; i<curr_seq_64->length(); i++)
-                    {
-                        if (rel_change[0] != INT_MAX)
-                        {
-                            if ((*prev_seq_64)[i] != 0)
-                            {
-                                delta_change_rel = (double)(((*curr_seq_64)[i] - (*prev_seq_64)[i])*100/(*prev_seq_64)[i]);
-                            }
-                            else
-                            {
-                                delta_change_rel = 100;
-                                if ((*curr_seq_64)[i] == (*prev_seq_64)[i]) delta_change_rel = 0;
-                            }
-                            if (delta_change_rel <= rel_change[0] || delta_change_rel >= rel_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                        if (abs_change[0] != INT_MAX)
-                        {
-                            delta_change_abs = (double)((*curr_seq_64)[i] - (*prev_seq_64)[i]);
-                            if (delta_change_abs <= abs_change[0] || delta_change_abs >= abs_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                    }
-                    return false;
+                    is_change = detect_seq_change(curr_seq_64->get_buffer(),prev_seq_64->get_buffer(),curr_seq_nb,
+                                                  rel_change,abs_change,delta_change_rel,delta_change_abs,false);
+                    return(is_change);
                 }
 
 //
@@ -1280,36 +1551,9 @@ bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_val
                         force_change = true;
                         return true;
                     }
-                    for (i=0; i<curr_seq_sh->length(); i++)
-                    {
-                        if (rel_change[0] != INT_MAX)
-                        {
-                            if ((*prev_seq_sh)[i] != 0)
-                            {
-                                delta_change_rel = ((*curr_seq_sh)[i] - (*prev_seq_sh)[i])*100/(*prev_seq_sh)[i];
-                            }
-                            else
-                            {
-                                delta_change_rel = 100;
-                                if ((*curr_seq_sh)[i] == (*prev_seq_sh)[i]) delta_change_rel = 0;
-                            }
-                            if (delta_change_rel <= rel_change[0] || delta_change_rel >= rel_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                        if (abs_change[0] != INT_MAX)
-                        {
-                            delta_change_abs = (*curr_seq_sh)[i] - (*prev_seq_sh)[i];
-                            if (delta_change_abs <= abs_change[0] || delta_change_abs >= abs_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                    }
-                    return false;
+                    is_change = detect_seq_change(curr_seq_sh->get_buffer(),prev_seq_sh->get_buffer(),curr_seq_nb,
+                                                  rel_change,abs_change,delta_change_rel,delta_change_abs,false);
+                    return(is_change);
                 }
 
 //
@@ -1346,43 +1590,9 @@ bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_val
                         force_change = true;
                         return true;
                     }
-                    for (i=0; i<curr_seq_db->length(); i++)
-                    {
-                        if (rel_change[0] != INT_MAX)
-                        {
-                            if ((*prev_seq_db)[i] != 0)
-                            {
-                                delta_change_rel = ((*curr_seq_db)[i] - (*prev_seq_db)[i])*100/(*prev_seq_db)[i];
-                            }
-                            else
-                            {
-                                delta_change_rel = 100;
-                                if ((*curr_seq_db)[i] == (*prev_seq_db)[i]) delta_change_rel = 0;
-                            }
-
-                            if (delta_change_rel <= rel_change[0] || delta_change_rel >= rel_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                        if (abs_change[0] != INT_MAX)
-                        {
-                            delta_change_abs = (*curr_seq_db)[i] - (*prev_seq_db)[i];
-
-                            // Correct for rounding errors !
-                            double max_change = delta_change_abs + (abs_change[1] * 1e-10);
-                            double min_change = delta_change_abs + (abs_change[0] * 1e-10);
-
-                            //if (delta_change_abs <= abs_change[0] || delta_change_abs >= abs_change[1])
-                            if (min_change <= abs_change[0] || max_change >= abs_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                    }
-                    return false;
+                    is_change = detect_seq_change(curr_seq_db->get_buffer(),prev_seq_db->get_buffer(),curr_seq_nb,
+                                                  rel_change,abs_change,delta_change_rel,delta_change_abs,true);
+                    return(is_change);
                 }
 
 //
@@ -1466,42 +1676,9 @@ bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_val
                         return true;
                     }
 
-                    for (i=0; i<curr_seq_fl->length(); i++)
-                    {
-                        if (rel_change[0] != INT_MAX)
-                        {
-                            if ((*prev_seq_fl)[i] != 0)
-                            {
-                                delta_change_rel = ((*curr_seq_fl)[i] - (*prev_seq_fl)[i])*100/(*prev_seq_fl)[i];
-                            }
-                            else
-                            {
-                                delta_change_rel = 100;
-                                if ((*curr_seq_fl)[i] == (*prev_seq_fl)[i]) delta_change_rel = 0;
-                            }
-                            if (delta_change_rel <= rel_change[0] || delta_change_rel >= rel_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                        if (abs_change[0] != INT_MAX)
-                        {
-                            delta_change_abs = (*curr_seq_fl)[i] - (*prev_seq_fl)[i];
-
-                            // Correct for rounding errors !
-                            double max_change = delta_change_abs + (abs_change[1] * 1e-10);
-                            double min_change = delta_change_abs + (abs_change[0] * 1e-10);
-
-                            //if (delta_change_abs <= abs_change[0] || delta_change_abs >= abs_change[1])
-                            if (min_change <= abs_change[0] || max_change >= abs_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                    }
-                    return false;
+                    is_change = detect_seq_change(curr_seq_fl->get_buffer(),prev_seq_fl->get_buffer(),curr_seq_nb,
+                                                  rel_change,abs_change,delta_change_rel,delta_change_abs,true);
+                    return(is_change);
                 }
 
 //
@@ -1538,36 +1715,9 @@ bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_val
                         force_change = true;
                         return true;
                     }
-                    for (i=0; i<curr_seq_ush->length(); i++)
-                    {
-                        if (rel_change[0] != INT_MAX)
-                        {
-                            if ((*prev_seq_ush)[i] != 0)
-                            {
-                                delta_change_rel = ((*curr_seq_ush)[i] - (*prev_seq_ush)[i])*100/(*prev_seq_ush)[i];
-                            }
-                            else
-                            {
-                                delta_change_rel = 100;
-                                if ((*curr_seq_ush)[i] == (*prev_seq_ush)[i]) delta_change_rel = 0;
-                            }
-                            if (delta_change_rel <= rel_change[0] || delta_change_rel >= rel_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                        if (abs_change[0] != INT_MAX)
-                        {
-                            delta_change_abs = (*curr_seq_ush)[i] - (*prev_seq_ush)[i];
-                            if (delta_change_abs <= abs_change[0] || delta_change_abs >= abs_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                    }
-                    return false;
+                    is_change = detect_seq_change(curr_seq_ush->get_buffer(),prev_seq_ush->get_buffer(),curr_seq_nb,
+                                                  rel_change,abs_change,delta_change_rel,delta_change_abs,false);
+                    return(is_change);
                 }
 
 //
@@ -1650,36 +1800,9 @@ bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_val
                         force_change = true;
                         return true;
                     }
-                    for (i=0; i<curr_seq_uch->length(); i++)
-                    {
-                        if (rel_change[0] != INT_MAX)
-                        {
-                            if ((*prev_seq_uch)[i] != 0)
-                            {
-                                delta_change_rel = ((*curr_seq_uch)[i] - (*prev_seq_uch)[i])*100/(*prev_seq_uch)[i];
-                            }
-                            else
-                            {
-                                delta_change_rel = 100;
-                                if ((*curr_seq_uch)[i] == (*prev_seq_uch)[i]) delta_change_rel = 0;
-                            }
-                            if (delta_change_rel <= rel_change[0] || delta_change_rel >= rel_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                        if (abs_change[0] != INT_MAX)
-                        {
-                            delta_change_abs = (*curr_seq_uch)[i] - (*prev_seq_uch)[i];
-                            if (delta_change_abs <= abs_change[0] || delta_change_abs >= abs_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                    }
-                    return false;
+                    is_change = detect_seq_change(curr_seq_uch->get_buffer(),prev_seq_uch->get_buffer(),curr_seq_nb,
+                                                  rel_change,abs_change,delta_change_rel,delta_change_abs,false);
+                    return(is_change);
                 }
 
 //
@@ -1716,36 +1839,9 @@ bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_val
                         force_change = true;
                         return true;
                     }
-                    for (i=0; i<curr_seq_ulo->length(); i++)
-                    {
-                        if (rel_change[0] != INT_MAX)
-                        {
-                            if ((*prev_seq_ulo)[i] != 0)
-                            {
-                                delta_change_rel = ((*curr_seq_ulo)[i] - (*prev_seq_ulo)[i])*100/(*prev_seq_ulo)[i];
-                            }
-                            else
-                            {
-                                delta_change_rel = 100;
-                                if ((*curr_seq_ulo)[i] == (*prev_seq_ulo)[i]) delta_change_rel = 0;
-                            }
-                            if (delta_change_rel <= rel_change[0] || delta_change_rel >= rel_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                        if (abs_change[0] != INT_MAX)
-                        {
-                            delta_change_abs = (*curr_seq_ulo)[i] - (*prev_seq_ulo)[i];
-                            if (delta_change_abs <= abs_change[0] || delta_change_abs >= abs_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                    }
-                    return false;
+                    is_change = detect_seq_change(curr_seq_ulo->get_buffer(),prev_seq_ulo->get_buffer(),curr_seq_nb,
+                                                  rel_change,abs_change,delta_change_rel,delta_change_abs,false);
+                    return(is_change);
                 }
 
 //
@@ -1783,36 +1879,9 @@ bool EventSupplier::detect_change(Attribute &attr,struct AttributeData &attr_val
                         force_change = true;
                         return true;
                     }
-                    for (i=0; i<curr_seq_u64->length(); i++)
-                    {
-                        if (rel_change[0] != INT_MAX)
-                        {
-                            if ((*prev_seq_u64)[i] != 0)
-                            {
-                                delta_change_rel = (double)(((*curr_seq_u64)[i] - (*prev_seq_u64)[i])*100/(*prev_seq_u64)[i]);
-                            }
-                            else
-                            {
-                                delta_change_rel = 100;
-                                if ((*curr_seq_u64)[i] == (*prev_seq_u64)[i]) delta_change_rel = 0;
-                            }
-                            if (delta_change_rel <= rel_change[0] || delta_change_rel >= rel_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                        if (abs_change[0] != INT_MAX)
-                        {
-                            delta_change_abs = (double)((*curr_seq_u64)[i] - (*prev_seq_u64)[i]);
-                            if (delta_change_abs <= abs_change[0] || delta_change_abs >= abs_change[1])
-                            {
-                                is_change = true;
-                                return(is_change);
-                            }
-                        }
-                    }
-                    return false;
+                    is_change = detect_seq_change(curr_seq_u64->get_buffer(),prev_seq_u64->get_buffer(),curr_seq_nb,
+                                                  rel_change,abs_change,delta_change_rel,delta_change_abs,false);
+                    return(is_change);
                 }
 
 //
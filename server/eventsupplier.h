@@ -66,6 +66,7 @@
 #include <sys/time.h>
 #endif
 #include <math.h>
+#include <set>
 
 
 namespace Tango
@@ -145,24 +146,23 @@ protected :
 		return ((after.tv_sec-before.tv_sec)*1000000 + after.tv_usec - before.tv_usec);
 	}
 
+	template <typename T>
+	bool detect_seq_change(const T *,const T *,unsigned int,double *,double *,double &,double &,bool);
+
 	static string 		    fqdn_prefix;
 
-	// Added a mutex to synchronize the access to
-	//	detect_and_push_change_event	and
-	// detect_and_push_archive_event which are used
-	// from different threads
-	static omni_mutex		event_mutex;
+	// The previous event values used by
+	// detect_and_push_change_event, detect_and_push_archive_event,
+	// detect_and_push_periodic_event and detect_change are protected
+	// by a per attribute mutex (the attribute ext event_mutex) in
+	// order not to serialize threads pushing events for different
+	// attributes
 
 	// Added a mutex to synchronize the access to
 	//	push_event which is used
 	// from different threads
 	static omni_mutex		push_mutex;
 
-	// Added a mutex to synchronize the access to
-	//	detect_event which is used
-	// from different threads
-	static omni_mutex		detect_mutex;
-
 private:
 	bool        one_subscription_cmd;
 };
@@ -228,6 +228,7 @@ private :
 
 #define     LARGE_DATA_THRESHOLD    2048
 #define     LARGE_DATA_THRESHOLD_ENCODED   LARGE_DATA_THRESHOLD * 4
+#define     DATA_BUFFER_POOL_SIZE   8
 
 #ifndef HAS_LAMBDA_FUNC
 template <typename A1,typename A2,typename R>
@@ -254,6 +255,19 @@ struct OldClient : public binary_function<A1,A2,R>
 };
 #endif
 
+class ZmqEventSupplier;
+
+class ZmqEventBatchThread: public omni_thread
+{
+public:
+	ZmqEventBatchThread(ZmqEventSupplier *ev):supplier(ev) {start_undetached();}
+
+	void *run_undetached(void *);
+
+private:
+	ZmqEventSupplier			*supplier;
+};
+
 class ZmqEventSupplier : public EventSupplier
 {
 public :
@@ -267,6 +281,7 @@ public :
 
 	string &get_heartbeat_endpoint() {return heartbeat_endpoint;}
 	string &get_event_endpoint() {return event_endpoint;}
+	string &get_ipc_event_endpoint() {return ipc_event_endpoint;}
 
     void create_event_socket();
     void create_mcast_event_socket(string &,string &,int,bool);
@@ -275,8 +290,17 @@ public :
     void init_event_cptr(string &event_name);
 
     bool update_connected_client(client_addr *);
+    bool is_local_client(client_addr *);
     void set_double_send() {double_send=true;double_send_heartbeat=true;}
 
+    static TangoCdrMemoryStream *get_data_buffer();
+    static void release_data_buffer(TangoCdrMemoryStream *);
+
+    bool is_event_batching() {return batch_window != 0;}
+    string get_batch_event_name(client_addr *);
+    void set_event_batch_client(string &,bool,client_addr *);
+    void batch_loop();
+
 protected :
 	ZmqEventSupplier(Util *);
 
@@ -306,7 +330,6 @@ private :
 	string                      heartbeat_event_name;   // The event name used for the heartbeat
 	ZmqCallInfo                 heartbeat_call;         // The heartbeat call info
     cdrMemoryStream             heartbeat_call_cdr;     //
-    TangoCdrMemoryStream        data_call_cdr;
     string                      event_name;
 
     zmq::message_t              endian_mess;            // Zmq message for host endianness
@@ -321,6 +344,9 @@ private :
 	string                      user_ip;                // The specified IP address
 
 	string                      event_endpoint;         // event publisher endpoint
+	string                      ipc_event_endpoint;     // event publisher endpoint for same host clients
+	string                      ipc_dir;                // Private directory of the IPC endpoint
+	bool                        ipc_enabled;            // Use IPC transport for same host clients
 
 	map<string,unsigned int>    event_cptr;             // event counter map
 
@@ -328,7 +354,26 @@ private :
 	bool                        double_send;            // Double send flag
 	bool                        double_send_heartbeat;
 
+	int                         batch_window;           // Event batch window (uS). 0 if no batching
+	int                         batch_max;              // Max event number in one batch
+	string                      batch_name_prefix;      // The batch event names prefix (admin device name)
+	map<string,vector<zmq::message_t *> > batch_mess;   // Batched messages per batch event name (name, call info and data per event)
+	unsigned long               batch_abs_sec;          // Batch sending date (absolute time)
+	unsigned long               batch_abs_nsec;         //
+	map<string,map<string,time_t> > batched_events;     // Events subscribed by batch clients (batch event name -> last subscription date)
+	map<string,time_t>          unbatched_events;       // Events subscribed by clients not supporting batch (last subscription date)
+	omni_condition              batch_cond;             // To wake up the batch thread
+	ZmqEventBatchThread         *batch_th;              // The batch thread
+	bool                        batch_th_exit;          // Batch thread exit flag
+
+	static omni_mutex                   data_pool_mutex;    // Protect the data buffer pool
+	static vector<TangoCdrMemoryStream *> data_pool;        // Free event data marshalling buffers
+
 	void tango_bind(zmq::socket_t *,string &);
+	void add_to_batch(vector<string> &,zmq::message_t &,zmq::message_t &,zmq::message_t &);
+	void send_batch();
+	void send_batch(const string &);
+	bool is_batched_event(string &,vector<string> &);
 	unsigned char test_endian();
     void create_mcast_socket(string &,int,McastSocketPub &);
 };
@@ -108,6 +108,22 @@ void OutputBitStream::init() {
 void OutputBitStream::flush() {
 
   align();
+  flush_mm();
+
+}
+
+// ----------------------------------------------------------------
+// Byte align the stream without adding a padding byte when it is
+// already aligned (needed before a restart marker)
+
+void OutputBitStream::pad() {
+
+  if( nbBits&7 ) align();
+  flush_mm();
+
+}
+
+void OutputBitStream::flush_mm() {
 
 #ifdef JPG_USE_ASM_PB
 
@@ -258,6 +274,33 @@ void OutputBitStream::put_short(unsigned short code) {
 
 }
 
+// ----------------------------------------------------------------
+void OutputBitStream::put_bytes(unsigned char *data,unsigned long size) {
+
+  if( nbByte+size > (unsigned long)buffSize ) {
+    buffSize = nbByte + size + BUFFER_SIZE;
+    unsigned char *newBuffer = (unsigned char *)malloc(buffSize);
+    memcpy(newBuffer,buffer,nbByte);
+    free(buffer);
+    buffer = newBuffer;
+  }
+  memcpy(buffer+nbByte,data,size);
+  nbByte += size;
+  bufferPtr = buffer + nbByte;
+
+}
+
+// ----------------------------------------------------------------
+// Restart marker RSTn (n modulo 8)
+void OutputBitStream::put_restart(int n) {
+
+  pad();
+  put_byte(0xFF);
+  put_byte(M_RST0 + (n&7));
+  init();
+
+}
+
 // ----------------------------------------------------------------
 unsigned char *OutputBitStream::get_data() {
   return buffer;
@@ -57,6 +57,7 @@ class OutputBitStream {
 
     void align();
     void flush();
+    void pad();
     void init();
 
     unsigned char *get_data();
@@ -66,12 +67,15 @@ class OutputBitStream {
     void put_byte(unsigned char code);
     void put_byteI(unsigned char code);
     void put_short(unsigned short code);
+    void put_bytes(unsigned char *data,unsigned long size);
+    void put_restart(int n);
     void encode_block(short *block,HUFFMANTABLE *hDC,HUFFMANTABLE *hAC,short *lastDc);
 
  private:
 
    void more_byte();
    void load_mm();
+   void flush_mm();
 
    unsigned char *buffer;
    int            nbByte;
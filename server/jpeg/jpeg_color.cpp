@@ -53,6 +53,7 @@
 
 #include "jpeg_memory.h"
 #include "jpeg_lib.h"
+#include "jpeg_const.h"
 #include <string.h>
 
 #define TRUNC(i)  ((i) & 0xFFFFFF00)?(unsigned char)(((~(i)) >> 31) & 0xFF):(unsigned char)(i)
@@ -224,6 +225,159 @@ extern void conv_block_RGB24H2V2_mmx(long width,unsigned char *rgb,short *y,shor
 extern void conv_block_GRAY8Y_mmx(long width,unsigned char *g,short *y);
 #endif
 
+#ifdef JPG_USE_SSE2
+
+// --------------------------------------------------------------------------------------
+// SSE2 color conversion, same fixed point arithmetic as the look up tables.
+// Coefficients greater than 32767 (0.587 and 0.5) are split to fit pmaddwd.
+// --------------------------------------------------------------------------------------
+
+#define SSE2_CONST(a,b)  _mm_set_epi16(b,a,b,a,b,a,b,a)
+
+// Y of 8 pixels: (19595*r + 38470*g + 7471*b + 32767) >> 16 - 128
+static inline __m128i sse2_y(__m128i r,__m128i g,__m128i b)
+{
+
+  const __m128i kRG = SSE2_CONST(19595,38470-65536);
+  const __m128i kB1 = SSE2_CONST(7471,32767);
+  const __m128i one = _mm_set1_epi16(1);
+  const __m128i off = _mm_set1_epi16(128);
+
+  __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(r,g),kRG),
+                             _mm_madd_epi16(_mm_unpacklo_epi16(b,one),kB1));
+  __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(r,g),kRG),
+                             _mm_madd_epi16(_mm_unpackhi_epi16(b,one),kB1));
+  lo = _mm_add_epi32(lo,_mm_slli_epi32(_mm_unpacklo_epi16(g,_mm_setzero_si128()),16));
+  hi = _mm_add_epi32(hi,_mm_slli_epi32(_mm_unpackhi_epi16(g,_mm_setzero_si128()),16));
+  return _mm_sub_epi16(_mm_packs_epi32(_mm_srai_epi32(lo,16),_mm_srai_epi32(hi,16)),off);
+
+}
+
+// Cb and Cr of 8 (already averaged) pixels
+static inline void sse2_cbcr(__m128i r,__m128i g,__m128i b,short *cb,short *cr)
+{
+
+  const __m128i kCb = SSE2_CONST(-11059,-21709);
+  const __m128i kCr = SSE2_CONST(-27439,-5329);
+  const __m128i rnd = _mm_set1_epi32(32767);
+  const __m128i zero = _mm_setzero_si128();
+  __m128i lo,hi;
+
+  // Cb = (-11059*r - 21709*g + 32768*b + 32767) >> 16
+  lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(r,g),kCb),
+                     _mm_slli_epi32(_mm_unpacklo_epi16(b,zero),15));
+  hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(r,g),kCb),
+                     _mm_slli_epi32(_mm_unpackhi_epi16(b,zero),15));
+  lo = _mm_srai_epi32(_mm_add_epi32(lo,rnd),16);
+  hi = _mm_srai_epi32(_mm_add_epi32(hi,rnd),16);
+  _mm_store_si128((__m128i *)cb,_mm_packs_epi32(lo,hi));
+
+  // Cr = (32768*r - 27439*g - 5329*b + 32767) >> 16
+  lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(g,b),kCr),
+                     _mm_slli_epi32(_mm_unpacklo_epi16(r,zero),15));
+  hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(g,b),kCr),
+                     _mm_slli_epi32(_mm_unpackhi_epi16(r,zero),15));
+  lo = _mm_srai_epi32(_mm_add_epi32(lo,rnd),16);
+  hi = _mm_srai_epi32(_mm_add_epi32(hi,rnd),16);
+  _mm_store_si128((__m128i *)cr,_mm_packs_epi32(lo,hi));
+
+}
+
+// Average of 2x2 pixels, c0 and c1 hold 16 pixels of the first row,
+// c2 and c3 the 16 pixels of the second row.
+static inline __m128i sse2_avg(__m128i c0,__m128i c1,__m128i c2,__m128i c3)
+{
+
+  const __m128i one = _mm_set1_epi16(1);
+  __m128i lo = _mm_add_epi32(_mm_madd_epi16(c0,one),_mm_madd_epi16(c2,one));
+  __m128i hi = _mm_add_epi32(_mm_madd_epi16(c1,one),_mm_madd_epi16(c3,one));
+  return _mm_packs_epi32(_mm_srai_epi32(lo,2),_mm_srai_epi32(hi,2));
+
+}
+
+// Convert 2 rows of 16 pixels (r[0],r[1] first row, r[2],r[3] second row)
+static inline void sse2_rows_to_ycc(__m128i *r,__m128i *g,__m128i *b,int j,short *y,short *cb,short *cr)
+{
+
+  int y0 = ((j&4)<<5) + ((j&3)<<4);
+
+  _mm_store_si128((__m128i *)(y+y0)   ,sse2_y(r[0],g[0],b[0]));
+  _mm_store_si128((__m128i *)(y+y0+64),sse2_y(r[1],g[1],b[1]));
+  _mm_store_si128((__m128i *)(y+y0+8) ,sse2_y(r[2],g[2],b[2]));
+  _mm_store_si128((__m128i *)(y+y0+72),sse2_y(r[3],g[3],b[3]));
+
+  sse2_cbcr(sse2_avg(r[0],r[1],r[2],r[3]),
+            sse2_avg(g[0],g[1],g[2],g[3]),
+            sse2_avg(b[0],b[1],b[2],b[3]),cb+j*8,cr+j*8);
+
+}
+
+void conv_block_RGB32H2V2_sse2(int width,unsigned char *rgb,short *y,short *cb,short *cr)
+{
+
+  const __m128i mask = _mm_set1_epi32(0xFF);
+  __m128i r[4],g[4],b[4];
+
+  for(int j=0;j<8;j++) {
+    for(int k=0;k<4;k++) {
+      unsigned char *p = rgb + (k>>1)*width*4 + (k&1)*32;
+      __m128i p0 = _mm_loadu_si128((__m128i *)p);
+      __m128i p1 = _mm_loadu_si128((__m128i *)(p+16));
+      r[k] = _mm_packs_epi32(_mm_and_si128(p0,mask),_mm_and_si128(p1,mask));
+      g[k] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0,8),mask),
+                             _mm_and_si128(_mm_srli_epi32(p1,8),mask));
+      b[k] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0,16),mask),
+                             _mm_and_si128(_mm_srli_epi32(p1,16),mask));
+    }
+    sse2_rows_to_ycc(r,g,b,j,y,cb,cr);
+    rgb += 8*width;
+  }
+
+}
+
+void conv_block_RGB24H2V2_sse2(int width,unsigned char *rgb,short *y,short *cb,short *cr)
+{
+
+  short rs[32],gs[32],bs[32];
+  __m128i r[4],g[4],b[4];
+
+  for(int j=0;j<8;j++) {
+    for(int i=0;i<16;i++) {
+      rs[i]    = rgb[i*3+0];
+      gs[i]    = rgb[i*3+1];
+      bs[i]    = rgb[i*3+2];
+      rs[i+16] = rgb[i*3+0+width*3];
+      gs[i+16] = rgb[i*3+1+width*3];
+      bs[i+16] = rgb[i*3+2+width*3];
+    }
+    for(int k=0;k<4;k++) {
+      r[k] = _mm_loadu_si128((__m128i *)(rs+k*8));
+      g[k] = _mm_loadu_si128((__m128i *)(gs+k*8));
+      b[k] = _mm_loadu_si128((__m128i *)(bs+k*8));
+    }
+    sse2_rows_to_ycc(r,g,b,j,y,cb,cr);
+    rgb += 6*width;
+  }
+
+}
+
+void conv_block_GRAY8Y_sse2(int width,unsigned char *g,short *y)
+{
+
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i off  = _mm_set1_epi16(128);
+
+  for(int j=0;j<8;j++) {
+    __m128i p = _mm_loadl_epi64((__m128i *)g);
+    _mm_store_si128((__m128i *)y,_mm_sub_epi16(_mm_unpacklo_epi8(p,zero),off));
+    y += 8;
+    g += width;
+  }
+
+}
+
+#endif /* JPG_USE_SSE2 */
+
 // --------------------------------------------------------------------------------------
 // Convert 16x16 RGB32 pixel map to (4xY 1xCb 1xCr) block (4:2:0)
 // --------------------------------------------------------------------------------------
@@ -299,7 +453,9 @@ void jpeg_rgb32_to_ycc(int width,int height,int outWidth,int outHeight,unsigned
 
     for(k=0;k<w16;k+=16) {
       rgb = rgb32 + (k + l*width)*4;
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_RGB32H2V2_sse2(width,rgb,y,cb,cr);
+#elif defined(JPG_USE_ASM)
       conv_block_RGB32H2V2_mmx((long)width,rgb,y,cb,cr);
 #else
       conv_block_RGB32H2V2(width,rgb,y,cb,cr);
@@ -327,7 +483,9 @@ void jpeg_rgb32_to_ycc(int width,int height,int outWidth,int outHeight,unsigned
         }
       }
       rgb = (unsigned char *)rgbScrath;
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_RGB32H2V2_sse2(16,rgb,y,cb,cr);
+#elif defined(JPG_USE_ASM)
       conv_block_RGB32H2V2_mmx((long)16,rgb,y,cb,cr);
 #else
       conv_block_RGB32H2V2(16,rgb,y,cb,cr);
@@ -354,7 +512,9 @@ void jpeg_rgb32_to_ycc(int width,int height,int outWidth,int outHeight,unsigned
         memcpy(rgbScrath+scr,rgb32 + (k + (height-1)*width)*4,16*4);
       }
       rgb = (unsigned char *)rgbScrath;
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_RGB32H2V2_sse2(16,rgb,y,cb,cr);
+#elif defined(JPG_USE_ASM)
       conv_block_RGB32H2V2_mmx((long)16,rgb,y,cb,cr);
 #else
       conv_block_RGB32H2V2(16,rgb,y,cb,cr);
@@ -388,7 +548,9 @@ void jpeg_rgb32_to_ycc(int width,int height,int outWidth,int outHeight,unsigned
         memcpy(rgbScrath+scr,rgbScrath+scrL,16*4);
       }
       rgb = (unsigned char *)rgbScrath;
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_RGB32H2V2_sse2(16,rgb,y,cb,cr);
+#elif defined(JPG_USE_ASM)
       conv_block_RGB32H2V2_mmx((long)16,rgb,y,cb,cr);
 #else
       conv_block_RGB32H2V2(16,rgb,y,cb,cr);
@@ -398,7 +560,7 @@ void jpeg_rgb32_to_ycc(int width,int height,int outWidth,int outHeight,unsigned
 
   }
 
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_ASM) && !defined(JPG_USE_SSE2)
 #ifdef _WINDOWS
   __asm emms;
 #else
@@ -483,7 +645,9 @@ void jpeg_rgb24_to_ycc(int width,int height,int outWidth,int outHeight,unsigned
 
     for(k=0;k<w16;k+=16) {
       rgb = rgb24 + (k + l*width)*3;
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_RGB24H2V2_sse2(width,rgb,y,cb,cr);
+#elif defined(JPG_USE_ASM)
       conv_block_RGB24H2V2_mmx((long)width,rgb,y,cb,cr);
 #else
       conv_block_RGB24H2V2(width,rgb,y,cb,cr);
@@ -510,7 +674,9 @@ void jpeg_rgb24_to_ycc(int width,int height,int outWidth,int outHeight,unsigned
         }
       }
       rgb = (unsigned char *)rgbScrath;
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_RGB24H2V2_sse2(16,rgb,y,cb,cr);
+#elif defined(JPG_USE_ASM)
       conv_block_RGB24H2V2_mmx((long)16,rgb,y,cb,cr);
 #else
       conv_block_RGB24H2V2(16,rgb,y,cb,cr);
@@ -537,7 +703,9 @@ void jpeg_rgb24_to_ycc(int width,int height,int outWidth,int outHeight,unsigned
         memcpy(rgbScrath+scr,rgb24 + (k + (height-1)*width)*3,16*3);
       }
       rgb = (unsigned char *)rgbScrath;
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_RGB24H2V2_sse2(16,rgb,y,cb,cr);
+#elif defined(JPG_USE_ASM)
       conv_block_RGB24H2V2_mmx((long)16,rgb,y,cb,cr);
 #else
       conv_block_RGB24H2V2(16,rgb,y,cb,cr);
@@ -570,7 +738,9 @@ void jpeg_rgb24_to_ycc(int width,int height,int outWidth,int outHeight,unsigned
         memcpy(rgbScrath+scr,rgbScrath+scrL,16*3);
       }
       rgb = (unsigned char *)rgbScrath;
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_RGB24H2V2_sse2(16,rgb,y,cb,cr);
+#elif defined(JPG_USE_ASM)
       conv_block_RGB24H2V2_mmx((long)16,rgb,y,cb,cr);
 #else
       conv_block_RGB24H2V2(16,rgb,y,cb,cr);
@@ -580,7 +750,7 @@ void jpeg_rgb24_to_ycc(int width,int height,int outWidth,int outHeight,unsigned
 
   }
 
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_ASM) && !defined(JPG_USE_SSE2)
 #ifdef _WINDOWS
   __asm emms;
 #else
@@ -625,7 +795,9 @@ void jpeg_gray8_to_y(int width,int height,int outWidth,int outHeight,unsigned ch
   for(l=0;l<h8;l+=8) {
     for(k=0;k<w8;k+=8) {
       g = gray8 + (k + l*width);
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_GRAY8Y_sse2(width,g,y);
+#elif defined(JPG_USE_ASM)
       conv_block_GRAY8Y_mmx((long)width,g,y);
 #else
       conv_block_GRAY8Y(width,g,y);
@@ -646,7 +818,9 @@ void jpeg_gray8_to_y(int width,int height,int outWidth,int outHeight,unsigned ch
         }
       }
       g = (unsigned char *)gScrath;
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_GRAY8Y_sse2(8,g,y);
+#elif defined(JPG_USE_ASM)
       conv_block_GRAY8Y_mmx((long)8,g,y);
 #else
       conv_block_GRAY8Y(8,g,y);
@@ -671,7 +845,9 @@ void jpeg_gray8_to_y(int width,int height,int outWidth,int outHeight,unsigned ch
         memcpy(gScrath+scr,gray8 + (k + (height-1)*width),8);
       }
       g = (unsigned char *)gScrath;
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_GRAY8Y_sse2(8,g,y);
+#elif defined(JPG_USE_ASM)
       conv_block_GRAY8Y_mmx((long)8,g,y);
 #else
       conv_block_GRAY8Y(8,g,y);
@@ -698,7 +874,9 @@ void jpeg_gray8_to_y(int width,int height,int outWidth,int outHeight,unsigned ch
         memcpy(gScrath+scr,gScrath+scrL,8);
       }
       g = (unsigned char *)gScrath;
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_SSE2)
+      conv_block_GRAY8Y_sse2(8,g,y);
+#elif defined(JPG_USE_ASM)
       conv_block_GRAY8Y_mmx((long)8,g,y);
 #else
       conv_block_GRAY8Y(8,g,y);
@@ -708,7 +886,7 @@ void jpeg_gray8_to_y(int width,int height,int outWidth,int outHeight,unsigned ch
 
   }
 
-#ifdef JPG_USE_ASM
+#if defined(JPG_USE_ASM) && !defined(JPG_USE_SSE2)
 #ifdef _WINDOWS
   __asm emms;
 #else
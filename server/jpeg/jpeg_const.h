@@ -40,6 +40,16 @@
 #ifndef _JPEGCONSTH_
 #define _JPEGCONSTH_
 
+// SSE2 encoding kernels (DCT, quantization, color conversion) are used
+// whenever the compiler targets SSE2. They take precedence over the MMX
+// ones and produce exactly the same coefficients as the C code.
+// Define JPG_NO_SSE2 to disable them.
+
+#if !defined(JPG_NO_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define JPG_USE_SSE2
+#include <emmintrin.h>
+#endif
+
 // Huffman table structure
 
 typedef struct {
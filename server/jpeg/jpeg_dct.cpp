@@ -40,6 +40,7 @@
 // C implementation comes from JPEG library by Thomas G. Lane
 
 #include "jpeg_lib.h"
+#include "jpeg_const.h"
 
 #define SHIFT2(x)        (((x) +     2) >> 2 )
 #define SHIFT11(x)       (((x) +  2048) >> 11)
@@ -177,6 +178,156 @@ void jpeg_fdct( short *block )
 
 // -------------------------------------------------------------
 
+#ifdef JPG_USE_SSE2
+
+// SSE2 version of jpeg_fdct(), 8 rows (or columns) at a time.
+// Products are grouped by pair and computed with pmaddwd so that all
+// intermediate results are exact 32-bit values, the output is then bit
+// identical to the C version.
+
+#define SSE2_CONST(a,b)  _mm_set_epi16(b,a,b,a,b,a,b,a)
+
+#define SSE2_MADD(lo,hi,x,y,k) { \
+  __m128i _l = _mm_unpacklo_epi16(x,y); \
+  __m128i _h = _mm_unpackhi_epi16(x,y); \
+  lo = _mm_madd_epi16(_l,k); \
+  hi = _mm_madd_epi16(_h,k); }
+
+#define SSE2_DESCALE(lo,hi,rnd,n) \
+  _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(lo,rnd),n), \
+                  _mm_srai_epi32(_mm_add_epi32(hi,rnd),n))
+
+static inline void jpeg_transpose_sse2(__m128i *d)
+{
+
+  __m128i a0 = _mm_unpacklo_epi16(d[0],d[1]);
+  __m128i a1 = _mm_unpackhi_epi16(d[0],d[1]);
+  __m128i a2 = _mm_unpacklo_epi16(d[2],d[3]);
+  __m128i a3 = _mm_unpackhi_epi16(d[2],d[3]);
+  __m128i a4 = _mm_unpacklo_epi16(d[4],d[5]);
+  __m128i a5 = _mm_unpackhi_epi16(d[4],d[5]);
+  __m128i a6 = _mm_unpacklo_epi16(d[6],d[7]);
+  __m128i a7 = _mm_unpackhi_epi16(d[6],d[7]);
+
+  __m128i b0 = _mm_unpacklo_epi32(a0,a2);
+  __m128i b1 = _mm_unpackhi_epi32(a0,a2);
+  __m128i b2 = _mm_unpacklo_epi32(a1,a3);
+  __m128i b3 = _mm_unpackhi_epi32(a1,a3);
+  __m128i b4 = _mm_unpacklo_epi32(a4,a6);
+  __m128i b5 = _mm_unpackhi_epi32(a4,a6);
+  __m128i b6 = _mm_unpacklo_epi32(a5,a7);
+  __m128i b7 = _mm_unpackhi_epi32(a5,a7);
+
+  d[0] = _mm_unpacklo_epi64(b0,b4);
+  d[1] = _mm_unpackhi_epi64(b0,b4);
+  d[2] = _mm_unpacklo_epi64(b1,b5);
+  d[3] = _mm_unpackhi_epi64(b1,b5);
+  d[4] = _mm_unpacklo_epi64(b2,b6);
+  d[5] = _mm_unpackhi_epi64(b2,b6);
+  d[6] = _mm_unpacklo_epi64(b3,b7);
+  d[7] = _mm_unpackhi_epi64(b3,b7);
+
+}
+
+// 1-D DCT on d[0..7] (each register holds 8 independent vectors).
+// pass 0 : row pass (<<2 and SHIFT11), pass 1 : column pass (SHIFT2 and SHIFT15)
+
+static inline void jpeg_fdct_pass_sse2(__m128i *d,int pass)
+{
+
+  __m128i tmp0 = _mm_add_epi16(d[0],d[7]);
+  __m128i tmp7 = _mm_sub_epi16(d[0],d[7]);
+  __m128i tmp1 = _mm_add_epi16(d[1],d[6]);
+  __m128i tmp6 = _mm_sub_epi16(d[1],d[6]);
+  __m128i tmp2 = _mm_add_epi16(d[2],d[5]);
+  __m128i tmp5 = _mm_sub_epi16(d[2],d[5]);
+  __m128i tmp3 = _mm_add_epi16(d[3],d[4]);
+  __m128i tmp4 = _mm_sub_epi16(d[3],d[4]);
+
+  __m128i tmp10 = _mm_add_epi16(tmp0,tmp3);
+  __m128i tmp13 = _mm_sub_epi16(tmp0,tmp3);
+  __m128i tmp11 = _mm_add_epi16(tmp1,tmp2);
+  __m128i tmp12 = _mm_sub_epi16(tmp1,tmp2);
+
+  __m128i lo,hi,lo2,hi2,z3lo,z3hi,z4lo,z4hi;
+  __m128i rnd;
+  int     n;
+
+  // Even part
+  if( pass==0 ) {
+    d[0] = _mm_slli_epi16(_mm_add_epi16(tmp10,tmp11),2);
+    d[4] = _mm_slli_epi16(_mm_sub_epi16(tmp10,tmp11),2);
+    rnd  = _mm_set1_epi32(2048);
+    n    = 11;
+  } else {
+    __m128i r2 = _mm_set1_epi32(2);
+    SSE2_MADD(lo,hi,tmp10,tmp11,SSE2_CONST(1,1));
+    d[0] = SSE2_DESCALE(lo,hi,r2,2);
+    SSE2_MADD(lo,hi,tmp10,tmp11,SSE2_CONST(1,-1));
+    d[4] = SSE2_DESCALE(lo,hi,r2,2);
+    rnd  = _mm_set1_epi32(32768);
+    n    = 15;
+  }
+
+  // z1 = (tmp12 + tmp13)*c6
+  // d2 = z1 + tmp13*(c2-c6) , d6 = z1 - tmp12*(c2+c6)
+  SSE2_MADD(lo,hi,tmp12,tmp13,SSE2_CONST(4433,4433+6270));
+  d[2] = SSE2_DESCALE(lo,hi,rnd,n);
+  SSE2_MADD(lo,hi,tmp12,tmp13,SSE2_CONST(4433-15137,4433));
+  d[6] = SSE2_DESCALE(lo,hi,rnd,n);
+
+  // Odd part, z5 folded into z3 and z4
+  __m128i z3 = _mm_add_epi16(tmp4,tmp6);
+  __m128i z4 = _mm_add_epi16(tmp5,tmp7);
+  SSE2_MADD(z3lo,z3hi,z3,z4,SSE2_CONST(9633-16069,9633));
+  SSE2_MADD(z4lo,z4hi,z3,z4,SSE2_CONST(9633,9633-3196));
+
+  // d7 = tmp4*c0298 - z1*c0899 + z3  (z1 = tmp4+tmp7)
+  SSE2_MADD(lo,hi,tmp4,tmp7,SSE2_CONST(2446-7373,-7373));
+  lo2 = _mm_add_epi32(lo,z3lo); hi2 = _mm_add_epi32(hi,z3hi);
+  d[7] = SSE2_DESCALE(lo2,hi2,rnd,n);
+
+  // d1 = tmp7*c1501 - z1*c0899 + z4
+  SSE2_MADD(lo,hi,tmp4,tmp7,SSE2_CONST(-7373,12299-7373));
+  lo2 = _mm_add_epi32(lo,z4lo); hi2 = _mm_add_epi32(hi,z4hi);
+  d[1] = SSE2_DESCALE(lo2,hi2,rnd,n);
+
+  // d5 = tmp5*c2053 - z2*c2562 + z4  (z2 = tmp5+tmp6)
+  SSE2_MADD(lo,hi,tmp5,tmp6,SSE2_CONST(16819-20995,-20995));
+  lo2 = _mm_add_epi32(lo,z4lo); hi2 = _mm_add_epi32(hi,z4hi);
+  d[5] = SSE2_DESCALE(lo2,hi2,rnd,n);
+
+  // d3 = tmp6*c3072 - z2*c2562 + z3
+  SSE2_MADD(lo,hi,tmp5,tmp6,SSE2_CONST(-20995,25172-20995));
+  lo2 = _mm_add_epi32(lo,z3lo); hi2 = _mm_add_epi32(hi,z3hi);
+  d[3] = SSE2_DESCALE(lo2,hi2,rnd,n);
+
+}
+
+void jpeg_fdct_sse2( short *block )
+{
+
+  // block must be 16 bytes aligned
+  __m128i d[8];
+  __m128i *b = (__m128i *)block;
+  int i;
+
+  // Rows: transpose so that each register holds one column
+  for(i=0;i<8;i++) d[i] = _mm_load_si128(b+i);
+  jpeg_transpose_sse2(d);
+  jpeg_fdct_pass_sse2(d,0);
+
+  // Columns: transpose back so that each register holds one row
+  jpeg_transpose_sse2(d);
+  jpeg_fdct_pass_sse2(d,1);
+  for(i=0;i<8;i++) _mm_store_si128(b+i,d[i]);
+
+}
+
+#endif /* JPG_USE_SSE2 */
+
+// -------------------------------------------------------------
+
 void jpeg_idct(short *block, unsigned char *dest)
 {
 
@@ -54,6 +54,7 @@
 #include "jpeg_const.h"
 #include "jpeg_memory.h"
 #include "jpeg_bitstream.h"
+#include <omnithread.h>
 
 /* These are the sample quantization tables given in JPEG spec section K.1.
  * The spec says that the values given produce "good" quality, and
@@ -164,6 +165,29 @@ void jpeg_gray8_to_y(int width,int height,int outWidth,int outHeight,unsigned ch
 // Forward dct (jpeg_dct.cpp)
 void jpeg_fdct(short *block);
 void jpeg_fdct_mmx(short *block);
+void jpeg_fdct_sse2(short *block);
+
+// Band of MCU rows, bands are encoded independently (possibly by
+// different threads) and separated by restart markers.
+typedef struct {
+
+  int              format;     // 8 (gray), 24 or 32 (rgb)
+  int              width;      // Image width
+  int              height;     // Number of image lines in the band
+  int              outWidth;   // Padded image width
+  int              outHeight;  // Padded band height
+  unsigned char   *src;        // First image line of the band
+  short           *ycc;        // Blocks of the band
+  int              firstRow;   // Index of the first MCU row
+  int              nbRow;      // Number of MCU rows
+  int              mcuPerRow;  // Number of MCU per row
+  int              restart;    // Restart marker before each MCU row
+  unsigned short  *lumDiv;     // Luminance quantization divisor
+  unsigned short  *chrDiv;     // Chrominance quantization divisor
+  HUFFMANTABLE    *hTables;    // Huffman tables
+  OutputBitStream *bs;         // Output stream
+
+} JPGBAND;
 
 // ----------------------------------------------------------------
 // Start of Image marker
@@ -341,12 +365,41 @@ static void jpeg_write_SOS(OutputBitStream *bs,JPGCOMPONENT *comps,int nbComp) {
 
 }
 
+// ----------------------------------------------------------------
+// Restart interval (in MCU)
+
+static void jpeg_write_DRI(OutputBitStream *bs,int interval) {
+
+  bs->put_byte(0xFF);
+  bs->put_byte(M_DRI);
+  bs->put_short(4);
+  bs->put_short(interval);
+
+}
+
 // ----------------------------------------------------------------
 
 static void jpeg_quantize_block(short *blocks,unsigned short *qDiv) {
 
-//#ifdef JPG_USE_ASM
-#if 0
+#if defined(JPG_USE_SSE2)
+
+  // qDiv <= 8192, 16x16 bits signed products rebuilt from low and high words
+  __m128i rnd = _mm_set1_epi32(32767);
+  __m128i *b = (__m128i *)blocks;
+  __m128i *q = (__m128i *)qDiv;
+
+  for(int i=0;i<8;i++) {
+    __m128i v  = _mm_load_si128(b+i);
+    __m128i d  = _mm_load_si128(q+i);
+    __m128i pl = _mm_mullo_epi16(v,d);
+    __m128i ph = _mm_mulhi_epi16(v,d);
+    __m128i lo = _mm_srai_epi32(_mm_add_epi32(_mm_unpacklo_epi16(pl,ph),rnd),16);
+    __m128i hi = _mm_srai_epi32(_mm_add_epi32(_mm_unpackhi_epi16(pl,ph),rnd),16);
+    _mm_store_si128(b+i,_mm_packs_epi32(lo,hi));
+  }
+
+//#elif defined(JPG_USE_ASM)
+#elif 0
 
   short mmRound[]  = { 0x7FFF,0x7FFF,0,0 };
   short mmOne[]    = { 1,1,0,0 };
@@ -419,8 +472,192 @@ _sseqrows:
 
 // ----------------------------------------------------------------
 
+#if defined(JPG_USE_SSE2)
+#define JPEG_FDCT_LUM(b) jpeg_fdct_sse2(b)
+#define JPEG_FDCT_CHR(b) jpeg_fdct_sse2(b)
+#elif defined(JPG_USE_ASM)
+#define JPEG_FDCT_LUM(b) jpeg_fdct_mmx(b)
+#define JPEG_FDCT_CHR(b) jpeg_fdct(b)
+#else
+#define JPEG_FDCT_LUM(b) jpeg_fdct(b)
+#define JPEG_FDCT_CHR(b) jpeg_fdct(b)
+#endif
+
+static void jpeg_encode_band(JPGBAND *band) {
+
+  OutputBitStream *bs = band->bs;
+  HUFFMANTABLE *hTables = band->hTables;
+  short lastDc[3] = { 0,0,0 };
+  int nbMCU = band->mcuPerRow * band->nbRow;
+  short *block;
+
+  // Convert to YUV
+  switch( band->format ) {
+    case 8:
+      jpeg_gray8_to_y(band->width,band->height,band->outWidth,band->outHeight,band->src,band->ycc);
+      break;
+    case 24:
+      jpeg_rgb24_to_ycc(band->width,band->height,band->outWidth,band->outHeight,band->src,band->ycc);
+      break;
+    default:
+      jpeg_rgb32_to_ycc(band->width,band->height,band->outWidth,band->outHeight,band->src,band->ycc);
+      break;
+  }
+
+  if( band->format==8 ) {
+
+    // Encode blocks
+    block = band->ycc;
+    for(int i=0;i<nbMCU;i++) {
+      JPEG_FDCT_LUM(block);
+      jpeg_quantize_block(block,band->lumDiv);
+      block+=64;
+    }
+
+    block = band->ycc;
+    bs->init();
+    for(int j=0;j<band->nbRow;j++) {
+      if( band->restart && band->firstRow+j>0 ) {
+        bs->put_restart(band->firstRow+j-1);
+        lastDc[0] = 0;
+      }
+      for(int i=0;i<band->mcuPerRow;i++) {
+        bs->encode_block(block,hTables+0,hTables+1,lastDc);
+        block+=64;
+      }
+    }
+
+  } else {
+
+    // Encode blocks (downsampling :2 for Cb and Cr)
+    block = band->ycc;
+    for(int i=0;i<nbMCU;i++) {
+
+      // Luminace (Y)
+      JPEG_FDCT_LUM(block+0);
+      JPEG_FDCT_LUM(block+64);
+      JPEG_FDCT_LUM(block+128);
+      JPEG_FDCT_LUM(block+192);
+      jpeg_quantize_block(block+0  ,band->lumDiv);
+      jpeg_quantize_block(block+64 ,band->lumDiv);
+      jpeg_quantize_block(block+128,band->lumDiv);
+      jpeg_quantize_block(block+192,band->lumDiv);
+
+      // Chrominance (Cb)
+      JPEG_FDCT_CHR(block+256);
+      jpeg_quantize_block(block+256,band->chrDiv);
+
+      // Chrominance (Cr)
+      JPEG_FDCT_CHR(block+320);
+      jpeg_quantize_block(block+320,band->chrDiv);
+
+      block+=384;
+
+    }
+
+    block = band->ycc;
+    bs->init();
+    for(int j=0;j<band->nbRow;j++) {
+      if( band->restart && band->firstRow+j>0 ) {
+        bs->put_restart(band->firstRow+j-1);
+        lastDc[0] = lastDc[1] = lastDc[2] = 0;
+      }
+      for(int i=0;i<band->mcuPerRow;i++) {
+        // Luminace
+        bs->encode_block(block+0  ,hTables+0,hTables+1,lastDc+0);
+        bs->encode_block(block+64 ,hTables+0,hTables+1,lastDc+0);
+        bs->encode_block(block+128,hTables+0,hTables+1,lastDc+0);
+        bs->encode_block(block+192,hTables+0,hTables+1,lastDc+0);
+        // Chrominance
+        bs->encode_block(block+256,hTables+2,hTables+3,lastDc+1);
+        bs->encode_block(block+320,hTables+2,hTables+3,lastDc+2);
+        block+=384;
+      }
+    }
+
+  }
+
+  if( band->restart ) bs->pad();
+  else                bs->flush();
+
+}
+
+// ----------------------------------------------------------------
+
+class JpegBandThread : public omni_thread {
+
+ public:
+
+  JpegBandThread(JPGBAND *b) : band(b) {}
+  void start() { start_undetached(); }
+
+ private:
+
+  void *run_undetached(void *) { jpeg_encode_band(band); return NULL; }
+  JPGBAND *band;
+
+};
+
+// ----------------------------------------------------------------
+// Split the image in nbThread bands of MCU rows and encode them
+// (nbThread must not exceed the number of MCU rows).
+// The first band is encoded by the calling thread. All buffers are
+// allocated here as malloc_16() is not thread safe.
+
+static void jpeg_encode_image(JPGBAND *img,int mcuSize,int blockSize,int nbThread,OutputBitStream *bs) {
+
+  int nbRows = img->outHeight / mcuSize;
+  int bpp = img->format / 8;
+
+  if( nbThread <= 1 ) {
+    img->firstRow = 0;
+    img->nbRow = nbRows;
+    img->restart = 0;
+    img->bs = bs;
+    jpeg_encode_band(img);
+    return;
+  }
+
+  JPGBAND *bands = new JPGBAND[nbThread];
+  JpegBandThread **th = new JpegBandThread*[nbThread];
+
+  for(int i=0;i<nbThread;i++) {
+    int r0 = (i*nbRows)/nbThread;
+    int r1 = ((i+1)*nbRows)/nbThread;
+    int l0 = r0*mcuSize;
+    bands[i] = *img;
+    bands[i].firstRow = r0;
+    bands[i].nbRow = r1-r0;
+    bands[i].restart = 1;
+    bands[i].src = img->src + l0*img->width*bpp;
+    bands[i].height = (r1*mcuSize < img->height) ? (r1-r0)*mcuSize : img->height-l0;
+    bands[i].outHeight = (r1-r0)*mcuSize;
+    bands[i].ycc = img->ycc + r0*img->mcuPerRow*blockSize;
+    bands[i].bs = new OutputBitStream();
+  }
+
+  for(int i=1;i<nbThread;i++) {
+    th[i] = new JpegBandThread(bands+i);
+    th[i]->start();
+  }
+  jpeg_encode_band(bands);
+  for(int i=1;i<nbThread;i++)
+    th[i]->join(NULL);
+
+  for(int i=0;i<nbThread;i++) {
+    bs->put_bytes(bands[i].bs->get_data(),bands[i].bs->get_size());
+    delete bands[i].bs;
+  }
+
+  delete [] th;
+  delete [] bands;
+
+}
+
+// ----------------------------------------------------------------
+
 static void jpeg_encode_rgb(int width,int height,unsigned char *rgb,double quality,
-                            int *jpegSize,unsigned char **jpegData,int rgbW) {
+                            int *jpegSize,unsigned char **jpegData,int rgbW,int nbThread) {
 
   short lumQuant[64];        // Luminance quantization table
   short chrQuant[64];        // Chrominance quantization table
@@ -481,6 +718,10 @@ static void jpeg_encode_rgb(int width,int height,unsigned char *rgb,double quali
   comps[2].acIdx = 1;
   comps[2].lastDc = 0;
 
+  // Restart marker between bands when encoding with several threads
+  if( nbThread > rHeight/16 ) nbThread = rHeight/16;
+  if( nbThread > 1 ) jpeg_write_DRI(bs,rWidth/16);
+
   jpeg_write_SOF(bs,width,height,comps,3);
   jpeg_write_SOS(bs,comps,3);
 
@@ -492,66 +733,23 @@ static void jpeg_encode_rgb(int width,int height,unsigned char *rgb,double quali
     chrDiv[i] = (unsigned short)( 65536.0/(double)chrQuant[i] + 0.5 );
   }
 
-  // Convert to YUV
+  // Convert to YUV and encode
   jpeg_init_color();
   short *ycc = (short *)malloc_16(rWidth*rHeight*3);
-  if( rgbW==24 )
-    jpeg_rgb24_to_ycc(width,height,rWidth,rHeight,rgb,ycc);
-  else
-    jpeg_rgb32_to_ycc(width,height,rWidth,rHeight,rgb,ycc);
-
-  // Encode blocks (downsampling :2 for Cb and Cr)
-  int nbMCU = rWidth/16 * rHeight/16;
-  short *block = ycc;
-  for(int i=0;i<nbMCU;i++) {
-
-    // Luminace (Y)
-#ifdef JPG_USE_ASM
-    jpeg_fdct_mmx(block+0);
-    jpeg_fdct_mmx(block+64);
-    jpeg_fdct_mmx(block+128);
-    jpeg_fdct_mmx(block+192);
-#else
-    jpeg_fdct(block+0);
-    jpeg_fdct(block+64);
-    jpeg_fdct(block+128);
-    jpeg_fdct(block+192);
-#endif
-    jpeg_quantize_block(block+0  ,lumDiv);
-    jpeg_quantize_block(block+64 ,lumDiv);
-    jpeg_quantize_block(block+128,lumDiv);
-    jpeg_quantize_block(block+192,lumDiv);
-
-    // Chrominance (Cb)
-    jpeg_fdct(block+256);
-    jpeg_quantize_block(block+256,chrDiv);
-
-    // Chrominance (Cr)
-    jpeg_fdct(block+320);
-    jpeg_quantize_block(block+320,chrDiv);
-
-    block+=384;
-
-  }
-
-  block = ycc;
-  bs->init();
-  for(int i=0;i<nbMCU;i++) {
-
-    // Luminace
-    bs->encode_block(block+0  ,hTables+0,hTables+1,&(comps[0].lastDc));
-    bs->encode_block(block+64 ,hTables+0,hTables+1,&(comps[0].lastDc));
-    bs->encode_block(block+128,hTables+0,hTables+1,&(comps[0].lastDc));
-    bs->encode_block(block+192,hTables+0,hTables+1,&(comps[0].lastDc));
-    // Chrominance
-    bs->encode_block(block+256,hTables+2,hTables+3,&(comps[1].lastDc));
-    bs->encode_block(block+320,hTables+2,hTables+3,&(comps[2].lastDc));
-
-    block+=384;
-
-  }
 
-  bs->flush();
+  JPGBAND img;
+  img.format = rgbW;
+  img.width = width;
+  img.height = height;
+  img.outWidth = rWidth;
+  img.outHeight = rHeight;
+  img.src = rgb;
+  img.ycc = ycc;
+  img.mcuPerRow = rWidth/16;
+  img.lumDiv = lumDiv;
+  img.chrDiv = chrDiv;
+  img.hTables = hTables;
+  jpeg_encode_image(&img,16,384,nbThread,bs);
 
   jpeg_write_EOI(bs);
   free_16(ycc);
@@ -567,19 +765,19 @@ static void jpeg_encode_rgb(int width,int height,unsigned char *rgb,double quali
 // --------------------------------------------------------------------------
 
 void jpeg_encode_rgb32(int width,int height,unsigned char *rgb32,double quality,
-                     int *jpegSize,unsigned char **jpegData) {
-  jpeg_encode_rgb(width,height,rgb32,quality,jpegSize,jpegData,32);
+                     int *jpegSize,unsigned char **jpegData,int nbThread) {
+  jpeg_encode_rgb(width,height,rgb32,quality,jpegSize,jpegData,32,nbThread);
 }
 
 void jpeg_encode_rgb24(int width,int height,unsigned char *rgb24,double quality,
-                     int *jpegSize,unsigned char **jpegData) {
-  jpeg_encode_rgb(width,height,rgb24,quality,jpegSize,jpegData,24);
+                     int *jpegSize,unsigned char **jpegData,int nbThread) {
+  jpeg_encode_rgb(width,height,rgb24,quality,jpegSize,jpegData,24,nbThread);
 }
 
 // --------------------------------------------------------------------------
 
 void jpeg_encode_gray8(int width,int height,unsigned char *gray8,double quality,
-                       int *jpegSize,unsigned char **jpegData) {
+                       int *jpegSize,unsigned char **jpegData,int nbThread) {
 
   short lumQuant[64];        // Luminance quantization table
   unsigned short *lumDiv;    // Luminance quantization table divisor
@@ -614,6 +812,10 @@ void jpeg_encode_gray8(int width,int height,unsigned char *gray8,double quality,
   comps[0].acIdx = 0;
   comps[0].lastDc = 0;
 
+  // Restart marker between bands when encoding with several threads
+  if( nbThread > rHeight/8 ) nbThread = rHeight/8;
+  if( nbThread > 1 ) jpeg_write_DRI(bs,rWidth/8);
+
   jpeg_write_SOF(bs,width,height,comps,1);
   jpeg_write_SOS(bs,comps,1);
 
@@ -623,35 +825,23 @@ void jpeg_encode_gray8(int width,int height,unsigned char *gray8,double quality,
     lumDiv[i] = (unsigned short)( 65536.0/(double)lumQuant[i] + 0.5 );
   }
 
-  // Convert to YUV
+  // Convert to YUV and encode
   jpeg_init_color();
   short *ycc = (short *)malloc_16(rWidth*rHeight*2);
-  jpeg_gray8_to_y(width,height,rWidth,rHeight,gray8,ycc);
-
-  // Encode blocks (downsampling :2 for Cb and Cr)
-  int nbMCU = rWidth/8 * rHeight/8;
-  short *block = ycc;
-  for(int i=0;i<nbMCU;i++) {
-
-    // Luminace (Y)
-#ifdef JPG_USE_ASM
-    jpeg_fdct_mmx(block);
-#else
-    jpeg_fdct(block);
-#endif
-    jpeg_quantize_block(block,lumDiv);
-
-    block+=64;
 
-  }
-
-  block = ycc;
-  bs->init();
-  for(int i=0;i<nbMCU;i++) {
-    bs->encode_block(block,hTables+0,hTables+1,&(comps[0].lastDc));
-    block+=64;
-  }
-  bs->flush();
+  JPGBAND img;
+  img.format = 8;
+  img.width = width;
+  img.height = height;
+  img.outWidth = rWidth;
+  img.outHeight = rHeight;
+  img.src = gray8;
+  img.ycc = ycc;
+  img.mcuPerRow = rWidth/8;
+  img.lumDiv = lumDiv;
+  img.chrDiv = lumDiv;
+  img.hTables = hTables;
+  jpeg_encode_image(&img,8,64,nbThread,bs);
 
   jpeg_write_EOI(bs);
   free_16(ycc);
@@ -45,16 +45,21 @@
 // Encode a RGB image to a buffer
 // quality ranges in 0(poor), 100(max)
 // jpegData is allocated by the function and must be freed by the caller.
+// When nbThread > 1, the image is split in horizontal bands encoded in
+// parallel and separated by restart markers.
 // ----------------------------------------------------------------------------
 
 void jpeg_encode_rgb32(int width,int height,unsigned char *rgb32,
-                       double quality,int *jpegSize,unsigned char **jpegData);
+                       double quality,int *jpegSize,unsigned char **jpegData,
+                       int nbThread = 1);
 
 void jpeg_encode_rgb24(int width,int height,unsigned char *rgb24,
-                       double quality,int *jpegSize,unsigned char **jpegData);
+                       double quality,int *jpegSize,unsigned char **jpegData,
+                       int nbThread = 1);
 
 void jpeg_encode_gray8(int width,int height,unsigned char *gray8,
-                       double quality,int *jpegSize,unsigned char **jpegData);
+                       double quality,int *jpegSize,unsigned char **jpegData,
+                       int nbThread = 1);
 
 // ----------------------------------------------------------------------------
 // Decode a JPEG image and return error code in case of failure, 0 is returned
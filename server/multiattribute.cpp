@@ -89,7 +89,7 @@ static OptAttrProp Tango_OptAttrProp[] = {
 //--------------------------------------------------------------------------
 
 MultiAttribute::MultiAttribute(string &dev_name,DeviceClass *dev_class_ptr)
-:ext(Tango_NullPtr)
+:ext(new MultiAttributeExt)
 {
 	long i;
 	cout4 << "Entering MultiAttribute class constructor for device " << dev_name << endl;
@@ -258,6 +258,12 @@ MultiAttribute::MultiAttribute(string &dev_name,DeviceClass *dev_class_ptr)
 		check_associated(i,dev_name);
 	}
 
+//
+// Build the attribute name map
+//
+
+	build_attr_map();
+
 	cout4 << "Leaving MultiAttribute class constructor" << endl;
 }
 
@@ -275,6 +281,10 @@ MultiAttribute::~MultiAttribute()
 {
 	for(unsigned long i = 0;i < attr_list.size();i++)
 		delete attr_list[i];
+
+#ifndef HAS_UNIQUE_PTR
+	delete ext;
+#endif
 }
 
 //+-------------------------------------------------------------------------
@@ -679,6 +689,13 @@ void MultiAttribute::add_attribute(string &dev_name,
 
 	check_associated(index,dev_name);
 
+//
+// Update the attribute name map (the new attribute may have been inserted
+// before state and status)
+//
+
+	build_attr_map();
+
 	cout4 << "Leaving MultiAttribute::add_attribute" << endl;
 }
 
@@ -722,6 +739,7 @@ void MultiAttribute::remove_attribute(string &attr_name,bool update_idx)
 	vector<Tango::Attribute *>::iterator pos = attr_list.begin();
 	advance(pos,att_index);
 	pos = attr_list.erase(pos);
+	build_attr_map();
 
 //
 // Update all the index for attribute following the one which has been deleted
@@ -816,12 +834,9 @@ void MultiAttribute::remove_attribute(string &attr_name,bool update_idx)
 
 Attribute &MultiAttribute::get_attr_by_name(const char *attr_name)
 {
-	vector<Attribute *>::iterator pos;
+	long ind = find_attr_ind(attr_name);
 
-	pos = find_if(attr_list.begin(),attr_list.end(),
-		      bind2nd(WantedAttr<Attribute *,const char *,bool>(),attr_name));
-
-	if (pos == attr_list.end())
+	if (ind == -1)
 	{
 		cout3 << "MultiAttribute::get_attr_by_name throwing exception" << endl;
 		TangoSys_OMemStream o;
@@ -832,7 +847,7 @@ Attribute &MultiAttribute::get_attr_by_name(const char *attr_name)
 				      (const char *)"MultiAttribute::get_attr_by_name");
 	}
 
-	return *(*pos);
+	return *(attr_list[ind]);
 }
 
 //+-------------------------------------------------------------------------
@@ -851,14 +866,11 @@ Attribute &MultiAttribute::get_attr_by_name(const char *attr_name)
 
 WAttribute &MultiAttribute::get_w_attr_by_name(const char *attr_name)
 {
-	vector<Attribute *>::iterator pos;
-
-	pos = find_if(attr_list.begin(),attr_list.end(),
-		      bind2nd(WantedAttr<Attribute *,const char *,bool>(),attr_name));
+	long ind = find_attr_ind(attr_name);
 
-	if ( (    pos == attr_list.end() ) ||
-		  ( ((*pos)->get_writable() != Tango::WRITE) &&
-		    ((*pos)->get_writable() != Tango::READ_WRITE) ) )
+	if ( (    ind == -1 ) ||
+		  ( (attr_list[ind]->get_writable() != Tango::WRITE) &&
+		    (attr_list[ind]->get_writable() != Tango::READ_WRITE) ) )
 	{
 		cout3 << "MultiAttribute::get_w_attr_by_name throwing exception" << endl;
 		TangoSys_OMemStream o;
@@ -870,7 +882,7 @@ WAttribute &MultiAttribute::get_w_attr_by_name(const char *attr_name)
 	}
 
 
-	return static_cast<WAttribute &>(*(*pos));
+	return static_cast<WAttribute &>(*(attr_list[ind]));
 }
 
 
@@ -890,21 +902,9 @@ WAttribute &MultiAttribute::get_w_attr_by_name(const char *attr_name)
 
 long MultiAttribute::get_attr_ind_by_name(const char *attr_name)
 {
-	long i;
-
-	long nb_attr = attr_list.size();
-	string st(attr_name);
-	transform(st.begin(),st.end(),st.begin(),::tolower);
-
-	for (i = 0;i < nb_attr;i++)
-	{
-		if (attr_list[i]->get_name_size() != st.size())
-			continue;
-		if (attr_list[i]->get_name_lower() == st)
-			break;
-	}
+	long i = find_attr_ind(attr_name);
 
-	if (i == nb_attr)
+	if (i == -1)
 	{
 		cout3 << "MultiAttribute::get_attr_ind_by_name throwing exception" << endl;
 		TangoSys_OMemStream o;
@@ -918,6 +918,63 @@ long MultiAttribute::get_attr_ind_by_name(const char *attr_name)
 	return i;
 }
 
+//+-------------------------------------------------------------------------
+//
+// method : 		MultiAttribute::find_attr_ind
+//
+// description : 	Search an attribute in the main attribute vector using
+//			the attribute name map. If the attribute is not in the
+//			map (or if the map is not up to date), search it in the
+//			vector
+//
+// in :			attr_name : The attribute name
+//
+// This method returns the index of the wanted attribute or -1 if the
+// attribute is not found
+//
+//--------------------------------------------------------------------------
+
+long MultiAttribute::find_attr_ind(const char *attr_name)
+{
+	string st(attr_name);
+	transform(st.begin(),st.end(),st.begin(),::tolower);
+
+	long nb_attr = attr_list.size();
+	map<string,long>::iterator ite = ext->attr_map.find(st);
+	if (ite != ext->attr_map.end())
+	{
+		long ind = ite->second;
+		if ((ind < nb_attr) && (attr_list[ind]->get_name_lower() == st))
+			return ind;
+	}
+
+	for (long i = 0;i < nb_attr;i++)
+	{
+		if (attr_list[i]->get_name_size() != st.size())
+			continue;
+		if (attr_list[i]->get_name_lower() == st)
+			return i;
+	}
+
+	return -1;
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		MultiAttribute::build_attr_map
+//
+// description : 	Rebuild the map between lower case attribute name and
+//			index in the main attribute vector
+//
+//--------------------------------------------------------------------------
+
+void MultiAttribute::build_attr_map()
+{
+	ext->attr_map.clear();
+	for (unsigned long i = 0;i < attr_list.size();i++)
+		ext->attr_map[attr_list[i]->get_name_lower()] = i;
+}
+
 //+-------------------------------------------------------------------------
 //
 // method : 		MultiAttribute::check_alarm
@@ -931,14 +988,42 @@ long MultiAttribute::get_attr_ind_by_name(const char *attr_name)
 //--------------------------------------------------------------------------
 
 bool MultiAttribute::check_alarm()
+{
+	vector<long> cached_list;
+	return check_alarm_not_cached(cached_list);
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		MultiAttribute::check_alarm_not_cached
+//
+// description : 	check alarm on all the attribute where one alarm is
+//			        defined except for the attributes in the cached list.
+//                  These attributes have not been read and are checked
+//                  by the caller using their cached alarm quality
+//
+// in :			cached_list : Index of the attributes not to be checked
+//			              (sorted by this method)
+//
+// This method returns a boolen set to true if one of the attribute with
+// an alarm defined is in alarm state
+//
+//--------------------------------------------------------------------------
+
+bool MultiAttribute::check_alarm_not_cached(vector<long> &cached_list)
 {
 	unsigned long i;
 	bool ret,tmp_ret;
 
 	tmp_ret = false;
 	ret = false;
+	sort(cached_list.begin(),cached_list.end());
 	for (i = 0;i < alarm_attr_list.size();i++)
 	{
+		if ((cached_list.empty() == false) &&
+		    (binary_search(cached_list.begin(),cached_list.end(),alarm_attr_list[i]) == true))
+			continue;
+
 		Tango::AttrQuality qua = (get_attr_by_ind(alarm_attr_list[i])).get_quality();
 		if (ret == false)
 		{
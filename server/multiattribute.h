@@ -276,16 +276,21 @@ public:
 	void get_event_param(vector<EventPar> &);
 	void add_alarmed_quality_factor(string &);
 	void add_default(vector<AttrProperty> &,string &,string &);
-	void add_attr(Attribute *att) {attr_list.push_back(att);}
+	bool check_alarm_not_cached(vector<long> &);
+	void add_attr(Attribute *att) {attr_list.push_back(att);ext->attr_map[att->get_name_lower()] = attr_list.size() - 1;}
 
 private:
     class MultiAttributeExt
     {
+    public:
+        map<string,long>        attr_map;       // Lower case attribute name -> index in main attributes vector
     };
 
 	void concat(vector<AttrProperty> &,vector<AttrProperty> &,vector<AttrProperty> &);
 	void add_user_default(vector<AttrProperty> &,vector<AttrProperty> &);
 	void check_associated(long,string &);
+	void build_attr_map();
+	long find_attr_ind(const char *);
 
 #ifdef HAS_UNIQUE_PTR
     unique_ptr<MultiAttributeExt>           ext;           // Class extension
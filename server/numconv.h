@@ -0,0 +1,351 @@
+//=============================================================================
+//
+// file :               numconv.h
+//
+// description :        Include for the functions used to convert numbers
+//			from/to strings without going through a C++ stream.
+//			They give exactly the same results than the classic
+//			C++ stream operators (C++ stream default locale) but
+//			without allocating anything.
+//
+// project :            TANGO
+//
+// author(s) :          E.Taurel
+//
+// Copyright (C) :      2012
+//						European Synchrotron Radiation Facility
+//                      BP 220, Grenoble 38043
+//                      FRANCE
+//
+// This file is part of Tango.
+//
+// Tango is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Tango is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Tango.  If not, see <http://www.gnu.org/licenses/>.
+//
+// $Revision$
+//
+//=============================================================================
+
+#ifndef _NUMCONV_H
+#define _NUMCONV_H
+
+#include <limits>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Tango
+{
+
+//
+// White space as defined by the classic locale
+//
+
+inline bool num_is_space(char c)
+{
+	return (c == ' ') || (c >= '\t' && c <= '\r');
+}
+
+//+-------------------------------------------------------------------------
+//
+// function : 		str_to_num
+//
+// description : 	Convert the beginning of a string to a number. This is
+//			the "istream >> val" behaviour: Leading white spaces are
+//			skipped, conversion stops at the first character which
+//			cannot be part of the number and an out of range number
+//			is an error (val is then set to the type min or max).
+//			The conversion is done in decimal whatever the process
+//			locale is.
+//
+// argin : 		str : The string
+//			val : The converted number
+//
+// This function returns a pointer to the first character after the number
+// or NULL if the conversion failed
+//
+//--------------------------------------------------------------------------
+
+template <typename T>
+inline const char *str_to_num(const char *str,T &val)
+{
+	const char *ptr = str;
+	while (num_is_space(*ptr) == true)
+		ptr++;
+	if (*ptr == '\0')
+		return NULL;
+
+	bool neg = false;
+	if (*ptr == '+' || *ptr == '-')
+	{
+		neg = (*ptr == '-');
+		ptr++;
+	}
+
+	if (*ptr < '0' || *ptr > '9')
+	{
+		val = 0;
+		return NULL;
+	}
+
+//
+// Unsigned types accept a minus sign (the value is then negated in the
+// unsigned type) like the C++ streams do
+//
+
+	DevULong64 limit = (DevULong64)numeric_limits<T>::max();
+	if (numeric_limits<T>::is_signed == true && neg == true)
+		limit++;
+
+	DevULong64 res = 0;
+	bool overflow = false;
+	for (;*ptr >= '0' && *ptr <= '9';ptr++)
+	{
+		unsigned int digit = *ptr - '0';
+		if (overflow == false && res <= (limit - digit) / 10)
+			res = (res * 10) + digit;
+		else
+			overflow = true;
+	}
+
+	if (overflow == true)
+	{
+		if (numeric_limits<T>::is_signed == true && neg == true)
+			val = numeric_limits<T>::min();
+		else
+			val = numeric_limits<T>::max();
+		return NULL;
+	}
+
+	if (neg == true)
+		val = (T)((DevULong64)0 - res);
+	else
+		val = (T)res;
+
+	return ptr;
+}
+
+//
+// Floating point conversions are done by the C library on a copy of the
+// number characters with the decimal point of the current C locale
+//
+
+inline void num_strto(const char *str,char **end,double &val)
+{
+	val = ::strtod(str,end);
+}
+
+inline void num_strto(const char *str,char **end,float &val)
+{
+#if defined(_TG_WINDOWS_) && defined(_MSC_VER) && (_MSC_VER < 1800)
+	val = (float)::strtod(str,end);
+#else
+	val = ::strtof(str,end);
+#endif
+}
+
+template <typename T>
+inline const char *str_to_flt(const char *str,T &val)
+{
+	const char *ptr = str;
+	while (num_is_space(*ptr) == true)
+		ptr++;
+	if (*ptr == '\0')
+		return NULL;
+
+//
+// Find the number end with the same rules than the C++ streams.
+// No inf, nan or hexadecimal number
+//
+
+	const char *start = ptr;
+	if (*ptr == '+' || *ptr == '-')
+		ptr++;
+
+	bool mantissa = false;
+	bool dec_point = false;
+	bool expo = false;
+	for (;;ptr++)
+	{
+		if (*ptr >= '0' && *ptr <= '9')
+			mantissa = true;
+		else if (*ptr == '.' && dec_point == false && expo == false)
+			dec_point = true;
+		else if ((*ptr == 'e' || *ptr == 'E') && expo == false && mantissa == true)
+		{
+			expo = true;
+			if (ptr[1] == '+' || ptr[1] == '-')
+				ptr++;
+		}
+		else
+			break;
+	}
+
+	size_t len = ptr - start;
+	char buf[TANGO_NUM_BUF_SIZE << 1];
+	vector<char> long_buf;
+	char *conv_buf = buf;
+	if (len >= sizeof(buf))
+	{
+		long_buf.resize(len + 1);
+		conv_buf = &(long_buf[0]);
+	}
+	::memcpy(conv_buf,start,len);
+	conv_buf[len] = '\0';
+
+	char dp = *(::localeconv()->decimal_point);
+	if (dp != '.')
+	{
+		char *dp_ptr = ::strchr(conv_buf,'.');
+		if (dp_ptr != NULL)
+			*dp_ptr = dp;
+	}
+
+//
+// The whole extracted string must be a number. Overflow is an error
+//
+
+	char *end;
+	T res;
+	num_strto(conv_buf,&end,res);
+
+	if (end == conv_buf || *end != '\0')
+	{
+		val = 0;
+		return NULL;
+	}
+	else if (res == numeric_limits<T>::infinity())
+	{
+		val = numeric_limits<T>::max();
+		return NULL;
+	}
+	else if (res == -numeric_limits<T>::infinity())
+	{
+		val = -numeric_limits<T>::max();
+		return NULL;
+	}
+
+	val = res;
+	return ptr;
+}
+
+inline const char *str_to_num(const char *str,double &val)
+{
+	return str_to_flt(str,val);
+}
+
+inline const char *str_to_num(const char *str,float &val)
+{
+	return str_to_flt(str,val);
+}
+
+//+-------------------------------------------------------------------------
+//
+// function : 		str_to_num_full
+//
+// description : 	Convert a string to a number. The whole string has to
+//			be used by the conversion. This is the
+//			"istream >> val && istream.eof()" behaviour
+//
+// argin : 		str : The string
+//			val : The converted number
+//
+// This function returns true if the conversion succeeded
+//
+//--------------------------------------------------------------------------
+
+template <typename T>
+inline bool str_to_num_full(const char *str,T &val)
+{
+	const char *end = str_to_num(str,val);
+	return (end != NULL) && (*end == '\0');
+}
+
+template <typename T>
+inline bool str_to_num_full(const string &str,T &val)
+{
+	return str_to_num_full(str.c_str(),val);
+}
+
+//+-------------------------------------------------------------------------
+//
+// function : 		num_to_str
+//
+// description : 	Write a number in a caller buffer (at least
+//			TANGO_NUM_BUF_SIZE bytes). Integers are written in
+//			decimal. Floating point numbers are written with the
+//			"%.*g" format which is what a C++ stream does with
+//			its default floatfield. The decimal point is always
+//			a '.' and the precision must not be greater than 20
+//
+// argin : 		buf : The buffer
+//			val : The number
+//			prec : The floating point precision
+//
+// This function returns the number of characters written (without the
+// terminating null character)
+//
+//--------------------------------------------------------------------------
+
+template <typename T>
+inline size_t num_to_str(char *buf,T val)
+{
+	char tmp[TANGO_NUM_BUF_SIZE];
+	char *ptr = tmp + sizeof(tmp);
+
+	bool neg = (val < 0);
+	DevULong64 mag = (DevULong64)val;
+	if (neg == true)
+		mag = (DevULong64)0 - mag;
+
+	do
+	{
+		*--ptr = (char)('0' + (mag % 10));
+		mag = mag / 10;
+	}
+	while (mag != 0);
+
+	if (neg == true)
+		*--ptr = '-';
+
+	size_t len = (tmp + sizeof(tmp)) - ptr;
+	::memcpy(buf,ptr,len);
+	buf[len] = '\0';
+
+	return len;
+}
+
+inline size_t num_to_str(char *buf,double val,int prec = TANGO_FLOAT_PRECISION)
+{
+	int len = ::sprintf(buf,"%.*g",prec,val);
+
+	char dp = *(::localeconv()->decimal_point);
+	if (dp != '.')
+	{
+		char *dp_ptr = ::strchr(buf,dp);
+		if (dp_ptr != NULL)
+			*dp_ptr = '.';
+	}
+
+	return (size_t)len;
+}
+
+inline size_t num_to_str(char *buf,float val,int prec = TANGO_FLOAT_PRECISION)
+{
+	return num_to_str(buf,(double)val,prec);
+}
+
+} // End of Tango namespace
+
+#endif /* _NUMCONV_H */
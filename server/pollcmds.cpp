@@ -143,6 +143,61 @@ CORBA::Any *DevPollStatusCmd::execute(DeviceImpl *device, const CORBA::Any &in_a
 }
 
 
+//+-------------------------------------------------------------------------
+//
+// method : 		DevPollStatusBinCmd::DevPollStatusBinCmd
+//
+// description : 	constructors for Command class DevPollStatusBin
+//
+//--------------------------------------------------------------------------
+
+DevPollStatusBinCmd::DevPollStatusBinCmd(const char *name,
+			           Tango::CmdArgType in,
+			           Tango::CmdArgType out,
+			           const char *in_desc,
+				   string &out_desc):Command(name,in,out)
+{
+	set_in_type_desc(in_desc);
+	set_out_type_desc(out_desc);
+}
+
+
+//+-------------------------------------------------------------------------
+//
+// method : 		DevPollStatusBinCmd::execute
+//
+// description : 	Trigger the execution of the method really implemented
+//			the command in the DServer class
+//
+//--------------------------------------------------------------------------
+
+CORBA::Any *DevPollStatusBinCmd::execute(DeviceImpl *device, const CORBA::Any &in_any)
+{
+
+	cout4 << "DevPollStatusBin::execute(): arrived " << endl;
+
+//
+// Extract the input string
+//
+
+	const char *tmp_name;
+	if ((in_any >>= tmp_name) == false)
+	{
+		Except::throw_exception((const char *)"API_IncompatibleCmdArgumentType",
+				        (const char *)"Imcompatible command argument type, expected type is : string",
+				        (const char *)"DevPollStatusBinCmd::execute");
+	}
+	string d_name(tmp_name);
+	cout4 << "Received string = " << d_name << endl;
+
+//
+// Call the device method and return to caller
+//
+
+	return insert((static_cast<DServer *>(device))->dev_poll_status_bin(d_name));
+}
+
+
 //+-------------------------------------------------------------------------
 //
 // method : 		AddObjPollingCmd::AddObjPollingCmd
@@ -99,6 +99,32 @@ public:
 	virtual CORBA::Any *execute(DeviceImpl *device, const CORBA::Any &in_any);
 };
 
+//=============================================================================
+//
+//			The DevPollStatusBin class
+//
+// description :	Class to implement the DevPollStatusBin command.
+//			Same info than the DevPollStatus command but returned
+//			as numbers (one set of doubles per polled object)
+//
+//=============================================================================
+
+
+class DevPollStatusBinCmd : public Command
+{
+public:
+
+
+	DevPollStatusBinCmd(const char *cmd_name,
+		        Tango::CmdArgType in,
+		        Tango::CmdArgType out,
+			const char *in_desc,
+		        string &out_desc);
+	~DevPollStatusBinCmd() {};
+
+	virtual CORBA::Any *execute(DeviceImpl *device, const CORBA::Any &in_any);
+};
+
 //=============================================================================
 //
 //			The AddObjPolling class
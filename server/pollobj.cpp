@@ -123,6 +123,8 @@ PollObj::PollObj(DeviceImpl *d,PollObjType ty,const string &na,
 //			- when : The date when data was read
 //			- needed : The time needed to execute command/attribute
 //				   reading
+//			- force_copy : Copy the user data referenced by the
+//				   value (IDL 4 only)
 //
 //--------------------------------------------------------------------------
 
@@ -158,11 +160,12 @@ void PollObj::insert_data(Tango::AttributeValueList_3 *res,
 
 void PollObj::insert_data(Tango::AttributeValueList_4 *res,
 			  struct timeval &when,
-			  struct timeval &needed)
+			  struct timeval &needed,
+			  bool force_copy)
 {
 	omni_mutex_lock(*this);
 
-	ring.insert_data(res,when,true);
+	ring.insert_data(res,when,true,force_copy);
 	needed_time = needed;
 }
 
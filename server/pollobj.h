@@ -70,7 +70,7 @@ public:
 	void insert_data(CORBA::Any *,struct timeval &,struct timeval &);
 	void insert_data(Tango::AttributeValueList *,struct timeval &,struct timeval &);
 	void insert_data(Tango::AttributeValueList_3 *,struct timeval &,struct timeval &);
-	void insert_data(Tango::AttributeValueList_4 *,struct timeval &,struct timeval &);
+	void insert_data(Tango::AttributeValueList_4 *,struct timeval &,struct timeval &,bool force_copy = true);
 	void insert_except(Tango::DevFailed *,struct timeval &,struct timeval &);
 
 	double get_authorized_delta() {return max_delta_t;}
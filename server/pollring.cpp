@@ -138,6 +138,9 @@ PollRing::~PollRing()
 //
 // argument : in : 	- any_ptr : The Any returned by the command
 //			- t : The date
+//			- unlock : Release the attribute mutexes (IDL 4 only)
+//			- force_copy : Copy the user data referenced by the
+//				       value (IDL 4 only)
 //
 //--------------------------------------------------------------------------
 
@@ -205,9 +208,35 @@ void PollRing::insert_data(Tango::AttributeValueList_3 *attr_val,struct timeval
 	inc_indexes();
 }
 
-void PollRing::insert_data(Tango::AttributeValueList_4 *attr_val,struct timeval &t,bool unlock)
+void PollRing::insert_data(Tango::AttributeValueList_4 *attr_val,struct timeval &t,bool unlock,bool force_copy)
 {
 
+//
+// If the ring is full, first try to copy the new data into the memory of the
+// evicted element (same type, large enough buffer). In this case, no memory
+// allocation is needed to store the new data
+//
+
+	if ((force_copy == true) && (ring[insert_elt].attr_value_4 != NULL))
+	{
+		if (recycle_data(ring[insert_elt].attr_value_4,attr_val) == true)
+		{
+			delete(ring[insert_elt].except);
+			ring[insert_elt].except = NULL;
+			ring[insert_elt].when = t;
+
+			if (unlock == true)
+			{
+				for (unsigned int loop = 0;loop < attr_val->length();loop++)
+					(*attr_val)[loop].rel_attr_mutex();
+			}
+			delete attr_val;
+
+			inc_indexes();
+			return;
+		}
+	}
+
 //
 // Insert data in the ring
 //
@@ -219,7 +248,8 @@ void PollRing::insert_data(Tango::AttributeValueList_4 *attr_val,struct timeval
 	ring[insert_elt].attr_value_4 = attr_val;
 	ring[insert_elt].when = t;
 
-	force_copy_data(ring[insert_elt].attr_value_4);
+	if (force_copy == true)
+		force_copy_data(ring[insert_elt].attr_value_4);
 
 //
 // Release attribute mutexes because the data are now copied
@@ -241,6 +271,120 @@ void PollRing::insert_data(Tango::AttributeValueList_4 *attr_val,struct timeval
 	inc_indexes();
 }
 
+//-------------------------------------------------------------------------
+//
+// method : 		PollRing::recycle_data
+//
+// description : 	Copy a new attribute value into the memory already
+//					allocated for a ring element. This is possible only for
+//					a single attribute value with the same data type (not
+//					string or encoded) and a data size smaller or equal to
+//					the buffer size already allocated for the element.
+//
+// argument : in : 	- old_val : The ring element value (updated)
+//					- new_val : The new attribute value
+//
+// This method returns true if the new value has been copied
+//
+//--------------------------------------------------------------------------
+
+template <typename T>
+bool PollRing::recycle_seq(T &old_seq,T &new_seq)
+{
+	unsigned long len = new_seq.length();
+	if ((old_seq.release() == false) || (old_seq.maximum() < len))
+		return false;
+
+	old_seq.length(len);
+	if (len != 0)
+		::memcpy(old_seq.get_buffer(),new_seq.get_buffer(),len * sizeof(old_seq[0]));
+	return true;
+}
+
+bool PollRing::recycle_data(Tango::AttributeValueList_4 *old_val,Tango::AttributeValueList_4 *new_val)
+{
+	if ((old_val->length() != 1) || (new_val->length() != 1))
+		return false;
+
+	AttributeValue_4 &old_att = (*old_val)[0];
+	AttributeValue_4 &new_att = (*new_val)[0];
+
+	if (old_att.value._d() != new_att.value._d())
+		return false;
+
+	bool ret;
+	switch (new_att.value._d())
+	{
+		case ATT_BOOL:
+		ret = recycle_seq(old_att.value.bool_att_value(),new_att.value.bool_att_value());
+		break;
+
+		case ATT_SHORT:
+		ret = recycle_seq(old_att.value.short_att_value(),new_att.value.short_att_value());
+		break;
+
+		case ATT_LONG:
+		ret = recycle_seq(old_att.value.long_att_value(),new_att.value.long_att_value());
+		break;
+
+		case ATT_LONG64:
+		ret = recycle_seq(old_att.value.long64_att_value(),new_att.value.long64_att_value());
+		break;
+
+		case ATT_FLOAT:
+		ret = recycle_seq(old_att.value.float_att_value(),new_att.value.float_att_value());
+		break;
+
+		case ATT_DOUBLE:
+		ret = recycle_seq(old_att.value.double_att_value(),new_att.value.double_att_value());
+		break;
+
+		case ATT_UCHAR:
+		ret = recycle_seq(old_att.value.uchar_att_value(),new_att.value.uchar_att_value());
+		break;
+
+		case ATT_USHORT:
+		ret = recycle_seq(old_att.value.ushort_att_value(),new_att.value.ushort_att_value());
+		break;
+
+		case ATT_ULONG:
+		ret = recycle_seq(old_att.value.ulong_att_value(),new_att.value.ulong_att_value());
+		break;
+
+		case ATT_ULONG64:
+		ret = recycle_seq(old_att.value.ulong64_att_value(),new_att.value.ulong64_att_value());
+		break;
+
+		case ATT_STATE:
+		ret = recycle_seq(old_att.value.state_att_value(),new_att.value.state_att_value());
+		break;
+
+		case DEVICE_STATE:
+		old_att.value.dev_state_att(new_att.value.dev_state_att());
+		ret = true;
+		break;
+
+		default:
+		ret = false;
+		break;
+	}
+
+	if (ret == true)
+	{
+		old_att.quality = new_att.quality;
+		old_att.data_format = new_att.data_format;
+		old_att.time = new_att.time;
+		old_att.r_dim = new_att.r_dim;
+		old_att.w_dim = new_att.w_dim;
+		if ((old_att.err_list.length() != 0) || (new_att.err_list.length() != 0))
+			old_att.err_list = new_att.err_list;
+		if (::strcmp(old_att.name.in(),new_att.name.in()) != 0)
+			old_att.name = CORBA::string_dup(new_att.name.in());
+	}
+
+	return ret;
+}
+
 //-------------------------------------------------------------------------
 //
 // method : 		PollRing::force_copy_data
@@ -2315,7 +2459,7 @@ void PollRing::get_attr_history(long n,Tango::DevAttrHistory_4 *ptr,long type)
 						new_tmp_sh = new DevVarShortArray();
 						new_tmp_sh->length(seq_size);
 					}
-					ADD_ELT_DATA_TO_GLOBAL_SEQ_BY_PTR_REF(new_tmp_sh,tmp_seq,ind_in_seq);
+					ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(new_tmp_sh,tmp_seq,ind_in_seq);
 					break;
 				}
 
@@ -2327,7 +2471,7 @@ void PollRing::get_attr_history(long n,Tango::DevAttrHistory_4 *ptr,long type)
 						new_tmp_db = new DevVarDoubleArray();
 						new_tmp_db->length(seq_size);
 					}
-					ADD_ELT_DATA_TO_GLOBAL_SEQ_BY_PTR_REF(new_tmp_db,tmp_seq,ind_in_seq);
+					ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(new_tmp_db,tmp_seq,ind_in_seq);
 					break;
 				}
 
@@ -2339,7 +2483,7 @@ void PollRing::get_attr_history(long n,Tango::DevAttrHistory_4 *ptr,long type)
 						new_tmp_lg = new DevVarLongArray();
 						new_tmp_lg->length(seq_size);
 					}
-					ADD_ELT_DATA_TO_GLOBAL_SEQ_BY_PTR_REF(new_tmp_lg,tmp_seq,ind_in_seq);
+					ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(new_tmp_lg,tmp_seq,ind_in_seq);
 					break;
 				}
 
@@ -2351,7 +2495,7 @@ void PollRing::get_attr_history(long n,Tango::DevAttrHistory_4 *ptr,long type)
 						new_tmp_lg64 = new DevVarLong64Array();
 						new_tmp_lg64->length(seq_size);
 					}
-					ADD_ELT_DATA_TO_GLOBAL_SEQ_BY_PTR_REF(new_tmp_lg64,tmp_seq,ind_in_seq);
+					ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(new_tmp_lg64,tmp_seq,ind_in_seq);
 					break;
 				}
 
@@ -2375,7 +2519,7 @@ void PollRing::get_attr_history(long n,Tango::DevAttrHistory_4 *ptr,long type)
 						new_tmp_fl = new DevVarFloatArray();
 						new_tmp_fl->length(seq_size);
 					}
-					ADD_ELT_DATA_TO_GLOBAL_SEQ_BY_PTR_REF(new_tmp_fl,tmp_seq,ind_in_seq);
+					ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(new_tmp_fl,tmp_seq,ind_in_seq);
 					break;
 				}
 
@@ -2387,7 +2531,7 @@ void PollRing::get_attr_history(long n,Tango::DevAttrHistory_4 *ptr,long type)
 						new_tmp_boo = new DevVarBooleanArray();
 						new_tmp_boo->length(seq_size);
 					}
-					ADD_ELT_DATA_TO_GLOBAL_SEQ_BY_PTR_REF(new_tmp_boo,tmp_seq,ind_in_seq);
+					ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(new_tmp_boo,tmp_seq,ind_in_seq);
 					break;
 				}
 
@@ -2399,7 +2543,7 @@ void PollRing::get_attr_history(long n,Tango::DevAttrHistory_4 *ptr,long type)
 						new_tmp_ush = new DevVarUShortArray();
 						new_tmp_ush->length(seq_size);
 					}
-					ADD_ELT_DATA_TO_GLOBAL_SEQ_BY_PTR_REF(new_tmp_ush,tmp_seq,ind_in_seq);
+					ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(new_tmp_ush,tmp_seq,ind_in_seq);
 					break;
 				}
 
@@ -2411,7 +2555,7 @@ void PollRing::get_attr_history(long n,Tango::DevAttrHistory_4 *ptr,long type)
 						new_tmp_uch = new DevVarUCharArray();
 						new_tmp_uch->length(seq_size);
 					}
-					ADD_ELT_DATA_TO_GLOBAL_SEQ_BY_PTR_REF(new_tmp_uch,tmp_seq,ind_in_seq);
+					ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(new_tmp_uch,tmp_seq,ind_in_seq);
 					break;
 				}
 
@@ -2423,7 +2567,7 @@ void PollRing::get_attr_history(long n,Tango::DevAttrHistory_4 *ptr,long type)
 						new_tmp_ulg = new DevVarULongArray();
 						new_tmp_ulg->length(seq_size);
 					}
-					ADD_ELT_DATA_TO_GLOBAL_SEQ_BY_PTR_REF(new_tmp_ulg,tmp_seq,ind_in_seq);
+					ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(new_tmp_ulg,tmp_seq,ind_in_seq);
 					break;
 				}
 
@@ -2435,7 +2579,7 @@ void PollRing::get_attr_history(long n,Tango::DevAttrHistory_4 *ptr,long type)
 						new_tmp_ulg64 = new DevVarULong64Array();
 						new_tmp_ulg64->length(seq_size);
 					}
-					ADD_ELT_DATA_TO_GLOBAL_SEQ_BY_PTR_REF(new_tmp_ulg64,tmp_seq,ind_in_seq);
+					ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(new_tmp_ulg64,tmp_seq,ind_in_seq);
 					break;
 				}
 
@@ -2447,7 +2591,7 @@ void PollRing::get_attr_history(long n,Tango::DevAttrHistory_4 *ptr,long type)
 						new_tmp_state = new DevVarStateArray();
 						new_tmp_state->length(seq_size);
 					}
-					ADD_ELT_DATA_TO_GLOBAL_SEQ_BY_PTR_REF(new_tmp_state,tmp_seq,ind_in_seq);
+					ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(new_tmp_state,tmp_seq,ind_in_seq);
 					break;
 				}
 
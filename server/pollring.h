@@ -95,10 +95,11 @@ public:
 	void insert_data(CORBA::Any *,struct timeval &);
 	void insert_data(Tango::AttributeValueList *,struct timeval &);
 	void insert_data(Tango::AttributeValueList_3 *,struct timeval &);
-	void insert_data(Tango::AttributeValueList_4 *,struct timeval &,bool);
+	void insert_data(Tango::AttributeValueList_4 *,struct timeval &,bool,bool force_copy = true);
 	void insert_except(Tango::DevFailed *,struct timeval &);
 
 	void force_copy_data(Tango::AttributeValueList_4 *);
+	bool recycle_data(Tango::AttributeValueList_4 *,Tango::AttributeValueList_4 *);
 
 	void get_delta_t(vector<double> &,long nb);
 	struct timeval get_last_insert_date();
@@ -129,6 +130,9 @@ public:
 private:
 	void inc_indexes();
 
+	template <typename T>
+	bool recycle_seq(T &,T &);
+
 	vector<RingElt>		ring;
 	long				insert_elt;
 	long				nb_elt;
@@ -160,6 +164,19 @@ private:
 		IND = IND + elt_data_length; \
 	}
 
+//
+// Same than previous one but for sequence of basic types (contiguous
+// buffer of fixed size elements) where one block copy is enough
+//
+
+#define ADD_ELT_DATA_TO_GLOBAL_SEQ_BLOCK(GLOB,ELT,IND) \
+	{\
+		unsigned int elt_data_length = ELT.length(); \
+		if (elt_data_length != 0) \
+			::memcpy(GLOB->get_buffer() + IND,ELT.get_buffer(),elt_data_length * sizeof(ELT[0])); \
+		IND = IND + elt_data_length; \
+	}
+
 #define MANAGE_DIM_ARRAY(LENGTH) \
 	if (last_dim.dim_x == LENGTH) \
 	{ \
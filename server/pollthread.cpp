@@ -61,6 +61,9 @@ DeviceImpl *PollThread::dev_to_del = NULL;
 string PollThread::name_to_del = "";
 PollObjType PollThread::type_to_del = Tango::POLL_CMD;
 
+omni_mutex PollThread::steal_peers_mutex;
+vector<PollThread *> PollThread::steal_peers;
+
 //+-------------------------------------------------------------------------
 //
 // method : 		PollThread::Pollthread
@@ -69,10 +72,12 @@ PollObjType PollThread::type_to_del = Tango::POLL_CMD;
 //
 //--------------------------------------------------------------------------
 
-PollThread::PollThread(PollThCmd &cmd,TangoMonitor &m,bool heartbeat): shared_cmd(cmd),p_mon(m),
+PollThread::PollThread(PollThCmd &cmd,TangoMonitor &m,bool heartbeat,bool steal): shared_cmd(cmd),p_mon(m),
 					    sleep(1),polling_stop(true),
 					    attr_names(1),tune_ctr(1),
-					    need_two_tuning(false),auto_upd(-1),send_heartbeat(heartbeat)
+					    need_two_tuning(false),send_heartbeat(heartbeat),
+					    work_stealing(steal),steal_idle(false),steal_wakeup(false),
+					    steal_cond(&steal_mutex),steal_victim(NULL),stolen_ctr(0),out_of_sync_ctr(0)
 {
     local_cmd.cmd_pending = false;
 
@@ -142,6 +147,14 @@ void *PollThread::run_undetached(TANGO_UNUSED(void *ptr))
 		insert_in_list(wo);
 	}
 
+//
+// In work stealing mode, make this thread known by the other threads
+// of the pool
+//
+
+	if (work_stealing == true)
+		register_steal_peer();
+
 //
 // The infinite loop
 //
@@ -187,6 +200,10 @@ void *PollThread::run_undetached(TANGO_UNUSED(void *ptr))
 			case POLL_TRIGGER:
 				one_more_trigg();
 				break;
+
+			case POLL_STEAL:
+				one_more_steal();
+				break;
 			}
 
 #ifdef _TG_WINDOWS_
@@ -264,8 +281,9 @@ PollCmdType PollThread::get_command(long tout)
 // Wait on monitor
 //
 
-	if ((shared_cmd.cmd_pending == false) && (shared_cmd.trigger == false))
+	if ((shared_cmd.cmd_pending == false) && (shared_cmd.trigger == false) && (steal_wakeup == false))
 	{
+		steal_idle = true;
 		if (works.empty() == true)
 			p_mon.wait();
 		else
@@ -273,6 +291,7 @@ PollCmdType PollThread::get_command(long tout)
 			if (tout != -1)
 				p_mon.wait(tout);
 		}
+		steal_idle = false;
 	}
 
 //
@@ -289,6 +308,11 @@ PollCmdType PollThread::get_command(long tout)
 		local_cmd = shared_cmd;
 		ret = POLL_TRIGGER;
 	}
+	else if (steal_wakeup == true)
+	{
+		steal_wakeup = false;
+		ret = POLL_STEAL;
+	}
 	else
 		ret = POLL_TIME_OUT;
 
@@ -325,7 +349,7 @@ bool pred_dev(const WorkItem &w)
 void PollThread::execute_cmd()
 {
 	WorkItem wo;
-	list<WorkItem>::iterator ite;
+	WorkItem tmp_work;
 	vector<WorkItem>::iterator et_ite;
 
 	switch (local_cmd.cmd_code)
@@ -374,32 +398,20 @@ void PollThread::execute_cmd()
 	case Tango::POLL_REM_OBJ :
 		cout5 << "Received a Rem object command" << endl;
 
-		dev_to_del = local_cmd.dev;
-		name_to_del = local_cmd.name;
-		type_to_del = local_cmd.type;
-
-#ifdef _TG_WINDOWS_
-		unsigned int i,nb_elt;
-		nb_elt = works.size();
-		ite = works.begin();
-		for (i = 0;i < nb_elt;i++)
+		if (remove_from_list(local_cmd.dev,local_cmd.type,local_cmd.name) == false)
 		{
-			if (ite->dev == PollThread::dev_to_del)
-			{
-				if (ite->type == PollThread::type_to_del)
-				{
-					if (ite->name == PollThread::name_to_del)
-					{
-						works.erase(ite);
-						break;
-					}
-				}
-			}
-			++ite;
+
+//
+// Object actually polled by this thread (which is removing it). Don't re-insert
+// it in the work list once polled
+//
+
+			WorkItemKey key(local_cmd.dev,local_cmd.type,local_cmd.name);
+			if (polled_works.find(key) != polled_works.end())
+				auto_rem.insert(key);
 		}
-#else
-		works.remove_if(pred);
-#endif
+		if (work_stealing == true)
+			purge_ready_works(local_cmd.dev,local_cmd.type,local_cmd.name,false);
 		break;
 
 //
@@ -436,18 +448,21 @@ void PollThread::execute_cmd()
 		cout5 << "Received a Rem device command" << endl;
 
 		dev_to_del = local_cmd.dev;
-#ifdef _TG_WINDOWS_
-		nb_elt = works.size();
-		ite = works.begin();
-		for (i = 0;i < nb_elt;i++)
+		remove_dev_from_list(dev_to_del);
+		if (work_stealing == true)
+			purge_ready_works(dev_to_del,POLL_CMD,"",true);
+
 		{
-			if (ite->dev == PollThread::dev_to_del)
+			set<WorkItemKey>::iterator p_ite;
+			for (p_ite = polled_works.begin();p_ite != polled_works.end();++p_ite)
 			{
-				ite = works.erase(ite);
+				if (p_ite->dev == dev_to_del)
+					auto_rem.insert(*p_ite);
 			}
-			else
-				++ite;
 		}
+
+#ifdef _TG_WINDOWS_
+		unsigned int i,nb_elt;
 		nb_elt = ext_trig_works.size();
 		et_ite = ext_trig_works.begin();
 		for (i = 0;i < nb_elt;i++)
@@ -460,8 +475,6 @@ void PollThread::execute_cmd()
 				++et_ite;
 		}
 #else
-		works.remove_if(pred_dev);
-
 		ext_trig_works.erase(remove_if(ext_trig_works.begin(),
 					       ext_trig_works.end(),
 					       pred_dev),
@@ -479,12 +492,13 @@ void PollThread::execute_cmd()
 //     polling time and polling period
 // 2 - This is executed by the polling thread itself
 // 2-1 - The command updates polling period for another object: idem than previous
-// 2-2 - The commands updates polling period for the object it is actually polled.
-//       In this case, the object is not in the work list. It has been removed from the
-//	 work list at the beginning of the "one_more_poll" method and is memorized there
-//	 Therefore, simply stores new polling period in a data member. The "one_more_poll"
-//	 method will get its new polling period before re-inserting the object in the work
-// 	 list with the new update period.
+// 2-2 - The commands updates polling period for an object it is actually polling
+//       (alone or within an attribute batch). In this case, the object is not in the
+//	 work list. It has been removed from the work list at the beginning of the
+//	 "one_more_poll" method and is memorized there. Therefore, simply stores new
+//	 polling period for this object in a data member. The "one_more_poll" method will
+//	 get its new polling period before re-inserting the object in the work list with
+//	 the new update period.
 //	 We detect this case because the object is not in any work list (either the work
 //	 list or the trigger list)
 //
@@ -496,34 +510,10 @@ void PollThread::execute_cmd()
 		name_to_del = local_cmd.name;
 		type_to_del = local_cmd.type;
 
-		ite = find_if(works.begin(),works.end(),pred);
-		if (ite != works.end())
+		if (remove_from_list(local_cmd.dev,local_cmd.type,local_cmd.name,&tmp_work) == true)
 		{
 			if (local_cmd.new_upd != 0)
 			{
-				WorkItem tmp_work = *ite;
-#ifdef _TG_WINDOWS_
-				unsigned int i,nb_elt;
-				nb_elt = works.size();
-				ite = works.begin();
-				for (i = 0;i < nb_elt;i++)
-				{
-					if (ite->dev == PollThread::dev_to_del)
-					{
-						if (ite->type == PollThread::type_to_del)
-						{
-							if (ite->name == PollThread::name_to_del)
-							{
-								works.erase(ite);
-								break;
-							}
-						}
-					}
-					++ite;
-				}
-#else
-				works.remove_if(pred);
-#endif
 				tmp_work.update = local_cmd.new_upd;
 				compute_new_date(now,local_cmd.new_upd);
 				tmp_work.wake_up_date = now;
@@ -534,33 +524,10 @@ void PollThread::execute_cmd()
 			{
 
 //
-// First, remove object from polling list and insert it in externally
+// Object already removed from polling list. Insert it in externally
 // triggered list
 //
 
-#ifdef _TG_WINDOWS_
-				unsigned int i,nb_elt;
-				nb_elt = works.size();
-				ite = works.begin();
-				for (i = 0;i < nb_elt;i++)
-				{
-					if (ite->dev == PollThread::dev_to_del)
-					{
-						if (ite->type == PollThread::type_to_del)
-						{
-							if (ite->name == PollThread::name_to_del)
-							{
-								works.erase(ite);
-								break;
-							}
-						}
-					}
-					++ite;
-				}
-#else
-				works.remove_if(pred);
-#endif
-
 				wo.dev = local_cmd.dev;
 				wo.poll_list = &(wo.dev->get_poll_obj_list());
 				wo.type = (*wo.poll_list)[local_cmd.index]->get_type();
@@ -614,7 +581,7 @@ void PollThread::execute_cmd()
 				insert_in_list(wo);
 			}
 			else
-				auto_upd = local_cmd.new_upd;
+				auto_upd[WorkItemKey(local_cmd.dev,local_cmd.type,local_cmd.name)] = local_cmd.new_upd;
 		}
 		break;
 
@@ -642,19 +609,7 @@ void PollThread::execute_cmd()
 
 	case Tango::POLL_REM_HEARTBEAT:
 		cout5 << "Received a remove heartbeat command" << endl;
-		unsigned int ii,nb_elem;
-		nb_elem = works.size();
-		ite = works.begin();
-
-		for (ii = 0;ii < nb_elem;ii++)
-		{
-			if (ite->type == EVENT_HEARTBEAT)
-			{
-				works.erase(ite);
-				break;
-			}
-			++ite;
-		}
+		remove_from_list(NULL,EVENT_HEARTBEAT,"Event heartbeat");
 		break;
 
 //
@@ -666,123 +621,729 @@ void PollThread::execute_cmd()
 		polling_stop = false;
 		break;
 
-//
-// Stop polling
-//
+//
+// Stop polling
+//
+
+	case Tango::POLL_STOP :
+		cout5 << "Received a Stop polling command" << endl;
+		polling_stop = true;
+		break;
+
+//
+// Ask polling thread to exit
+//
+
+	case Tango::POLL_EXIT :
+		cout5 << "Received an exit command" << endl;
+		if (work_stealing == true)
+			unregister_steal_peer();
+		omni_thread::exit();
+		break;
+	}
+
+//
+// Inform requesting thread that the work is done
+//
+
+
+	{
+		omni_mutex_lock sync(p_mon);
+		shared_cmd.cmd_pending = false;
+		p_mon.signal();
+	}
+
+	if (Tango::Util::_tracelevel >= 4)
+		print_list();
+
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::add_random_delay
+//
+// description : 	Add a random number of microsecond (between 0 and
+//			500000) in order to spread the date where polling
+//			should happens. This is necessary especially at device
+//			process startup when each command in send to the
+//			polling thread in a loop
+//
+// argument : in : t : The timeval structure reference
+//
+//--------------------------------------------------------------------------
+
+void PollThread::add_random_delay(struct timeval &t)
+{
+	long add_usec;
+
+	add_usec = (long)(500000. * (float)rand() / (float)RAND_MAX);
+	t.tv_usec = t.tv_usec + add_usec;
+	if (t.tv_usec >= 1000000)
+	{
+		t.tv_sec++;
+		t.tv_usec = t.tv_usec - 1000000;
+	}
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::one_more_poll
+//
+// description :
+//
+// argument : in :
+//
+//--------------------------------------------------------------------------
+
+void PollThread::one_more_poll()
+{
+	WorkItem tmp = pop_first_from_list();
+	vector<WorkItem> batch;
+
+	if (polling_stop == false)
+	{
+
+//
+// Get the other attributes of the same device which are due now.
+// They will be read with the same call
+//
+
+		if ((tmp.type == POLL_ATTR) && (tmp.dev->get_dev_idl_version() >= 3))
+			get_attr_batch(tmp,batch);
+
+//
+// Remember which works are out of the work list while they are executed. A
+// command sent by one of them to this thread (update period, remove object)
+// is applied to them when they are re-inserted
+//
+
+		polled_works.insert(WorkItemKey(tmp));
+		vector<WorkItem>::iterator p_ite;
+		for (p_ite = batch.begin();p_ite != batch.end();++p_ite)
+			polled_works.insert(WorkItemKey(*p_ite));
+
+//
+// In work stealing mode, move the other due works in the ready queue where
+// they could be stolen by idle threads. Don't execute a work if a previous
+// execution is still in progress in another thread
+//
+
+		if (work_stealing == true)
+			dispatch_due_works();
+
+		vector<WorkItem *> to_poll;
+		if ((work_stealing == false) || (discard_busy_work(tmp) == false))
+			to_poll.push_back(&tmp);
+
+		vector<WorkItem>::iterator ite;
+		for (ite = batch.begin();ite != batch.end();++ite)
+		{
+			if ((work_stealing == false) || (discard_busy_work(*ite) == false))
+				to_poll.push_back(&(*ite));
+		}
+
+		if (to_poll.size() == 1)
+			exec_work(*(to_poll[0]));
+		else if (to_poll.size() > 1)
+			poll_attr_batch(to_poll);
+	}
+
+//
+// Compute new polling date and insert work(s) in list
+//
+
+	reschedule_polled_work(tmp);
+
+	vector<WorkItem>::iterator b_ite;
+	for (b_ite = batch.begin();b_ite != batch.end();++b_ite)
+		reschedule_polled_work(*b_ite);
+
+	polled_works.clear();
+	auto_upd.clear();
+	auto_rem.clear();
+
+//
+// Execute the ready works which have not been stolen by other threads
+//
+
+	if (work_stealing == true)
+	{
+		WorkItem wo;
+		while (get_ready_work(wo) == true)
+		{
+			try
+			{
+				exec_work(wo);
+			}
+			catch (...)
+			{
+				release_ready_work(wo,false);
+				throw;
+			}
+			release_ready_work(wo,false);
+		}
+	}
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::reschedule_polled_work
+//
+// description : 	Re-insert in the work list a work executed by
+//			one_more_poll(), with its new polling period if the
+//			polling thread itself has changed it while polling.
+//			A work removed from polling while it was executed is
+//			not re-inserted
+//
+// argument : in :	- wo : The work item
+//
+//--------------------------------------------------------------------------
+
+void PollThread::reschedule_polled_work(WorkItem &wo)
+{
+	WorkItemKey key(wo);
+
+	if (auto_rem.find(key) != auto_rem.end())
+		return;
+
+	map<WorkItemKey,long>::iterator pos = auto_upd.find(key);
+	if (pos != auto_upd.end())
+		wo.update = pos->second;
+
+	compute_new_date(wo.wake_up_date,wo.update);
+	insert_in_list(wo);
+	tune_ctr--;
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::get_attr_batch
+//
+// description : 	Remove from the work list the attribute works of the
+//			same device than the first one which are due now (or
+//			within the batch window). These attributes will be read
+//			with one single device call
+//
+// argument : in :	- first : The first work item
+//			  out : - batch : The other attribute works of the device
+//
+//--------------------------------------------------------------------------
+
+void PollThread::get_attr_batch(WorkItem &first,vector<WorkItem> &batch)
+{
+	struct timeval limit = now;
+	T_ADD(limit,POLL_BATCH_WINDOW);
+
+	WorkList::iterator ite = works.begin();
+	while (ite != works.end())
+	{
+		if ((ite->wake_up_date.tv_sec > limit.tv_sec) ||
+			((ite->wake_up_date.tv_sec == limit.tv_sec) && (ite->wake_up_date.tv_usec > limit.tv_usec)))
+			break;
+
+		if ((ite->dev == first.dev) && (ite->type == POLL_ATTR))
+		{
+			batch.push_back(*ite);
+			works_idx.erase(WorkItemKey(*ite));
+			works.erase(ite++);
+		}
+		else
+			++ite;
+	}
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::exec_work
+//
+// description : 	Execute one work item according to its type
+//
+// argument : in :	- to_do : The work item
+//
+//--------------------------------------------------------------------------
+
+void PollThread::exec_work(WorkItem &to_do)
+{
+	switch (to_do.type)
+	{
+	case Tango::POLL_CMD:
+		poll_cmd(to_do);
+		break;
+
+	case Tango::POLL_ATTR:
+		poll_attr(to_do);
+		break;
+
+	case Tango::EVENT_HEARTBEAT:
+		eve_heartbeat();
+		break;
+
+	case Tango::STORE_SUBDEV:
+		store_subdev();
+		break;
+	}
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::dispatch_due_works
+//
+// description : 	In work stealing mode, move all the polling works which
+//			are already due in the ready works queue, re-schedule
+//			them and wake-up idle threads of the pool. A work which
+//			is still in the ready queue or executed by another
+//			thread is discarded.
+//
+//--------------------------------------------------------------------------
+
+void PollThread::dispatch_due_works()
+{
+	long nb_queued = 0;
+
+	while (works.empty() == false)
+	{
+		const WorkItem &first = *works.begin();
+		if ((first.type != POLL_CMD) && (first.type != POLL_ATTR))
+			break;
+		if ((first.wake_up_date.tv_sec > now.tv_sec) ||
+			((first.wake_up_date.tv_sec == now.tv_sec) && (first.wake_up_date.tv_usec > now.tv_usec)))
+			break;
+
+		WorkItem wo = pop_first_from_list();
+		bool discarded = false;
+		{
+			omni_mutex_lock sync(steal_mutex);
+			WorkItemKey key(wo);
+			if (busy_works.find(key) == busy_works.end())
+			{
+				busy_works.insert(key);
+				ready_works.push_back(wo);
+				nb_queued++;
+			}
+			else
+			{
+				out_of_sync_ctr++;
+				discarded = true;
+			}
+		}
+
+		if ((discarded == true) && (wo.type == POLL_ATTR))
+			err_out_of_sync(wo);
+
+		compute_new_date(wo.wake_up_date,wo.update);
+		insert_in_list(wo);
+		tune_ctr--;
+	}
+
+	if (nb_queued != 0)
+		wake_up_idle_peer(nb_queued);
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::is_work_busy
+//
+// description : 	Check if a work is in the ready queue or executed by
+//			another thread of the pool
+//
+// argument : in :	- wo : The work item
+//
+//--------------------------------------------------------------------------
+
+bool PollThread::is_work_busy(WorkItem &wo)
+{
+	omni_mutex_lock sync(steal_mutex);
+	return busy_works.find(WorkItemKey(wo)) != busy_works.end();
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::discard_busy_work
+//
+// description : 	In work stealing mode, discard a work (out of sync) if
+//			it is still in the ready queue or executed by another
+//			thread of the pool
+//
+// argument : in :	- wo : The work item
+//
+// This method returns true if the work has been discarded
+//
+//--------------------------------------------------------------------------
+
+bool PollThread::discard_busy_work(WorkItem &wo)
+{
+	if (is_work_busy(wo) == false)
+		return false;
+
+	{
+		omni_mutex_lock sync(steal_mutex);
+		out_of_sync_ctr++;
+	}
+	if (wo.type == POLL_ATTR)
+		err_out_of_sync(wo);
+
+	return true;
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::get_ready_work
+//
+// description : 	Get the oldest work from the ready queue. The work
+//			stays marked as busy until release_ready_work() is
+//			called
+//
+// argument : out :	- wo : The work item
+//
+// This method returns false if the ready queue is empty
+//
+//--------------------------------------------------------------------------
+
+bool PollThread::get_ready_work(WorkItem &wo)
+{
+	omni_mutex_lock sync(steal_mutex);
+	if (ready_works.empty() == true)
+		return false;
+
+	wo = ready_works.front();
+	ready_works.pop_front();
+	return true;
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::release_ready_work
+//
+// description : 	Mark a work taken from the ready queue as done
+//
+// argument : in :	- wo : The work item
+//					- stolen : Set to true if the work has been executed
+//							   by another thread
+//
+//--------------------------------------------------------------------------
+
+void PollThread::release_ready_work(WorkItem &wo,bool stolen)
+{
+	omni_mutex_lock sync(steal_mutex);
+	busy_works.erase(WorkItemKey(wo));
+	cancelled_works.erase(WorkItemKey(wo));
+	if (stolen == true)
+		stolen_ctr++;
+	steal_cond.broadcast();
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::purge_ready_works
+//
+// description : 	Remove works from the ready queue. The works of the
+//			same object(s) executed by other threads are marked
+//			as cancelled: their result will be dropped. Used
+//			before an object or a device is removed from polling.
+//			For a whole device, also wait for these works to be
+//			finished because the device may be deleted just after.
+//			A thread removing the device from a work it steals
+//			does not wait for this command (see is_stealing_from)
+//			so this does not dead-lock.
+//
+// argument : in :	- dev : The device
+//					- type : The object type
+//					- name : The object name
+//					- whole_dev : Set to true to purge all the device
+//								  works (type and name are not used)
+//
+//--------------------------------------------------------------------------
+
+void PollThread::purge_ready_works(DeviceImpl *dev,PollObjType type,const string &name,bool whole_dev)
+{
+	omni_mutex_lock sync(steal_mutex);
+	WorkItemKey key(dev,type,name);
+
+	deque<WorkItem>::iterator ite = ready_works.begin();
+	while (ite != ready_works.end())
+	{
+		if ((ite->dev == dev) && ((whole_dev == true) || ((ite->type == type) && (ite->name == name))))
+		{
+			busy_works.erase(WorkItemKey(*ite));
+			ite = ready_works.erase(ite);
+		}
+		else
+			++ite;
+	}
+
+	if (whole_dev == true)
+	{
+		set<WorkItemKey>::iterator pos = busy_works.lower_bound(key);
+		while ((pos != busy_works.end()) && (pos->dev == dev))
+		{
+			cancelled_works.insert(*pos);
+			++pos;
+		}
+	}
+	else
+	{
+		if (busy_works.find(key) != busy_works.end())
+			cancelled_works.insert(key);
+
+//
+// Don't wait for a single object. The thread executing it may be the one
+// which is removing it from polling (and which waits for this command)
+//
+
+		return;
+	}
+
+	while (true)
+	{
+		bool busy;
+		if (whole_dev == true)
+		{
+			set<WorkItemKey>::iterator pos = busy_works.lower_bound(key);
+			busy = (pos != busy_works.end()) && (pos->dev == dev);
+		}
+		else
+			busy = busy_works.find(key) != busy_works.end();
+
+		if (busy == false)
+			break;
+		steal_cond.wait();
+	}
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::one_more_steal
+//
+// description : 	This method is called when the thread has been awaken
+//			by another thread of the pool which has ready works.
+//			Steal works while the thread has time before its own
+//			next polling date.
+//
+//--------------------------------------------------------------------------
+
+void PollThread::one_more_steal()
+{
+	cout5 << "Polling thread has been awaken to steal work" << endl;
+
+	while (true)
+	{
+		long slack = -1;
+		if (works.empty() == false)
+		{
+			struct timeval current;
+#ifdef _TG_WINDOWS_
+			struct _timeb current_win;
+			_ftime(&current_win);
+			current.tv_sec = (unsigned long)current_win.time;
+			current.tv_usec = (long)current_win.millitm * 1000;
+#else
+			gettimeofday(&current,NULL);
+#endif
+			current.tv_sec = current.tv_sec - DELTA_T;
+
+			double next = (double)works.begin()->wake_up_date.tv_sec + ((double)works.begin()->wake_up_date.tv_usec / 1000000);
+			double current_d = (double)current.tv_sec + ((double)current.tv_usec / 1000000);
+			if (next <= current_d)
+				break;
+			slack = (long)((next - current_d) * 1000000);
+		}
+
+		if (steal_work(slack) == false)
+			break;
+	}
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::steal_work
+//
+// description : 	Steal one work from the back of the ready queue of
+//			another thread of the pool and execute it
+//
+// argument : in :	- slack : Time (uS) available before this thread own
+//					  next work (-1 if none). Works known to need more
+//					  time than this are not stolen.
+//
+// This method returns false if nothing has been stolen
+//
+//--------------------------------------------------------------------------
+
+bool PollThread::steal_work(long slack)
+{
+	PollThread *victim = NULL;
+	WorkItem wo;
+
+	{
+		omni_mutex_lock sync(steal_peers_mutex);
+		vector<PollThread *>::iterator ite;
+		for (ite = steal_peers.begin();ite != steal_peers.end();++ite)
+		{
+			if (*ite == this)
+				continue;
 
-	case Tango::POLL_STOP :
-		cout5 << "Received a Stop polling command" << endl;
-		polling_stop = true;
-		break;
+			omni_mutex_lock sync_peer((*ite)->steal_mutex);
+			if ((*ite)->ready_works.empty() == true)
+				continue;
 
-//
-// Ask polling thread to exit
-//
+			WorkItem &last = (*ite)->ready_works.back();
+			long needed = (last.needed_time.tv_sec * 1000000) + last.needed_time.tv_usec;
+			if ((slack != -1) && (needed > slack))
+				continue;
 
-	case Tango::POLL_EXIT :
-		cout5 << "Received an exit command" << endl;
-		omni_thread::exit();
-		break;
+			wo = last;
+			(*ite)->ready_works.pop_back();
+			victim = *ite;
+			break;
+		}
 	}
 
-//
-// Inform requesting thread that the work is done
-//
+	if (victim == NULL)
+		return false;
 
+	cout5 << "Polling thread steals work " << wo.name << endl;
 
+	steal_victim = victim;
+	try
 	{
-		omni_mutex_lock sync(p_mon);
-		shared_cmd.cmd_pending = false;
-		p_mon.signal();
+		exec_work(wo);
 	}
+	catch (...)
+	{
+		steal_victim = NULL;
+		victim->release_ready_work(wo,true);
+		throw;
+	}
+	steal_victim = NULL;
+	victim->release_ready_work(wo,true);
 
-	if (Tango::Util::_tracelevel >= 4)
-		print_list();
-
+	return true;
 }
 
 //+-------------------------------------------------------------------------
 //
-// method : 		PollThread::add_random_delay
+// method : 		PollThread::is_work_cancelled
 //
-// description : 	Add a random number of microsecond (between 0 and
-//			500000) in order to spread the date where polling
-//			should happens. This is necessary especially at device
-//			process startup when each command in send to the
-//			polling thread in a loop
+// description : 	Check if a work executed by another thread of the pool
+//			has been removed from polling in the meantime
 //
-// argument : in : t : The timeval structure reference
+// argument : in :	- wo : The work item
 //
 //--------------------------------------------------------------------------
 
-void PollThread::add_random_delay(struct timeval &t)
+bool PollThread::is_work_cancelled(WorkItem &wo)
 {
-	long add_usec;
-
-	add_usec = (long)(500000. * (float)rand() / (float)RAND_MAX);
-	t.tv_usec = t.tv_usec + add_usec;
-	if (t.tv_usec >= 1000000)
-	{
-		t.tv_sec++;
-		t.tv_usec = t.tv_usec - 1000000;
-	}
+	omni_mutex_lock sync(steal_mutex);
+	return cancelled_works.find(WorkItemKey(wo)) != cancelled_works.end();
 }
 
 //+-------------------------------------------------------------------------
 //
-// method : 		PollThread::one_more_poll
+// method : 		PollThread::is_stealing_from
 //
-// description :
+// description : 	Check if the calling thread is a polling thread
+//			executing a work stolen from the given thread. Such a
+//			thread must not wait for a command sent to this thread
 //
-// argument : in :
+// argument : in :	- owner : The polling thread owning the work
 //
 //--------------------------------------------------------------------------
 
-void PollThread::one_more_poll()
+bool PollThread::is_stealing_from(PollThread *owner)
 {
-	WorkItem tmp = works.front();
-	works.pop_front();
-
-	if (polling_stop == false)
-	{
-		switch (tmp.type)
-		{
-		case Tango::POLL_CMD:
-			poll_cmd(tmp);
-			break;
+	PollThread *self = dynamic_cast<PollThread *>(omni_thread::self());
+	return (self != NULL) && (owner != NULL) && (self->steal_victim == owner);
+}
 
-		case Tango::POLL_ATTR:
-			poll_attr(tmp);
-			break;
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::wake_up_idle_peer
+//
+// description : 	Wake-up idle thread(s) of the pool in order for them
+//			to steal ready works
+//
+// argument : in :	- nb : The maximum number of threads to wake-up
+//
+//--------------------------------------------------------------------------
 
-		case Tango::EVENT_HEARTBEAT:
-			eve_heartbeat();
-			break;
+void PollThread::wake_up_idle_peer(long nb)
+{
+	omni_mutex_lock sync(steal_peers_mutex);
+	vector<PollThread *>::iterator ite;
+	for (ite = steal_peers.begin();(ite != steal_peers.end()) && (nb > 0);++ite)
+	{
+		if (*ite == this)
+			continue;
 
-		case Tango::STORE_SUBDEV:
-			store_subdev();
-			break;
+		omni_mutex_lock sync_peer((*ite)->p_mon);
+		if (((*ite)->steal_idle == true) && ((*ite)->steal_wakeup == false))
+		{
+			(*ite)->steal_wakeup = true;
+			(*ite)->p_mon.signal();
+			nb--;
 		}
 	}
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::register_steal_peer
+//
+// description : 	Register this thread in the work stealing threads list
+//
+//--------------------------------------------------------------------------
 
+void PollThread::register_steal_peer()
+{
+	omni_mutex_lock sync(steal_peers_mutex);
+	steal_peers.push_back(this);
+}
+
+//+-------------------------------------------------------------------------
 //
-// For case where the polling thread itself modify the polling
-// period of the object it already polls
+// method : 		PollThread::unregister_steal_peer
 //
+// description : 	Unregister this thread from the work stealing threads
+//			list, clear its ready queue and wait for its works
+//			executed by other threads to be finished
+//
+//--------------------------------------------------------------------------
 
-	if (auto_upd != -1)
+void PollThread::unregister_steal_peer()
+{
 	{
-		tmp.update = auto_upd;
-		auto_upd = -1;
+		omni_mutex_lock sync(steal_peers_mutex);
+		vector<PollThread *>::iterator pos = find(steal_peers.begin(),steal_peers.end(),this);
+		if (pos != steal_peers.end())
+			steal_peers.erase(pos);
 	}
 
+	omni_mutex_lock sync(steal_mutex);
+	deque<WorkItem>::iterator ite;
+	for (ite = ready_works.begin();ite != ready_works.end();++ite)
+		busy_works.erase(WorkItemKey(*ite));
+	ready_works.clear();
+
+	while (busy_works.empty() == false)
+		steal_cond.wait();
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::get_steal_stats
 //
-// Compute new polling date and insert work in list
+// description : 	Get the work stealing statistics of this thread
 //
+// argument : out :	- stolen : Number of works executed by another thread
+//					- out_of_sync : Number of works discarded because
+//									late or still busy
+//
+//--------------------------------------------------------------------------
 
-	compute_new_date(tmp.wake_up_date,tmp.update);
-	insert_in_list(tmp);
-	tune_ctr--;
+void PollThread::get_steal_stats(long &stolen,long &out_of_sync)
+{
+	omni_mutex_lock sync(steal_mutex);
+	stolen = stolen_ctr;
+	out_of_sync = out_of_sync_ctr;
 }
 
 //+-------------------------------------------------------------------------
@@ -864,7 +1425,7 @@ void PollThread::one_more_trigg()
 
 void PollThread::print_list()
 {
-	list<WorkItem>::iterator ite;
+	WorkList::iterator ite;
 	long nb_elt,i;
 
 	nb_elt = works.size();
@@ -905,7 +1466,10 @@ void PollThread::print_list()
 // method : 		PollThread::insert_in_list
 //
 // description : 	To insert (at the correct place) a new Work Item in
-//			the work list
+//			the work list. The work list is sorted on the wake
+//			up date and the object is also registered in the work
+//			list index. If the object was already in the list, its
+//			previous entry is replaced.
 //
 // argument: In :	- new_work : The new work item
 //
@@ -913,29 +1477,85 @@ void PollThread::print_list()
 
 void PollThread::insert_in_list(WorkItem &new_work)
 {
-	list<WorkItem>::iterator ite;
-	for (ite = works.begin();ite != works.end();++ite)
+	WorkItemKey key(new_work);
+	WorkIndex::iterator pos = works_idx.find(key);
+	if (pos != works_idx.end())
 	{
-		if (ite->wake_up_date.tv_sec < new_work.wake_up_date.tv_sec)
-			continue;
-		else if (ite->wake_up_date.tv_sec == new_work.wake_up_date.tv_sec)
-		{
-			if (ite->wake_up_date.tv_usec < new_work.wake_up_date.tv_usec)
-				continue;
-			else
-			{
-				works.insert(ite,new_work);
-				return;
-			}
-		}
-		else
-		{
-			works.insert(ite,new_work);
-			return;
-		}
+		works.erase(pos->second);
+		pos->second = works.insert(new_work);
+	}
+	else
+		works_idx.insert(make_pair(key,works.insert(new_work)));
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::remove_from_list
+//
+// description : 	To remove one object from the work list
+//
+// argument: In :	- dev : The device pointer
+//					- type : The object type
+//					- name : The object name
+//			 Out :	- ret : If not NULL, a copy of the removed work item
+//
+// This method returns true if the object was found in the work list
+//
+//--------------------------------------------------------------------------
+
+bool PollThread::remove_from_list(DeviceImpl *dev,PollObjType type,const string &name,WorkItem *ret)
+{
+	WorkIndex::iterator pos = works_idx.find(WorkItemKey(dev,type,name));
+	if (pos == works_idx.end())
+		return false;
+
+	if (ret != NULL)
+		*ret = *(pos->second);
+	works.erase(pos->second);
+	works_idx.erase(pos);
+
+	return true;
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::remove_dev_from_list
+//
+// description : 	To remove all the objects belonging to a device from
+//			the work list. The index is sorted on the device pointer
+//			first, therefore all the device objects are contiguous
+//			in the index
+//
+// argument: In :	- dev : The device pointer
+//
+//--------------------------------------------------------------------------
+
+void PollThread::remove_dev_from_list(DeviceImpl *dev)
+{
+	WorkIndex::iterator pos = works_idx.lower_bound(WorkItemKey(dev,POLL_CMD,""));
+	while ((pos != works_idx.end()) && (pos->first.dev == dev))
+	{
+		works.erase(pos->second);
+		works_idx.erase(pos++);
 	}
-	if (ite == works.end())
-		works.push_back(new_work);
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::pop_first_from_list
+//
+// description : 	Remove the first work item (the one with the closest
+//			wake up date) from the work list and return it
+//
+//--------------------------------------------------------------------------
+
+WorkItem PollThread::pop_first_from_list()
+{
+	WorkItem first = *works.begin();
+	works_idx.erase(WorkItemKey(first));
+	works.erase(works.begin());
+
+	return first;
 }
 
 //+-------------------------------------------------------------------------
@@ -954,7 +1574,8 @@ void PollThread::insert_in_list(WorkItem &new_work)
 
 void PollThread::tune_list(bool from_needed, long min_delta)
 {
-	list<WorkItem>::iterator ite,ite_next,ite_prev;
+	WorkList::iterator ite;
+	vector<WorkItem>::iterator ite_next,ite_prev;
 
 	unsigned long nb_works = works.size();
 	cout4 << "Entering tuning list. The list has " << nb_works << " item(s)" << endl;
@@ -1012,17 +1633,17 @@ void PollThread::tune_list(bool from_needed, long min_delta)
 // Now build a new tuned list
 //
 
-		list<WorkItem> new_works;
-		new_works.push_front(works.front());
+		vector<WorkItem> new_works;
+		new_works.reserve(nb_works);
+		new_works.push_back(*works.begin());
 
 		ite = works.begin();
-		ite_prev = new_works.begin();
-
-		for (++ite;ite != works.end();++ite,++ite_prev)
+		for (++ite;ite != works.end();++ite)
 		{
-			long needed_time_usec = (ite_prev->needed_time.tv_sec * 1000000) + ite_prev->needed_time.tv_usec;
+			const WorkItem &prev = new_works.back();
+			long needed_time_usec = (prev.needed_time.tv_sec * 1000000) + prev.needed_time.tv_usec;
 			WorkItem wo = *ite;
-			wo.wake_up_date = ite_prev->wake_up_date;
+			wo.wake_up_date = prev.wake_up_date;
 			T_ADD(wo.wake_up_date,needed_time_usec + max_delta_needed);
 			new_works.push_back(wo);
 		}
@@ -1031,18 +1652,20 @@ void PollThread::tune_list(bool from_needed, long min_delta)
 // Replace work list
 //
 
-		works = new_works;
+		rebuild_list(new_works);
 	}
 	else
 	{
-		ite_next = works.begin();
-		ite = ite_next;
+		vector<WorkItem> new_works(works.begin(),works.end());
+
+		ite_next = new_works.begin();
+		ite_prev = ite_next;
 		++ite_next;
 
 		for (unsigned int i = 1;i < nb_works;i++)
 		{
 			long diff;
-			T_DIFF(ite->wake_up_date,ite_next->wake_up_date,diff);
+			T_DIFF(ite_prev->wake_up_date,ite_next->wake_up_date,diff);
 
 //
 // If delta time between works is less than min,
@@ -1052,15 +1675,38 @@ void PollThread::tune_list(bool from_needed, long min_delta)
 			if (diff < min_delta)
 				T_ADD(ite_next->wake_up_date,min_delta - diff);
 
-			++ite;
+			++ite_prev;
 			++ite_next;
 		}
+
+		rebuild_list(new_works);
 	}
 
 	cout4 << "Tuning list done" << endl;
 	print_list();
 }
 
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::rebuild_list
+//
+// description : 	Replace the work list (and its index) by the content
+//			of a vector of work items
+//
+// argument: In :	- new_works : The new work items
+//
+//--------------------------------------------------------------------------
+
+void PollThread::rebuild_list(vector<WorkItem> &new_works)
+{
+	works.clear();
+	works_idx.clear();
+
+	vector<WorkItem>::iterator ite;
+	for (ite = new_works.begin();ite != new_works.end();++ite)
+		works_idx.insert(make_pair(WorkItemKey(*ite),works.insert(*ite)));
+}
+
 //+-------------------------------------------------------------------------
 //
 // method : 		PollThread::compute_new_date
@@ -1111,7 +1757,7 @@ void PollThread::compute_sleep_time()
 	if (works.empty() == false)
 	{
 		double next,after_d,diff;
-		next = (double)works.front().wake_up_date.tv_sec + ((double)works.front().wake_up_date.tv_usec / 1000000);
+		next = (double)works.begin()->wake_up_date.tv_sec + ((double)works.begin()->wake_up_date.tv_usec / 1000000);
 		after_d = (double)after.tv_sec + ((double)after.tv_usec / 1000000);
 		diff = next - after_d;
 
@@ -1124,16 +1770,19 @@ void PollThread::compute_sleep_time()
 				while((diff < 0) && (fabs(diff) > DISCARD_THRESHOLD))
 				{
 					cout5 << "Discard one elt !!!!!!!!!!!!!" << endl;
-					WorkItem tmp = works.front();
+					WorkItem tmp = pop_first_from_list();
 					if (tmp.type == POLL_ATTR)
 						err_out_of_sync(tmp);
+					{
+						omni_mutex_lock sync(steal_mutex);
+						out_of_sync_ctr++;
+					}
 
 					compute_new_date(tmp.wake_up_date,tmp.update);
 					insert_in_list(tmp);
-					works.pop_front();
 					tune_ctr--;
 
-					next = (double)works.front().wake_up_date.tv_sec + ((double)works.front().wake_up_date.tv_usec / 1000000);
+					next = (double)works.begin()->wake_up_date.tv_sec + ((double)works.begin()->wake_up_date.tv_usec / 1000000);
 					diff = next - after_d;
 				}
 				if (fabs(diff) < DISCARD_THRESHOLD)
@@ -1324,6 +1973,10 @@ void PollThread::poll_cmd(WorkItem &to_do)
 	try
 	{
 		to_do.dev->get_poll_monitor().get_monitor();
+		if ((steal_victim != NULL) && (steal_victim->is_work_cancelled(to_do) == true))
+			Except::throw_exception((const char *)"API_PollObjNotFound",
+						(const char *)"Polled object removed while it was executed",
+						(const char *)"PollThread::poll_cmd");
 		ite = to_do.dev->get_polled_obj_by_type_name(to_do.type,to_do.name);
 		if (cmd_failed == false)
 			(*ite)->insert_data(argout,before_cmd,needed_time);
@@ -1369,7 +2022,6 @@ void PollThread::poll_attr(WorkItem &to_do)
 	Tango::AttributeValueList_4 *argout_4 = NULL;
 	Tango::DevFailed *save_except = NULL;
 	bool attr_failed = false;
-	vector<PollObj *>::iterator ite;
 
 	long idl_vers = to_do.dev->get_dev_idl_version();
 	try
@@ -1455,6 +2107,178 @@ void PollThread::poll_attr(WorkItem &to_do)
 		save_except = new Tango::DevFailed(e);
 	}
 
+	store_attr(to_do,idl_vers,argout,argout_3,argout_4,save_except,attr_failed,before_cmd,needed_time);
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::poll_attr_batch
+//
+// description : 	Read several attributes of the same device with one
+//			call (one read_attr_hardware) and store each result in
+//			its own ring buffer. Only used for device with IDL
+//			release 3 or more where one attribute in error does not
+//			trigger an exception for the whole call
+//
+// argument : in :	- to_do : The work items (same device)
+//
+//--------------------------------------------------------------------------
+
+void PollThread::poll_attr_batch(vector<WorkItem *> &to_do)
+{
+	DeviceImpl *dev = to_do[0]->dev;
+	unsigned long nb_attr = to_do.size();
+	unsigned long loop;
+
+	cout5 << "----------> Time = " << now.tv_sec << ","
+	      << setw(6) << setfill('0') << now.tv_usec
+	      << " Dev name = " << dev->get_name()
+          << ", " << nb_attr << " attributes read in one call" << endl;
+
+	struct timeval before_cmd,after_cmd,needed_time;
+#ifdef _TG_WINDOWS_
+	struct _timeb before_win,after_win;
+	LARGE_INTEGER before,after;
+#endif
+	Tango::AttributeValueList_3 *argout_3 = NULL;
+	Tango::AttributeValueList_4 *argout_4 = NULL;
+	Tango::DevFailed *save_except = NULL;
+	bool attr_failed = false;
+
+	long idl_vers = dev->get_dev_idl_version();
+
+	Tango::DevVarStringArray names(nb_attr);
+	names.length(nb_attr);
+	for (loop = 0;loop < nb_attr;loop++)
+		names[loop] = to_do[loop]->name.c_str();
+
+#ifdef _TG_WINDOWS_
+	if (ctr_frequency != 0)
+		QueryPerformanceCounter(&before);
+	_ftime(&before_win);
+	before_cmd.tv_sec = (unsigned long)before_win.time;
+	before_cmd.tv_usec = (long)before_win.millitm * 1000;
+#else
+	gettimeofday(&before_cmd,NULL);
+#endif
+	before_cmd.tv_sec = before_cmd.tv_sec - DELTA_T;
+
+//
+// Read the attributes
+//
+
+	try
+	{
+		if (idl_vers >= 4)
+			argout_4 = (static_cast<Device_4Impl *>(dev))->read_attributes_4(names,Tango::DEV,dummy_cl_id);
+		else
+			argout_3 = (static_cast<Device_3Impl *>(dev))->read_attributes_3(names,Tango::DEV);
+	}
+	catch (Tango::DevFailed &e)
+	{
+		attr_failed = true;
+		save_except = new Tango::DevFailed(e);
+	}
+
+#ifdef _TG_WINDOWS_
+	if (ctr_frequency != 0)
+	{
+		QueryPerformanceCounter(&after);
+
+		needed_time.tv_sec = 0;
+		needed_time.tv_usec = (long)((double)(after.QuadPart - before.QuadPart) * ctr_frequency);
+	}
+	else
+	{
+		_ftime(&after_win);
+		after_cmd.tv_sec = (unsigned long)after_win.time;
+		after_cmd.tv_usec = (long)after_win.millitm * 1000;
+
+		after_cmd.tv_sec = after_cmd.tv_sec - DELTA_T;
+		time_diff(before_cmd,after_cmd,needed_time);
+	}
+#else
+	gettimeofday(&after_cmd,NULL);
+	after_cmd.tv_sec = after_cmd.tv_sec - DELTA_T;
+	time_diff(before_cmd,after_cmd,needed_time);
+#endif
+
+//
+// For the work list tuning, each work is charged with its share of the
+// reading time
+//
+
+	struct timeval share;
+	double share_d = ((double)needed_time.tv_sec + ((double)needed_time.tv_usec / 1000000)) / nb_attr;
+	share.tv_sec = (long)share_d;
+	share.tv_usec = (long)((share_d - share.tv_sec) * 1000000);
+
+//
+// Split the result in one list per attribute (the ring buffer takes ownership
+// of it), then fire events and store data as for a single attribute.
+// Attribute mutexes are released once the data are copied
+//
+
+	for (loop = 0;loop < nb_attr;loop++)
+	{
+		to_do[loop]->needed_time = share;
+
+		Tango::AttributeValueList_3 *att_3 = NULL;
+		Tango::AttributeValueList_4 *att_4 = NULL;
+		Tango::DevFailed *att_except = NULL;
+
+		if (attr_failed == true)
+			att_except = new Tango::DevFailed(*save_except);
+		else if (idl_vers >= 4)
+		{
+			att_4 = new Tango::AttributeValueList_4(1);
+			att_4->length(1);
+			(*att_4)[0] = (*argout_4)[loop];
+			(*att_4)[0].set_attr_mutex(NULL);
+			(*argout_4)[loop].rel_attr_mutex();
+		}
+		else
+		{
+			att_3 = new Tango::AttributeValueList_3(1);
+			att_3->length(1);
+			(*att_3)[0] = (*argout_3)[loop];
+		}
+
+		store_attr(*(to_do[loop]),idl_vers,NULL,att_3,att_4,att_except,attr_failed,before_cmd,needed_time,true);
+	}
+
+	delete argout_4;
+	delete argout_3;
+	delete save_except;
+}
+
+//+-------------------------------------------------------------------------
+//
+// method : 		PollThread::store_attr
+//
+// description : 	Fire events for an attribute which has just been read
+//			and store the result in the device ring buffer
+//
+// argument : in :	- to_do : The work item
+//					- idl_vers : The device IDL version
+//					- argout, argout_3, argout_4 : The read value (according
+//					  to the device IDL version)
+//					- save_except : The exception (if the reading failed)
+//					- attr_failed : The reading failed flag
+//					- before_cmd : The reading date
+//					- needed_time : The time needed for the reading
+//					- data_copied : Set to true if the value does not
+//					  reference the user data any more (IDL 4)
+//
+//--------------------------------------------------------------------------
+
+void PollThread::store_attr(WorkItem &to_do,long idl_vers,Tango::AttributeValueList *argout,
+							Tango::AttributeValueList_3 *argout_3,Tango::AttributeValueList_4 *argout_4,
+							Tango::DevFailed *save_except,bool attr_failed,
+							struct timeval &before_cmd,struct timeval &needed_time,bool data_copied)
+{
+	vector<PollObj *>::iterator ite;
+
 //
 // Starting with IDl release 3, an attribute in error is not an exception
 // any more. Re-create one.
@@ -1612,11 +2436,15 @@ void PollThread::poll_attr(WorkItem &to_do)
 	try
 	{
 		to_do.dev->get_poll_monitor().get_monitor();
+		if ((steal_victim != NULL) && (steal_victim->is_work_cancelled(to_do) == true))
+			Except::throw_exception((const char *)"API_PollObjNotFound",
+						(const char *)"Polled object removed while it was executed",
+						(const char *)"PollThread::store_attr");
 		ite = to_do.dev->get_polled_obj_by_type_name(to_do.type,to_do.name);
 		if (attr_failed == false)
 		{
 			if (idl_vers >= 4)
-				(*ite)->insert_data(argout_4,before_cmd,needed_time);
+				(*ite)->insert_data(argout_4,before_cmd,needed_time,data_copied == false);
 			else if (idl_vers == 3)
 				(*ite)->insert_data(argout_3,before_cmd,needed_time);
 			else
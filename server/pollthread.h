@@ -40,6 +40,9 @@
 #include <pollobj.h>
 
 #include <list>
+#include <set>
+#include <map>
+#include <deque>
 
 #ifdef _TG_WINDOWS_
 	#include <sys/types.h>
@@ -82,11 +85,55 @@ struct WorkItem
 	struct timeval		needed_time;	// Time needed to execute action
 };
 
+//=============================================================================
+//
+//			The work list types
+//
+// description :	The work list is kept sorted on the wake up date in a
+//			multiset. A second map indexed on the object identity
+//			(device, type, name) allows finding, removing or updating
+//			one object in O(log n) without walking the whole list.
+//
+//=============================================================================
+
+struct WorkItemDateComp
+{
+	bool operator()(const WorkItem &lhs,const WorkItem &rhs) const
+	{
+		if (lhs.wake_up_date.tv_sec != rhs.wake_up_date.tv_sec)
+			return lhs.wake_up_date.tv_sec < rhs.wake_up_date.tv_sec;
+		return lhs.wake_up_date.tv_usec < rhs.wake_up_date.tv_usec;
+	}
+};
+
+struct WorkItemKey
+{
+	WorkItemKey(DeviceImpl *d,PollObjType t,const string &n):dev(d),type(t),name(n) {}
+	WorkItemKey(const WorkItem &w):dev(w.dev),type(w.type),name(w.name) {}
+
+	bool operator<(const WorkItemKey &rhs) const
+	{
+		if (dev != rhs.dev)
+			return dev < rhs.dev;
+		if (type != rhs.type)
+			return type < rhs.type;
+		return name < rhs.name;
+	}
+
+	DeviceImpl			*dev;
+	PollObjType			type;
+	string				name;
+};
+
+typedef multiset<WorkItem,WorkItemDateComp>		WorkList;
+typedef map<WorkItemKey,WorkList::iterator>		WorkIndex;
+
 enum PollCmdType
 {
 	POLL_TIME_OUT,
 	POLL_COMMAND,
-	POLL_TRIGGER
+	POLL_TRIGGER,
+	POLL_STEAL
 };
 
 //=============================================================================
@@ -96,6 +143,15 @@ enum PollCmdType
 // description :	Class to store all the necessary information for the
 //			polling thread. It's run() method is the thread code
 //
+//			In work stealing mode, when several works are due at the
+//			same time, the thread moves all but the first one in its
+//			ready works queue. Idle threads of the pool are then awaken
+//			and steal works from the back of this queue while the owner
+//			thread executes them from its front. An object which is
+//			still in the queue or executed by another thread when it
+//			is due again is discarded (out of sync) in order to keep
+//			its polling ring ordered.
+//
 //=============================================================================
 
 class TangoMonitor;
@@ -103,13 +159,18 @@ class TangoMonitor;
 class PollThread: public omni_thread
 {
 public:
-	PollThread(PollThCmd &,TangoMonitor &,bool);
+	PollThread(PollThCmd &,TangoMonitor &,bool,bool work_stealing = false);
 
 	void *run_undetached(void *);
 	void start() {start_undetached();}
 	void execute_cmd();
 	void set_local_cmd(PollThCmd &cmd) {local_cmd = cmd;}
 
+	bool is_work_stealing() {return work_stealing;}
+	void get_steal_stats(long &,long &);
+	bool is_work_cancelled(WorkItem &);
+	static bool is_stealing_from(PollThread *);
+
 protected:
 	PollCmdType get_command(long);
 	void one_more_poll();
@@ -119,19 +180,43 @@ protected:
 	void time_diff(struct timeval &,struct timeval &,struct timeval &);
 	void poll_cmd(WorkItem &);
 	void poll_attr(WorkItem &);
+	void poll_attr_batch(vector<WorkItem *> &);
+	void store_attr(WorkItem &,long,Tango::AttributeValueList *,Tango::AttributeValueList_3 *,
+					Tango::AttributeValueList_4 *,Tango::DevFailed *,bool,struct timeval &,
+					struct timeval &,bool data_copied = false);
+	void get_attr_batch(WorkItem &,vector<WorkItem> &);
+	void reschedule_polled_work(WorkItem &);
 	void eve_heartbeat();
 	void store_subdev();
 
 	void print_list();
 	void insert_in_list(WorkItem &);
+	bool remove_from_list(DeviceImpl *,PollObjType,const string &,WorkItem *ret = NULL);
+	void remove_dev_from_list(DeviceImpl *);
+	WorkItem pop_first_from_list();
+	void rebuild_list(vector<WorkItem> &);
 	void add_random_delay(struct timeval &);
 	void tune_list(bool,long);
 	void err_out_of_sync(WorkItem &);
 
+	void exec_work(WorkItem &);
+	void dispatch_due_works();
+	bool is_work_busy(WorkItem &);
+	bool discard_busy_work(WorkItem &);
+	bool get_ready_work(WorkItem &);
+	void release_ready_work(WorkItem &,bool);
+	void purge_ready_works(DeviceImpl *,PollObjType,const string &,bool);
+	void one_more_steal();
+	bool steal_work(long);
+	void wake_up_idle_peer(long);
+	void register_steal_peer();
+	void unregister_steal_peer();
+
 	PollThCmd			&shared_cmd;
 	TangoMonitor		&p_mon;
 
-	list<WorkItem>		works;
+	WorkList			works;
+	WorkIndex			works_idx;
 	vector<WorkItem>	ext_trig_works;
 
 	PollThCmd			local_cmd;
@@ -154,16 +239,33 @@ private:
 	AttributeValue_4 	dummy_att4;
 	long				tune_ctr;
 	bool				need_two_tuning;
-	long				auto_upd;
+	set<WorkItemKey>	polled_works;		// Works out of the list while one_more_poll() executes them
+	map<WorkItemKey,long>	auto_upd;		// New period of polled works, set by themselves
+	set<WorkItemKey>	auto_rem;			// Polled works removed from polling by themselves
 	bool				send_heartbeat;
 
 	ClntIdent 			dummy_cl_id;
 	CppClntIdent 		cci;
 
+	bool				work_stealing;		// Work stealing mode flag
+	bool				steal_idle;			// Thread waiting (protected by p_mon)
+	bool				steal_wakeup;		// Wake-up to steal (protected by p_mon)
+	omni_mutex			steal_mutex;		// Protect ready/busy works and counters
+	omni_condition		steal_cond;
+	deque<WorkItem>		ready_works;		// Due works which may be stolen
+	set<WorkItemKey>	busy_works;			// Works in ready queue or executed by a peer
+	set<WorkItemKey>	cancelled_works;	// Busy works removed from polling (result dropped)
+	PollThread			*steal_victim;		// Owner of the work this thread is stealing
+	long				stolen_ctr;			// Works executed by a peer thread
+	long				out_of_sync_ctr;	// Works discarded because late or busy
+
 public:
 	static DeviceImpl 	*dev_to_del;
 	static string	   	name_to_del;
 	static PollObjType	type_to_del;
+
+	static omni_mutex			steal_peers_mutex;
+	static vector<PollThread *>	steal_peers;
 };
 
 
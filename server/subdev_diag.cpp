@@ -466,7 +466,12 @@ void SubDevDiag::get_sub_devices_from_cache()
 
 			try
 			{
-				const DevVarStringArray *property_values = db_cache->get_dev_property(property_names);
+				DevVarStringArray cache_values;
+				{
+					omni_mutex_lock guard(tg->get_database()->get_db_cache_mutex());
+					cache_values = *(db_cache->get_dev_property(property_names));
+				}
+				const DevVarStringArray *property_values = &cache_values;
 				if ( atol((*property_values)[3]) > 0 )
 				{
 					// if the device is the admin device, set dev_name to ""
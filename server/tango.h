@@ -105,6 +105,7 @@
 #include <except.h>
 #include <attrmanip.h>
 #include <seqvec.h>
+#include <numconv.h>
 
 #if !defined(TANGO_CLIENT) && defined TANGO_HAS_LOG4TANGO
 	#include <log4tango.h>
@@ -81,10 +81,28 @@ namespace Tango
 #define		POLL_LOOP_NB			500
 #define		ONE_SECOND				1000000
 #define		DISCARD_THRESHOLD		0.02
+#define		POLL_BATCH_WINDOW		2000
 
 #define		DEFAULT_TIMEOUT			3200
 #define		DEFAULT_POLL_OLD_FACTOR	4
 
+//
+// DevPollStatusBin command: number of doubles per polled object and the
+// default client side poll period cache validity (mS, 0 = no cache)
+//
+
+#define		POLL_STATUS_BIN_FIELDS	10
+#define		POLL_STATUS_BIN_DELTA	4		// Number of delta t between records
+#define		POLL_STATUS_CACHE_TTL	0
+
+//
+// ReadAttrMultiDev command (one read for several devices of the same server)
+//
+
+#define		MULTI_DEV_READ_FORMAT	"AttributeValueList_4"
+#define		MULTI_DEV_READ_MAX_DEV	16		// Max number of devices in one command (one thread each)
+#define		GROUP_FAN_IN_MIN_DEV	2		// Min number of group members in one server to use it
+
 #define		TG_IMP_MINOR_TO			10
 #define		TG_IMP_MINOR_DEVFAILED	11
 #define		TG_IMP_MINOR_NON_DEVFAILED	12
@@ -93,6 +111,7 @@ namespace Tango
 #define		DATABASE_CLASS			"DataBase"
 
 #define		TANGO_FLOAT_PRECISION	15
+#define		TANGO_NUM_BUF_SIZE		32		// Enough for any number written by num_to_str()
 
 //
 // Event related define
@@ -104,6 +123,7 @@ namespace Tango
 #define		DELTA_PERIODIC				0.98  // Using a delta of 2% only for times < 5000 ms
 #define     DELTA_PERIODIC_LONG			100   // For times > 5000ms only keep a delta of 100ms
 #define		HEARTBEAT					"Event heartbeat"
+#define		EVENT_CMP_BLOCK_SIZE		512   // Bytes compared at once when detecting change
 
 //
 // ZMQ event system related define
@@ -115,8 +135,14 @@ namespace Tango
 #define     HEARTBEAT_METHOD_NAME       "push_heartbeat_event"
 #define     EVENT_METHOD_NAME           "push_zmq_event"
 #define     HEARTBEAT_EVENT_NAME        "heartbeat"
+#define     BATCH_EVENT_NAME            "batch"
+#define     BATCH_EVENT_CLIENT          "batch"
+#define     EVENT_BATCH_MAX             100
+#define     EVENT_BULK_SUBSCRIPTION_MAX 500
 #define     CTRL_SOCK_ENDPOINT          "inproc://control"
 #define     MCAST_PROT                  "pgm://"
+#define     IPC_PROT                    "ipc://"
+#define     IPC_ENDPOINT_PREFIX         "/tmp/tango-zmq-"
 #define     MCAST_HOPS                  5
 #define     PGM_RATE                    80 * 1024
 #define     PGM_IVL                     20 * 1000
@@ -164,6 +190,14 @@ namespace Tango
 #define		DB_RECONNECT_TIMEOUT	20000
 #define		DB_TIMEOUT				13000
 #define		DB_START_PHASE_RETRIES	3
+#define		DB_PROP_CACHE_PURGE		5000	// Property cache size triggering expired entries removal
+
+//
+// File database update journal
+//
+
+#define		FILEDB_JOURNAL_EXT		".journal"
+#define		FILEDB_JOURNAL_MAX		256		// Journal records triggering a file compaction
 
 //
 // Time to wait before trying to reconnect after
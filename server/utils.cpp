@@ -1976,6 +1976,7 @@ DeviceImpl *Util::get_device_by_name(const string &dev_name)
 			if (ret_ptr != NULL)
 			{
 				ret_ptr->set_alias_name_lower(dev_name_lower);
+				register_device_name(dev_name_lower,ret_ptr);
 			}
 
 		}
@@ -2000,6 +2001,18 @@ DeviceImpl *Util::get_device_by_name(const string &dev_name)
 
 DeviceImpl *Util::find_device_name_core(string &dev_name)
 {
+
+//
+// First, search in the device name map
+//
+
+	{
+		omni_mutex_lock oml(ext->dev_name_map_mutex);
+		map<string,DeviceImpl *>::iterator ite = ext->dev_name_map.find(dev_name);
+		if (ite != ext->dev_name_map.end())
+			return ite->second;
+	}
+
 //
 // Retrieve class list. Don't use the get_dserver_device() method followed by
 // the get_class_list(). In case of several classes embedded within
@@ -2081,6 +2094,52 @@ DeviceImpl *Util::get_device_by_name(const char *dev_name)
 	return get_device_by_name(name_str);
 }
 
+//+----------------------------------------------------------------------------
+//
+// method : 		Util::register_device_name()
+//
+// description : 	Add a device in the map used to find a device from its
+//			name (or alias)
+//
+// in : 		- name : The lower case device name (or alias)
+//			- dev : The device
+//
+//-----------------------------------------------------------------------------
+
+void Util::register_device_name(string &name,DeviceImpl *dev)
+{
+	omni_mutex_lock oml(ext->dev_name_map_mutex);
+	ext->dev_name_map[name] = dev;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		Util::unregister_device_name()
+//
+// description : 	Remove a device (name and alias) from the map used to find
+//			a device from its name
+//
+// in : 		- dev : The device
+//
+//-----------------------------------------------------------------------------
+
+void Util::unregister_device_name(DeviceImpl *dev)
+{
+	omni_mutex_lock oml(ext->dev_name_map_mutex);
+
+	map<string,DeviceImpl *>::iterator ite = ext->dev_name_map.find(dev->get_name_lower());
+	if (ite != ext->dev_name_map.end() && ite->second == dev)
+		ext->dev_name_map.erase(ite);
+
+	string &alias_name = dev->get_alias_name_lower();
+	if (alias_name.size() != 0)
+	{
+		ite = ext->dev_name_map.find(alias_name);
+		if (ite != ext->dev_name_map.end() && ite->second == dev)
+			ext->dev_name_map.erase(ite);
+	}
+}
+
 //+----------------------------------------------------------------------------
 //
 // method : 		Util::get_dserver_device()
@@ -495,6 +495,47 @@ public:
  * @return The maximun number of threads in the polling threads pool
  */
 	unsigned long get_polling_threads_pool_size() {return ext->poll_pool_size;}
+
+/**
+ * Set the polling threads pool work stealing mode
+ *
+ * When set, the polling threads of the pool could execute polling works
+ * which are due in another thread of the pool while they are idle.
+ * This mode is used only for polling threads created after this call.
+ *
+ * @param val The work stealing mode flag
+ */
+	void set_polling_threads_work_stealing(bool val) {ext->poll_work_stealing = val;}
+
+/**
+ * Get the polling threads pool work stealing mode
+ *
+ * @return The work stealing mode flag
+ */
+	bool get_polling_threads_work_stealing() {return ext->poll_work_stealing;}
+//@}
+
+/**@name Device startup related methods */
+//@{
+/**
+ * Set the number of threads used to create devices at server startup
+ *
+ * When set to a value greater than 1, the device factory of the different
+ * classes embedded in the device server are executed in parallel by a pool
+ * of this size. This is usable only if the classes do not depend on each
+ * other during device creation. The DServer device property
+ * device_startup_threads (if defined) overwrites this value.
+ *
+ * @param nb The thread number (0 or 1 means sequential startup)
+ */
+	void set_device_startup_threads(unsigned long nb) {ext->dev_startup_th_nb = nb;}
+
+/**
+ * Get the number of threads used to create devices at server startup
+ *
+ * @return The thread number
+ */
+	unsigned long get_device_startup_threads() {return ext->dev_startup_th_nb;}
 //@}
 
 /**@Miscellaneous methods */
@@ -785,7 +826,8 @@ private:
               nd_event_supplier(NULL),py_interp(NULL),py_ds(false),py_dbg(false),db_cache(NULL),
               inter(NULL),svr_starting(true),svr_stopping(false),poll_pool_size(ULONG_MAX),
               conf_needs_db_upd(false),ev_loop_func(NULL),shutdown_server(false),_dummy_thread(false),
-              zmq_event_supplier(NULL),endpoint_specified(false),user_pub_hwm(-1),wattr_nan_allowed(false)
+              zmq_event_supplier(NULL),endpoint_specified(false),user_pub_hwm(-1),wattr_nan_allowed(false),
+              poll_work_stealing(false),dev_startup_th_nb(0)
         {shared_data.cmd_pending=false;shared_data.trigger=false;
         cr_py_lock = new CreatePyLock();}
 
@@ -839,6 +881,11 @@ private:
 
         vector<string>              restarting_devices;     // Restarting devices name
         bool                        wattr_nan_allowed;      // NaN allowed when writing attribute
+        bool                        poll_work_stealing;     // Polling threads pool work stealing mode
+        unsigned long               dev_startup_th_nb;      // Threads number for device creation at startup
+
+        map<string,DeviceImpl *>    dev_name_map;           // Lower case device name (or alias) -> device
+        omni_mutex                  dev_name_map_mutex;     // Mutex to protect the device name map
     };
 
 public:
@@ -933,6 +980,9 @@ public:
     bool is_wattr_nan_allowed() {return ext->wattr_nan_allowed;}
 	void set_wattr_nan_allowed(bool val) {ext->wattr_nan_allowed=val;}
 
+	void register_device_name(string &,DeviceImpl *);
+	void unregister_device_name(DeviceImpl *);
+
 private:
 	TANGO_IMP static Util	*_instance;
 	static bool				_constructed;
@@ -1116,6 +1166,25 @@ inline DbDevice *DeviceImpl::get_db_device()
 	return db_dev;
 }
 
+//
+// Return the current date in mS (for timing measurements)
+//
+
+inline double get_date_ms()
+{
+#ifdef _TG_WINDOWS_
+	struct _timeb t;
+	_ftime(&t);
+
+	return (double)t.time * 1000.0 + (double)t.millitm;
+#else
+	struct timeval tv;
+	gettimeofday(&tv,NULL);
+
+	return (double)tv.tv_sec * 1000.0 + (double)tv.tv_usec / 1000.0;
+#endif
+}
+
 void clear_att_dim(Tango::AttributeValue_3 &att_val);
 void clear_att_dim(Tango::AttributeValue_4 &att_val);
 
@@ -822,7 +822,7 @@ int Util::create_poll_thread(const char *dev_name,bool startup,int smallest_upd)
 		PollingThreadInfo *pti_ptr = new PollingThreadInfo();
 		if (smallest_upd != -1)
 			pti_ptr->smallest_upd = smallest_upd;
-		pti_ptr->poll_th = new PollThread(pti_ptr->shared_data,pti_ptr->poll_mon,false);
+		pti_ptr->poll_th = new PollThread(pti_ptr->shared_data,pti_ptr->poll_mon,false,ext->poll_work_stealing);
 		pti_ptr->poll_th->start();
 		int poll_th_id = pti_ptr->poll_th->id();
 		pti_ptr->thread_id = poll_th_id;
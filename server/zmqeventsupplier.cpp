@@ -45,11 +45,17 @@ static const char *RcsId = "$Id$";
 
 #include <iterator>
 
+#ifndef _TG_WINDOWS_
+#include <sys/stat.h>
+#endif
+
 using namespace CORBA;
 
 namespace Tango {
 
 ZmqEventSupplier *ZmqEventSupplier::_instance = NULL;
+omni_mutex ZmqEventSupplier::data_pool_mutex;
+vector<TangoCdrMemoryStream *> ZmqEventSupplier::data_pool;
 
 
 /************************************************************************/
@@ -60,10 +66,29 @@ ZmqEventSupplier *ZmqEventSupplier::_instance = NULL;
 /************************************************************************/
 
 
-ZmqEventSupplier::ZmqEventSupplier(Util *tg):EventSupplier(tg),zmq_context(1),event_pub_sock(NULL),double_send(false),double_send_heartbeat(false)
+ZmqEventSupplier::ZmqEventSupplier(Util *tg):EventSupplier(tg),zmq_context(1),event_pub_sock(NULL),double_send(false),double_send_heartbeat(false),
+batch_window(0),batch_max(EVENT_BATCH_MAX),batch_cond(&push_mutex),batch_th(NULL),batch_th_exit(false),ipc_enabled(true)
 {
 	_instance = this;
 
+//
+// Same host clients receive events through an IPC endpoint unless
+// it is disabled by the user (for clients running in a different
+// file system name space, like containers)
+//
+
+#ifdef _TG_WINDOWS_
+    ipc_enabled = false;
+#else
+    string ipc_var;
+    if (ApiUtil::get_env_var("TANGO_DS_EVENT_IPC",ipc_var) == 0)
+    {
+        transform(ipc_var.begin(),ipc_var.end(),ipc_var.begin(),::tolower);
+        if (ipc_var == "false" || ipc_var == "0" || ipc_var == "off")
+            ipc_enabled = false;
+    }
+#endif
+
 //
 // Create the Publisher socket for heartbeat event and bind it
 // If the user has specified one IP address on the command line,
@@ -205,12 +230,50 @@ ZmqEventSupplier *ZmqEventSupplier::create(Util *tg)
 
 ZmqEventSupplier::~ZmqEventSupplier()
 {
+//
+// Stop the batch thread and delete the not sent batched messages
+//
+
+    if (batch_th != NULL)
+    {
+        {
+            omni_mutex_lock oml(push_mutex);
+            batch_th_exit = true;
+            batch_cond.signal();
+        }
+        batch_th->join(NULL);
+    }
+
+    map<string,vector<zmq::message_t *> >::iterator b_ite;
+    for (b_ite = batch_mess.begin();b_ite != batch_mess.end();++b_ite)
+    {
+        for (unsigned int i = 0;i < b_ite->second.size();++i)
+            delete b_ite->second[i];
+    }
+    batch_mess.clear();
+
 //
 // Delete zmq sockets
 //
 
     delete heartbeat_pub_sock;
     delete event_pub_sock;
+
+#ifndef _TG_WINDOWS_
+    if (ipc_event_endpoint.empty() == false)
+        ::unlink(ipc_event_endpoint.substr(::strlen(IPC_PROT)).c_str());
+    if (ipc_dir.empty() == false)
+        ::rmdir(ipc_dir.c_str());
+#endif
+
+//
+// Delete the free event data buffers
+//
+
+    omni_mutex_lock oml(data_pool_mutex);
+    for (unsigned int i = 0;i < data_pool.size();++i)
+        delete data_pool[i];
+    data_pool.clear();
 }
 
 //+----------------------------------------------------------------------------
@@ -334,9 +397,450 @@ void ZmqEventSupplier::create_event_socket()
         {
             event_endpoint.replace(6,1,host_ip);
         }
+
+//
+// Also bind the publisher socket to an IPC endpoint. Clients running on
+// the same host will connect to this one and their events do not go
+// through the TCP/IP stack. The endpoint is created in a new directory
+// with a random name (mkdtemp), so it cannot collide with the endpoint of
+// another process, even one with the same pid in another pid name space,
+// and cannot be created in advance by someone else. The directory is
+// readable by all so clients of other users can connect.
+// If the bind fails, local clients simply use the TCP endpoint
+//
+
+        if (ipc_enabled == true)
+        {
+#ifndef _TG_WINDOWS_
+            char dir_name[] = IPC_ENDPOINT_PREFIX "XXXXXX";
+            if (::mkdtemp(dir_name) != NULL)
+            {
+                ipc_dir = dir_name;
+                ::chmod(dir_name,S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
+
+                stringstream ss;
+                ss << IPC_PROT << ipc_dir << '/' << tg->get_pid() << ".event";
+                ipc_event_endpoint = ss.str();
+
+                if (zmq_bind(*event_pub_sock,ipc_event_endpoint.c_str()) != 0)
+                {
+                    cout3 << "ZmqEventSupplier: Can't bind event socket to " << ipc_event_endpoint << endl;
+                    ipc_event_endpoint.clear();
+                    ::rmdir(ipc_dir.c_str());
+                    ipc_dir.clear();
+                }
+            }
+            else
+                cout3 << "ZmqEventSupplier: Can't create directory for IPC event endpoint" << endl;
+#endif
+        }
+
+//
+// Event batching mode: Build the batch event names prefix and start the
+// thread sending the batches when their window is over.
+// The prefix is something like
+//   tango://host:port/dserver/exec_name/inst_name
+//
+
+        if (admin_dev->zmq_event_batch_window > 0)
+        {
+            omni_mutex_lock oml(push_mutex);
+
+            batch_name_prefix = fqdn_prefix;
+            int size = batch_name_prefix.size();
+            if (batch_name_prefix[size - 1] == '#')
+                batch_name_prefix.erase(size - 1);
+            batch_name_prefix = batch_name_prefix + admin_dev->get_name_lower();
+            if (Util::_FileDb == true)
+                batch_name_prefix = batch_name_prefix + MODIFIER_DBASE_NO;
+
+            batch_max = admin_dev->zmq_event_batch_max;
+            if (batch_max < 1)
+                batch_max = 1;
+            batch_window = admin_dev->zmq_event_batch_window;
+
+            batch_th = new ZmqEventBatchThread(this);
+        }
+    }
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSupplier::is_local_client()
+//
+// description : 	Check if a client runs on the same host than the
+//                  server. This is true for clients connected through a
+//                  unix socket or the loopback interface and for clients
+//                  using one of the host interface addresses
+//
+// argument : in :	c_addr : The client identification
+//
+// This method returns true if the client runs on this host
+//
+//-----------------------------------------------------------------------------
+
+bool ZmqEventSupplier::is_local_client(client_addr *c_addr)
+{
+    string cl_ip(c_addr->client_ip);
+
+    if (cl_ip.find(":unix:") != string::npos)
+        return true;
+
+//
+// Extract the IP address from giop:tcp:<ip>:<port>
+//
+
+    string::size_type pos = cl_ip.find(":tcp:");
+    if (pos == string::npos)
+        return false;
+    cl_ip.erase(0,pos + 5);
+
+    pos = cl_ip.rfind(':');
+    if (pos != string::npos)
+        cl_ip.erase(pos);
+    if ((cl_ip.empty() == false) && (cl_ip[0] == '['))
+    {
+        cl_ip.erase(0,1);
+        cl_ip.erase(cl_ip.size() - 1);
+        pos = cl_ip.rfind(':');
+        if ((pos != string::npos) && (cl_ip.find('.') != string::npos))
+            cl_ip.erase(0,pos + 1);
+    }
+
+    if ((cl_ip.find("127.") == 0) || (cl_ip == "::1"))
+        return true;
+
+    vector<string> adrs;
+    try
+    {
+        ApiUtil::instance()->get_ip_from_if(adrs);
+    }
+    catch (...) {}
+
+    if (find(adrs.begin(),adrs.end(),cl_ip) != adrs.end())
+        return true;
+
+    return false;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSupplier::get_batch_event_name()
+//
+// description : 	Return the batch event name of a client. Each client
+//                  process has its own batch event, so the ZMQ subscription
+//                  filter only sends it the events it has subscribed to.
+//                  The batch name is something like
+//                     tango://host:port/dserver/exec_name/inst_name.<client>.batch
+//                  where <client> is built from the client host and pid
+//
+// argument : in :	c_addr : The client identification (NULL for a call
+//                           from within the process)
+//
+//-----------------------------------------------------------------------------
+
+string ZmqEventSupplier::get_batch_event_name(client_addr *c_addr)
+{
+    string client("local");
+
+    if (c_addr != NULL)
+    {
+
+//
+// Remove the port number from the client address (TCP)
+//
+
+        string cl_ip(c_addr->client_ip);
+        if (cl_ip.find(":tcp:") != string::npos)
+        {
+            string::size_type pos = cl_ip.rfind(':');
+            if (pos != string::npos)
+                cl_ip.erase(pos);
+        }
+
+        stringstream ss;
+        ss << cl_ip << '_' << c_addr->client_pid;
+        client = ss.str();
+
+        for (string::size_type loop = 0;loop < client.size();++loop)
+        {
+            if (isalnum(client[loop]) == 0)
+                client[loop] = '_';
+        }
+    }
+
+    return batch_name_prefix + '.' + client + '.' + BATCH_EVENT_NAME;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSupplier::set_event_batch_client()
+//
+// description : 	Register a client subscription for an event. Only events
+//                  subscribed by clients able to receive batched events
+//                  are batched. An event with at least one client not able
+//                  to receive them is never batched
+//
+// argument : in :	ev_name : The event name
+//                  batch_client : True if the client supports event batch
+//                  c_addr : The client identification
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventSupplier::set_event_batch_client(string &ev_name,bool batch_client,client_addr *c_addr)
+{
+    if (batch_client == false)
+    {
+        omni_mutex_lock oml(push_mutex);
+        unbatched_events[ev_name] = time(NULL);
+    }
+    else
+    {
+        string batch_name = get_batch_event_name(c_addr);
+
+        omni_mutex_lock oml(push_mutex);
+        batched_events[ev_name][batch_name] = time(NULL);
     }
 }
 
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSupplier::is_batched_event()
+//
+// description : 	Check if an event has to be batched. Clients re-subscribe
+//                  every EVENT_RESUBSCRIBE_PERIOD/3. A subscription older than
+//                  EVENT_RESUBSCRIBE_PERIOD is therefore from a client which
+//                  is gone and is removed. Must be called with the push
+//                  mutex locked
+//
+// argument : in :	ev_name : The event name
+//            out : batch_names : The batch event names of the clients
+//                                subscribed to this event
+//
+// This method returns true if the event has to be batched
+//
+//-----------------------------------------------------------------------------
+
+bool ZmqEventSupplier::is_batched_event(string &ev_name,vector<string> &batch_names)
+{
+    time_t now = time(NULL);
+
+    map<string,time_t>::iterator ite = unbatched_events.find(ev_name);
+    if (ite != unbatched_events.end())
+    {
+        if ((now - ite->second) <= EVENT_RESUBSCRIBE_PERIOD)
+            return false;
+        unbatched_events.erase(ite);
+    }
+
+    map<string,map<string,time_t> >::iterator b_ite = batched_events.find(ev_name);
+    if (b_ite == batched_events.end())
+        return false;
+
+    batch_names.clear();
+    ite = b_ite->second.begin();
+    while (ite != b_ite->second.end())
+    {
+        if ((now - ite->second) > EVENT_RESUBSCRIBE_PERIOD)
+            b_ite->second.erase(ite++);
+        else
+        {
+            batch_names.push_back(ite->first);
+            ++ite;
+        }
+    }
+
+    if (batch_names.empty() == true)
+    {
+        batched_events.erase(b_ite);
+        return false;
+    }
+
+    return true;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSupplier::add_to_batch()
+//
+// description : 	Add one event to the batch of each client subscribed
+//                  to it. A batch is sent if it is full. The push mutex
+//                  must be locked by the caller
+//
+// argument : in :	batch_names : The client batch event names
+//                  name_mess : The event name message
+//                  call_mess : The event call info message
+//                  data_mess : The event data message
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventSupplier::add_to_batch(vector<string> &batch_names,zmq::message_t &name_mess,zmq::message_t &call_mess,zmq::message_t &data_mess)
+{
+
+//
+// First event in batches: Compute the batches sending date and wake up the batch thread
+//
+
+    if (batch_mess.empty() == true)
+    {
+        omni_thread::get_time(&batch_abs_sec,&batch_abs_nsec,batch_window / 1000000,(batch_window % 1000000) * 1000);
+        batch_cond.signal();
+    }
+
+//
+// The messages are copied for all the clients except the last one
+//
+
+    size_t nb_batch = batch_names.size();
+    for (size_t loop = 0;loop < nb_batch;++loop)
+    {
+        vector<zmq::message_t *> &b_mess = batch_mess[batch_names[loop]];
+        zmq::message_t *mess[3];
+        for (int i = 0;i < 3;++i)
+            mess[i] = new zmq::message_t();
+
+        if (loop == nb_batch - 1)
+        {
+            mess[0]->move(&name_mess);
+            mess[1]->move(&call_mess);
+            mess[2]->move(&data_mess);
+        }
+        else
+        {
+            mess[0]->copy(&name_mess);
+            mess[1]->copy(&call_mess);
+            mess[2]->copy(&data_mess);
+        }
+
+        for (int i = 0;i < 3;++i)
+            b_mess.push_back(mess[i]);
+
+        if (b_mess.size() >= (size_t)batch_max * 3)
+            send_batch(batch_names[loop]);
+    }
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSupplier::send_batch()
+//
+// description : 	Send the batched events of one client in one ZMQ
+//                  multipart message. The message frames are
+//                      - The client batch event name
+//                      - The host endianess
+//                      - For each event: event name, call info and data
+//                  The push mutex must be locked by the caller
+//
+// argument : in :	batch_name : The client batch event name
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventSupplier::send_batch(const string &batch_name)
+{
+    map<string,vector<zmq::message_t *> >::iterator b_ite = batch_mess.find(batch_name);
+    if (b_ite == batch_mess.end())
+        return;
+
+    vector<zmq::message_t *> &b_mess = b_ite->second;
+
+    zmq::message_t name_mess(batch_name.size());
+    memcpy(name_mess.data(),batch_name.data(),batch_name.size());
+
+    zmq::message_t endian(1);
+    memcpy(endian.data(),&host_endian,1);
+
+    size_t nb_mess = b_mess.size();
+
+    try
+    {
+        event_pub_sock->send(name_mess,ZMQ_SNDMORE);
+        event_pub_sock->send(endian,ZMQ_SNDMORE);
+
+        for (size_t i = 0;i < nb_mess;++i)
+        {
+            if (i == nb_mess - 1)
+                event_pub_sock->send(*(b_mess[i]),0);
+            else
+                event_pub_sock->send(*(b_mess[i]),ZMQ_SNDMORE);
+        }
+    }
+    catch(...)
+    {
+        for (size_t i = 0;i < nb_mess;++i)
+            delete b_mess[i];
+        batch_mess.erase(b_ite);
+        throw;
+    }
+
+    for (size_t i = 0;i < nb_mess;++i)
+        delete b_mess[i];
+    batch_mess.erase(b_ite);
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSupplier::send_batch()
+//
+// description : 	Send all the pending batches. The push mutex must be
+//                  locked by the caller
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventSupplier::send_batch()
+{
+    while (batch_mess.empty() == false)
+    {
+        string batch_name(batch_mess.begin()->first);
+        send_batch(batch_name);
+    }
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSupplier::batch_loop()
+//
+// description : 	The batch thread main loop. Send the batch when its
+//                  window is over
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventSupplier::batch_loop()
+{
+    omni_mutex_lock oml(push_mutex);
+
+    while (batch_th_exit == false)
+    {
+        if (batch_mess.empty() == true)
+        {
+            batch_cond.wait();
+            continue;
+        }
+
+        unsigned long now_sec,now_nsec;
+        omni_thread::get_time(&now_sec,&now_nsec);
+
+        if ((now_sec > batch_abs_sec) || ((now_sec == batch_abs_sec) && (now_nsec >= batch_abs_nsec)))
+        {
+            try
+            {
+                send_batch();
+            }
+            catch (zmq::error_t &e)
+            {
+                cerr << "ZmqEventSupplier::batch_loop(): Can't send event batch. Zmq error: " << e.what() << endl;
+            }
+        }
+        else
+            batch_cond.timedwait(batch_abs_sec,batch_abs_nsec);
+    }
+}
+
+void *ZmqEventBatchThread::run_undetached(TANGO_UNUSED(void *ptr))
+{
+    supplier->batch_loop();
+    return NULL;
+}
+
 //+----------------------------------------------------------------------------
 //
 // method : 		ZmqEventSupplier::create_mcast_event_socket()
@@ -753,11 +1257,55 @@ void ZmqEventSupplier::push_heartbeat_event()
 //
 //-----------------------------------------------------------------------------
 
-void tg_unlock(TANGO_UNUSED(void *data),void *hint)
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSupplier::get_data_buffer()
+//
+// description : 	Get a buffer to marshall event data from the pool.
+//                  A new one is created if the pool is empty
+//
+//-----------------------------------------------------------------------------
+
+TangoCdrMemoryStream *ZmqEventSupplier::get_data_buffer()
+{
+    omni_mutex_lock oml(data_pool_mutex);
+
+    if (data_pool.empty() == true)
+        return new TangoCdrMemoryStream();
+
+    TangoCdrMemoryStream *buf = data_pool.back();
+    data_pool.pop_back();
+    return buf;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method : 		ZmqEventSupplier::release_data_buffer()
+//
+// description : 	Give back an event data buffer to the pool. Its memory
+//                  is kept for the next event unless the pool is full
+//
+// argument : in :	buf : The buffer
+//
+//-----------------------------------------------------------------------------
+
+void ZmqEventSupplier::release_data_buffer(TangoCdrMemoryStream *buf)
 {
-    EventSupplier *ev = (EventSupplier *)hint;
-    omni_mutex &the_mutex = ev->get_push_mutex();
-    the_mutex.unlock();
+    omni_mutex_lock oml(data_pool_mutex);
+
+    if (data_pool.size() < DATA_BUFFER_POOL_SIZE)
+        data_pool.push_back(buf);
+    else
+        delete buf;
+}
+
+//
+// Called by ZMQ when a no-copy message (and all its copies) is not used any more
+//
+
+void tg_release_buffer(TANGO_UNUSED(void *data),void *hint)
+{
+    ZmqEventSupplier::release_data_buffer((TangoCdrMemoryStream *)hint);
 }
 
 void ZmqEventSupplier::push_event(DeviceImpl *device_impl,string event_type,
@@ -880,24 +1428,33 @@ void ZmqEventSupplier::push_event(DeviceImpl *device_impl,string event_type,
     void *mess_ptr;
 
 	CORBA::Long padding = 0XDEC0DEC0;
+	TangoCdrMemoryStream *data_buf = get_data_buffer();
+	TangoCdrMemoryStream &data_call_cdr = *data_buf;
 	data_call_cdr.rewindPtrs();
 	padding >>= data_call_cdr;
 	padding >>= data_call_cdr;
 	bool large_data = false;
-	bool large_message_created = false;
+    zmq::message_t data_mess;
 
-    if (except == NULL)
+//
+// If the marshalling fails, give the buffer back to the pool and release
+// the push mutex before re-throwing the exception
+//
+
+    try
     {
-        if (attr_value.attr_val != NULL)
-        {
-            *(attr_value.attr_val) >>= data_call_cdr;
-        }
-        else if (attr_value.attr_val_3 != NULL)
-        {
-            *(attr_value.attr_val_3) >>= data_call_cdr;
-        }
-        else if (attr_value.attr_val_4 != NULL)
+        if (except == NULL)
         {
+            if (attr_value.attr_val != NULL)
+            {
+                *(attr_value.attr_val) >>= data_call_cdr;
+            }
+            else if (attr_value.attr_val_3 != NULL)
+            {
+                *(attr_value.attr_val_3) >>= data_call_cdr;
+            }
+            else if (attr_value.attr_val_4 != NULL)
+            {
 
 //
 // Get number of data exchanged by this event
@@ -905,68 +1462,77 @@ void ZmqEventSupplier::push_event(DeviceImpl *device_impl,string event_type,
 // In such a case, we will use ZMQ no-copy message call
 //
 
-            *(attr_value.attr_val_4) >>= data_call_cdr;
+                *(attr_value.attr_val_4) >>= data_call_cdr;
 
-            mess_ptr = data_call_cdr.bufPtr();
-            mess_ptr = (char *)mess_ptr + (sizeof(CORBA::Long) << 1);
+                mess_ptr = data_call_cdr.bufPtr();
+                mess_ptr = (char *)mess_ptr + (sizeof(CORBA::Long) << 1);
 
-            int nb_data;
-            int data_discr = ((int *)mess_ptr)[0];
+                int nb_data;
+                int data_discr = ((int *)mess_ptr)[0];
 
-            if (data_discr == ATT_ENCODED)
+                if (data_discr == ATT_ENCODED)
+                {
+                    const DevVarEncodedArray &dvea = attr_value.attr_val_4->value.encoded_att_value();
+                    nb_data = dvea.length();
+                    if (nb_data > LARGE_DATA_THRESHOLD_ENCODED)
+                        large_data = true;
+                }
+                else
+                {
+                    nb_data = ((int *)mess_ptr)[1];
+                    if (nb_data >= LARGE_DATA_THRESHOLD)
+                        large_data = true;
+                }
+            }
+            else if (attr_value.attr_conf_2 != NULL)
+            {
+                *(attr_value.attr_conf_2) >>= data_call_cdr;
+            }
+            else if (attr_value.attr_conf_3 != NULL)
             {
-                const DevVarEncodedArray &dvea = attr_value.attr_val_4->value.encoded_att_value();
-                nb_data = dvea.length();
-                if (nb_data > LARGE_DATA_THRESHOLD_ENCODED)
-                    large_data = true;
+                *(attr_value.attr_conf_3) >>= data_call_cdr;
             }
             else
             {
-                nb_data = ((int *)mess_ptr)[1];
-                if (nb_data >= LARGE_DATA_THRESHOLD)
-                    large_data = true;
+                *(attr_value.attr_dat_ready) >>= data_call_cdr;
             }
         }
-        else if (attr_value.attr_conf_2 != NULL)
-        {
-            *(attr_value.attr_conf_2) >>= data_call_cdr;
-        }
-        else if (attr_value.attr_conf_3 != NULL)
-        {
-            *(attr_value.attr_conf_3) >>= data_call_cdr;
-        }
         else
         {
-            *(attr_value.attr_dat_ready) >>= data_call_cdr;
+            except->errors >>= data_call_cdr;
         }
-    }
-    else
-    {
-        except->errors >>= data_call_cdr;
-    }
 
-    mess_size = data_call_cdr.bufSize() - sizeof(CORBA::Long);
-    mess_ptr = (char *)data_call_cdr.bufPtr() + sizeof(CORBA::Long);
+        mess_size = data_call_cdr.bufSize() - sizeof(CORBA::Long);
+        mess_ptr = (char *)data_call_cdr.bufPtr() + sizeof(CORBA::Long);
 
 //
 // For event with small amount of data, use memcpy to initialize
-// the zmq message. For large amount of data, use zmq message
-// with no-copy option
+// the zmq message and give the buffer back to the pool.
+// For large amount of data, use zmq message with no-copy option.
+// The buffer then belongs to ZMQ which gives it back to the pool
+// when the message (and its copies for double send) is sent
 //
 
-    zmq::message_t data_mess;
-
-    if (large_data == true)
-    {
-        data_mess.rebuild(mess_ptr,mess_size,tg_unlock,(void *)this);
-        large_message_created = true;
+        if (large_data == true)
+        {
+            data_mess.rebuild(mess_ptr,mess_size,tg_release_buffer,(void *)data_buf);
+        }
+        else
+        {
+            data_mess.rebuild(mess_size);
+            memcpy(data_mess.data(),mess_ptr,mess_size);
+        }
     }
-    else
+    catch(...)
     {
-        data_mess.rebuild(mess_size);
-        memcpy(data_mess.data(),mess_ptr,mess_size);
+        release_data_buffer(data_buf);
+        push_mutex.unlock();
+        throw;
     }
 
+    if (large_data == false)
+        release_data_buffer(data_buf);
+
 //
 // Send the data
 //
@@ -1053,6 +1619,31 @@ void ZmqEventSupplier::push_event(DeviceImpl *device_impl,string event_type,
             double_send = false;
         }
 
+//
+// In event batching mode, small events sent on the event socket are stored
+// in the batch which is sent when full or when its window is over.
+// Other events are sent directly but after the pending batch to keep
+// the events order
+//
+
+        if (batch_window != 0)
+        {
+            vector<string> batch_names;
+            if ((large_data == false) && (send_nb == 1) && (pub == event_pub_sock) &&
+                (is_batched_event(event_name,batch_names) == true))
+            {
+                add_to_batch(batch_names,name_mess,event_call_mess,data_mess);
+
+                if (ev_cptr_ite != event_cptr.end())
+                    ev_cptr_ite->second++;
+
+                push_mutex.unlock();
+                return;
+            }
+            else if (batch_mess.empty() == false)
+                send_batch();
+        }
+
 //
 // If we have a multicast socket with also a local client
 // we are obliged to send to times the messages.
@@ -1128,17 +1719,17 @@ void ZmqEventSupplier::push_event(DeviceImpl *device_impl,string event_type,
             ev_cptr_ite->second++;
 
 //
-// release mutex if we haven't use ZMQ no copy mode
+// For reference counting on zmq messages which do not have a local scope
 //
 
-        if (large_data == false)
-            push_mutex.unlock();
+        endian_mess.copy(&endian_mess_2);
 
 //
-// For reference counting on zmq messages which do not have a local scope
+// Release mutex. Even in ZMQ no copy mode, the data buffer is not
+// shared with the next event
 //
 
-        endian_mess.copy(&endian_mess_2);
+        push_mutex.unlock();
     }
     catch(...)
     {
@@ -1146,8 +1737,7 @@ void ZmqEventSupplier::push_event(DeviceImpl *device_impl,string event_type,
         if (endian_mess_sent == true)
             endian_mess.copy(&endian_mess_2);
 
-        if (large_message_created == false)
-            push_mutex.unlock();
+        push_mutex.unlock();
 
         TangoSys_OMemStream o;
         o << "Can't push ZMQ event for event ";